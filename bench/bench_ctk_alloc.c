@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Multi-threaded allocation throughput of ctk_malloc()/ctk_free() compared to
+ * malloc()/free(), and big blocks from ctk_mmap_alloc() compared to the heap.
+ *
+ * @details
+ * - Build the library with `make rebuild ALLOC_CACHE=true BUILD_MODE=release`
+ *   to measure the per-thread caches.
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "bench_ctk_alloc.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_alloc.h"
+// C Standard Library
+#include <stdbool.h>
+#include <stdint.h> // uintptr_t, uint32_t
+#include <stdio.h>  // printf(), snprintf()
+#include <stdlib.h> // EXIT_FAILURE, exit(), free(), malloc()
+#include <string.h> // memset()
+// POSIX
+#include <pthread.h>
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Number of blocks live at once in a thread: more than glibc's tcache holds
+#define BENCH_LIVE 256
+// Number of allocate/free rounds of BENCH_LIVE blocks per thread
+#define BENCH_ROUNDS 400
+// Maximum number of threads
+#define BENCH_THREADS_MAX 32
+// Size of the blocks grown by BENCH_ctk_mmap_realloc()
+#define BENCH_GROW_MIN ((size_t)1 << 20)
+#define BENCH_GROW_MAX ((size_t)256 << 20)
+// Size of the table read by BENCH_ctk_mmap_lookup()
+#define BENCH_TABLE_SIZE ((size_t)256 << 20)
+// Number of random reads per call of BENCH_ctk_mmap_lookup()
+#define BENCH_LOOKUPS 65536
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void BENCH_ctk_malloc_free(void);
+static void BENCH_ctk_mmap_realloc(void);
+static void BENCH_ctk_mmap_lookup(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_alloc()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_alloc(void)
+{
+    bench_group(__func__);
+    BENCH_ctk_malloc_free();
+    BENCH_ctk_mmap_realloc();
+    BENCH_ctk_mmap_lookup();
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_malloc_free()
+------------------------------------------------------------------------------*/
+static void * bench_sys_malloc(const size_t size)
+{
+    return malloc(size);
+}
+static void bench_sys_free(void ** const ptr)
+{
+    free(*ptr);
+    *ptr = NULL;
+}
+struct bench_alloc_api {
+    void * (* malloc)(size_t size);
+    void (* free)(void ** ptr);
+};
+static const struct bench_alloc_api bench_sys = {
+    bench_sys_malloc, bench_sys_free
+};
+static const struct bench_alloc_api bench_ctk = {
+    ctk_malloc, (ctk_free)
+};
+// Allocates BENCH_LIVE blocks of 16 to 512 bytes then frees them in an order
+// different from the allocation one, BENCH_ROUNDS times
+static void * bench_alloc_thread(void * const arg)
+{
+    const struct bench_alloc_api * const api = arg;
+    void * blocks[BENCH_LIVE];
+    uint32_t seed = (uint32_t)(uintptr_t)&blocks;
+    for(int round = 0; round < BENCH_ROUNDS; round++) {
+        for(size_t i = 0; i < BENCH_LIVE; i++) {
+            seed = seed * 1103515245u + 12345u;
+            blocks[i] = api->malloc(16 + (seed >> 16) % 497);
+            if(blocks[i] == NULL) {
+                printf("\tbench_alloc_thread(): out of memory\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+        for(size_t i = 0; i < BENCH_LIVE; i++) {
+            api->free(&blocks[(i * 7) % BENCH_LIVE]);
+        }
+    }
+    return NULL;
+}
+struct bench_alloc_arg {
+    const struct bench_alloc_api * api;
+    size_t threads;
+};
+// Runs bench_alloc_thread() in `threads` threads
+static void bench_alloc_run(void * const arg)
+{
+    const struct bench_alloc_arg * const a = arg;
+    pthread_t tids[BENCH_THREADS_MAX];
+    for(size_t i = 0; i < a->threads; i++) {
+        if(pthread_create(&tids[i], NULL, bench_alloc_thread,
+            (void *)(uintptr_t)a->api) != 0) {
+            printf("\tbench_alloc_run(): can't create a thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for(size_t i = 0; i < a->threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+}
+static void BENCH_ctk_malloc_free(void)
+{
+    const size_t threads[] = {1, 4, 16, BENCH_THREADS_MAX};
+    for(size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        const size_t pairs = threads[i] * BENCH_ROUNDS * BENCH_LIVE;
+        struct bench_alloc_arg arg = {&bench_sys, threads[i]};
+        char label[64];
+        snprintf(label, sizeof(label), "malloc/free %zu threads", threads[i]);
+        const struct bench_result sys = bench_run(
+            label, bench_alloc_run, &arg, 0, pairs
+        );
+        arg.api = &bench_ctk;
+        snprintf(label, sizeof(label), "ctk_malloc/ctk_free %zu threads",
+            threads[i]);
+        const struct bench_result ctk = bench_run(
+            label, bench_alloc_run, &arg, 0, pairs
+        );
+        bench_speedup(sys, ctk);
+    }
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_mmap_realloc()
+------------------------------------------------------------------------------*/
+// Grows a block from BENCH_GROW_MIN to BENCH_GROW_MAX bytes by doubling its
+// size, writing every new byte, with ctk_realloc() or ctk_mmap_realloc()
+static void bench_grow(void * const arg)
+{
+    const bool use_mmap = *(const bool *)arg;
+    unsigned char * block = use_mmap
+        ? ctk_mmap_alloc(BENCH_GROW_MIN, 0) : ctk_malloc(BENCH_GROW_MIN);
+    if(block == NULL) {
+        printf("\tbench_grow(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(block, 1, BENCH_GROW_MIN);
+    for(size_t size = BENCH_GROW_MIN; size < BENCH_GROW_MAX; size *= 2) {
+        unsigned char * const grown = use_mmap
+            ? ctk_mmap_realloc(&block, 2 * size)
+            : ctk_realloc(&block, 2 * size);
+        if(grown == NULL) {
+            printf("\tbench_grow(): out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        block = grown;
+        memset(block + size, 1, size);
+    }
+    if(use_mmap) {
+        ctk_mmap_free(&block);
+        return;
+    }
+    ctk_free(&block);
+}
+static void BENCH_ctk_mmap_realloc(void)
+{
+    bool use_mmap = false;
+    const struct bench_result heap = bench_run(
+        "ctk_realloc 1 MiB to 256 MiB", bench_grow, &use_mmap,
+        BENCH_GROW_MAX, 0
+    );
+    use_mmap = true;
+    const struct bench_result mapped = bench_run(
+        "ctk_mmap_realloc 1 MiB to 256 MiB", bench_grow, &use_mmap,
+        BENCH_GROW_MAX, 0
+    );
+    bench_speedup(heap, mapped);
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_mmap_lookup()
+------------------------------------------------------------------------------*/
+// BENCH_LOOKUPS dependent random reads in a table of BENCH_TABLE_SIZE bytes,
+// which miss the TLB with 4 KiB pages
+static void bench_lookup(void * const arg)
+{
+    const uint32_t * const table = arg;
+    const size_t count = BENCH_TABLE_SIZE / sizeof(table[0]);
+    uint32_t index = 0;
+    for(size_t i = 0; i < BENCH_LOOKUPS; i++) {
+        index = (index * 1103515245u + 12345u + table[index % count]);
+    }
+    // Keeps the loads from being optimized away
+    volatile uint32_t sink = index;
+    (void)sink;
+}
+static void BENCH_ctk_mmap_lookup(void)
+{
+    const unsigned int flags[] = {
+        CTK_MMAP_POPULATE, CTK_MMAP_HUGE | CTK_MMAP_POPULATE
+    };
+    const char * const labels[] = {
+        "ctk_mmap_alloc 256 MiB lookups", "ctk_mmap_alloc huge 256 MiB lookups"
+    };
+    struct bench_result res[2];
+    for(size_t i = 0; i < 2; i++) {
+        uint32_t * table = ctk_mmap_alloc(BENCH_TABLE_SIZE, flags[i]);
+        if(table == NULL) {
+            printf("\tBENCH_ctk_mmap_lookup(): out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        res[i] = bench_run(labels[i], bench_lookup, table, 0, BENCH_LOOKUPS);
+        ctk_mmap_free(&table);
+    }
+    bench_speedup(res[0], res[1]);
+}
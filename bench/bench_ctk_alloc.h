@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef BENCH_CTK_ALLOC_H_20261018134702
+#define BENCH_CTK_ALLOC_H_20261018134702
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+void BENCH_ctk_alloc(void);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // BENCH_CTK_ALLOC_H_20261018134702
@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Lookups and insertions of ctk_hashmap compared to a chained hash table, the
+ * kind of table ctk users wrote before ctk_hashmap.
+ *
+ * @details
+ * - Keys and values are `uint64_t`. Both tables have #BENCH_SLOTS slots, or
+ *   buckets, and are filled up to load factors from 0.5 to 0.875.
+ * - The chained table allocates a node per key with ctk_malloc() and hashes
+ *   with the MurmurHash3 64-bit finalizer, ctk_hashmap with its default
+ *   ctk_hash_n().
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "bench_ctk_hashmap.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_hashmap.h"
+// C Standard Library
+#include <stdint.h> // UINT64_C, uint64_t
+#include <stdio.h>  // printf(), snprintf()
+#include <stdlib.h> // EXIT_FAILURE, exit()
+// Internal
+#include "ctk_alloc.h"
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Number of slots of the tables: 16 groups of ctk_hashmap per 256 slots
+#define BENCH_SLOTS ((size_t)1 << 18)
+// Keys for the largest load factor, then as many missing keys
+#define BENCH_KEYS (BENCH_SLOTS / 8 * 7)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct bench_chain_node {
+    struct bench_chain_node * next;
+    uint64_t key;
+    uint64_t value;
+};
+struct bench_chain {
+    struct bench_chain_node ** buckets;
+    size_t mask;
+};
+struct bench_hashmap_arg {
+    const uint64_t * keys; // Keys to insert or to look up
+    size_t count;          // Number of keys
+    struct ctk_hashmap * map;
+    struct bench_chain chain;
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+static uint64_t bench_keys[2 * BENCH_KEYS];
+// Keys looked up: inserted keys, then missing ones, shuffled
+static uint64_t bench_lookups[2 * BENCH_KEYS];
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void BENCH_ctk_hashmap_load(size_t eighths);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_hashmap()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_hashmap(void)
+{
+    bench_group(__func__);
+    // splitmix64: distinct keys without any pattern
+    uint64_t state = 0;
+    for(size_t i = 0; i < 2 * BENCH_KEYS; i++) {
+        uint64_t key = (state += UINT64_C(0x9E3779B97F4A7C15));
+        key = (key ^ (key >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+        key = (key ^ (key >> 27)) * UINT64_C(0x94D049BB133111EB);
+        bench_keys[i] = key ^ (key >> 31);
+    }
+
+    for(size_t eighths = 4; eighths <= 7; eighths++) {
+        BENCH_ctk_hashmap_load(eighths);
+    }
+}
+/*------------------------------------------------------------------------------
+    bench_chain_*()
+------------------------------------------------------------------------------*/
+static uint64_t bench_chain_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= UINT64_C(0xFF51AFD7ED558CCD);
+    key ^= key >> 33;
+    key *= UINT64_C(0xC4CEB9FE1A85EC53);
+    return key ^ (key >> 33);
+}
+static void bench_chain_create(struct bench_chain * const chain)
+{
+    chain->buckets = ctk_calloc(BENCH_SLOTS, sizeof(chain->buckets[0]));
+    if(chain->buckets == NULL) {
+        printf("\tbench_chain_create(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    chain->mask = BENCH_SLOTS - 1;
+}
+static void bench_chain_destroy(struct bench_chain * const chain)
+{
+    for(size_t i = 0; i <= chain->mask; i++) {
+        struct bench_chain_node * node = chain->buckets[i];
+        while(node != NULL) {
+            struct bench_chain_node * next = node->next;
+            ctk_free(&node);
+            node = next;
+        }
+    }
+    ctk_free(&chain->buckets);
+}
+static uint64_t * bench_chain_get(
+    const struct bench_chain * const chain, const uint64_t key
+)
+{
+    struct bench_chain_node * node =
+        chain->buckets[bench_chain_hash(key) & chain->mask];
+    for(; node != NULL; node = node->next) {
+        if(node->key == key) {
+            return &node->value;
+        }
+    }
+    return NULL;
+}
+static uint64_t * bench_chain_insert(
+    struct bench_chain * const chain, const uint64_t key, const uint64_t value
+)
+{
+    uint64_t * const found = bench_chain_get(chain, key);
+    if(found != NULL) {
+        *found = value;
+        return found;
+    }
+    struct bench_chain_node * const node = ctk_malloc(sizeof(*node));
+    if(node == NULL) {
+        return NULL;
+    }
+    struct bench_chain_node ** const bucket =
+        &chain->buckets[bench_chain_hash(key) & chain->mask];
+    *node = (struct bench_chain_node){*bucket, key, value};
+    *bucket = node;
+    return &node->value;
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_hashmap_load()
+------------------------------------------------------------------------------*/
+static struct ctk_hashmap * bench_hashmap_create(void)
+{
+    struct ctk_hashmap * const map = ctk_hashmap_create(
+        &(struct ctk_hashmap_config){
+            .key_size = sizeof(uint64_t), .value_size = sizeof(uint64_t)
+        }
+    );
+    // Exactly BENCH_SLOTS slots for every load factor above 7/16
+    if(map == NULL || ctk_hashmap_reserve(map, BENCH_KEYS) != 0) {
+        printf("\tbench_hashmap_create(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    return map;
+}
+// Builds a table with `count` keys and destroys it
+static void bench_hashmap_insert(void * const arg)
+{
+    const struct bench_hashmap_arg * const a = arg;
+    struct ctk_hashmap * map = bench_hashmap_create();
+    for(size_t i = 0; i < a->count; i++) {
+        if(ctk_hashmap_insert(map, &a->keys[i], &a->keys[i]) == NULL) {
+            printf("\tbench_hashmap_insert(): out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    ctk_hashmap_destroy(&map);
+}
+static void bench_chain_insert_all(void * const arg)
+{
+    const struct bench_hashmap_arg * const a = arg;
+    struct bench_chain chain;
+    bench_chain_create(&chain);
+    for(size_t i = 0; i < a->count; i++) {
+        if(bench_chain_insert(&chain, a->keys[i], a->keys[i]) == NULL) {
+            printf("\tbench_chain_insert_all(): out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    bench_chain_destroy(&chain);
+}
+// Looks `count` keys up and sums their values
+static void bench_hashmap_get(void * const arg)
+{
+    const struct bench_hashmap_arg * const a = arg;
+    uint64_t sum = 0;
+    for(size_t i = 0; i < a->count; i++) {
+        const uint64_t * const value = ctk_hashmap_get(a->map, &a->keys[i]);
+        sum += value != NULL ? *value : 1;
+    }
+    // Keeps the lookups from being optimized away
+    volatile uint64_t sink = sum;
+    (void)sink;
+}
+static void bench_chain_get_all(void * const arg)
+{
+    const struct bench_hashmap_arg * const a = arg;
+    uint64_t sum = 0;
+    for(size_t i = 0; i < a->count; i++) {
+        const uint64_t * const value = bench_chain_get(&a->chain, a->keys[i]);
+        sum += value != NULL ? *value : 1;
+    }
+    volatile uint64_t sink = sum;
+    (void)sink;
+}
+static void BENCH_ctk_hashmap_load(const size_t eighths)
+{
+    const size_t count = BENCH_SLOTS / 8 * eighths;
+    struct bench_hashmap_arg arg = {bench_keys, count, NULL, {NULL, 0}};
+    char label[64];
+    // Insertions into an empty table sized for them
+    snprintf(label, sizeof(label), "chained insert load %zu/8", eighths);
+    const struct bench_result chain_insert = bench_run(
+        label, bench_chain_insert_all, &arg, 0, count
+    );
+    snprintf(label, sizeof(label), "ctk_hashmap_insert load %zu/8", eighths);
+    const struct bench_result map_insert = bench_run(
+        label, bench_hashmap_insert, &arg, 0, count
+    );
+    bench_speedup(chain_insert, map_insert);
+    // Lookups of present keys, then of missing keys
+    arg.map = bench_hashmap_create();
+    bench_chain_create(&arg.chain);
+    for(size_t i = 0; i < count; i++) {
+        if(ctk_hashmap_insert(arg.map, &bench_keys[i], &bench_keys[i]) == NULL
+            || bench_chain_insert(&arg.chain, bench_keys[i], 0) == NULL) {
+            printf("\tBENCH_ctk_hashmap_load(): out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    // Looking keys up in insertion order would favor the chained table, whose
+    // nodes would be read in allocation order
+    for(size_t i = 0; i < count; i++) {
+        bench_lookups[i] = bench_keys[i];
+        bench_lookups[BENCH_KEYS + i] = bench_keys[BENCH_KEYS + i];
+    }
+    for(size_t i = count - 1; i > 0; i--) {
+        const size_t j = (size_t)(bench_keys[BENCH_KEYS + i] % (i + 1));
+        const uint64_t tmp = bench_lookups[i];
+        bench_lookups[i] = bench_lookups[j];
+        bench_lookups[j] = tmp;
+    }
+    const char * const kinds[] = {"hit", "miss"};
+    for(size_t k = 0; k < 2; k++) {
+        arg.keys = bench_lookups + k * BENCH_KEYS;
+        snprintf(label, sizeof(label), "chained get %s load %zu/8",
+            kinds[k], eighths);
+        const struct bench_result chain_get = bench_run(
+            label, bench_chain_get_all, &arg, 0, count
+        );
+        snprintf(label, sizeof(label), "ctk_hashmap_get %s load %zu/8",
+            kinds[k], eighths);
+        const struct bench_result map_get = bench_run(
+            label, bench_hashmap_get, &arg, 0, count
+        );
+        bench_speedup(chain_get, map_get);
+    }
+    ctk_hashmap_destroy(&arg.map);
+    bench_chain_destroy(&arg.chain);
+}
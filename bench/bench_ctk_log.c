@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Throughput and latency of ctk_log_write() with many producer threads,
+ * compared to formatting the same records with `fprintf()`.
+ *
+ * @details
+ * - Records go to `/dev/null` so that the cost of the device doesn't hide the
+ *   cost of the logger.
+ * - A ctk_log case ends with ctk_log_flush(): it measures the time until the
+ *   records are written, not only until they are queued.
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "bench_ctk_log.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_log.h"
+// C Standard Library
+#include <stdint.h> // int64_t
+#include <stdio.h>  // FILE, fclose(), fopen(), fprintf(), printf(),
+                    // snprintf(), POSIX fileno()
+#include <stdlib.h> // EXIT_FAILURE, exit()
+// POSIX
+#include <pthread.h>
+// Internal
+#include "ctk_time.h"
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Number of records written by a thread per call
+#define BENCH_RECORDS 2000
+// Maximum number of threads
+#define BENCH_THREADS_MAX 32
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void BENCH_ctk_log_write(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_log()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_log(void)
+{
+    bench_group(__func__);
+    BENCH_ctk_log_write();
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_log_write()
+------------------------------------------------------------------------------*/
+struct bench_log_arg {
+    struct ctk_log * log;
+    FILE * stream;
+    size_t threads;
+};
+// Writes BENCH_RECORDS records with fprintf() and the prefix of ctk_log
+static void * bench_fprintf_thread(void * const arg)
+{
+    FILE * const stream = arg;
+    for(int i = 0; i < BENCH_RECORDS; i++) {
+        char time[CTK_TIME_ISO8601_US_STR_LENGTH];
+        ctk_iso8601_time_us(ctk_time_realtime_ns(), time, sizeof(time));
+        fprintf(stream, "%s INFO request %d served in %d us\n", time, i, 42);
+    }
+    return NULL;
+}
+// Writes BENCH_RECORDS records with ctk_log_write()
+static void * bench_log_thread(void * const arg)
+{
+    struct ctk_log * const log = arg;
+    for(int i = 0; i < BENCH_RECORDS; i++) {
+        ctk_log_write(log, CTK_LOG_INFO, "request %d served in %d us", i, 42);
+    }
+    return NULL;
+}
+// Runs `fn` in `threads` threads
+static void bench_log_threads(
+    void * (* const fn)(void *), void * const arg, const size_t threads
+)
+{
+    pthread_t tids[BENCH_THREADS_MAX];
+    for(size_t i = 0; i < threads; i++) {
+        if(pthread_create(&tids[i], NULL, fn, arg) != 0) {
+            printf("\tbench_log_threads(): can't create a thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for(size_t i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+}
+static void bench_fprintf_run(void * const arg)
+{
+    const struct bench_log_arg * const a = arg;
+    bench_log_threads(bench_fprintf_thread, a->stream, a->threads);
+    fflush(a->stream);
+}
+static void bench_log_run(void * const arg)
+{
+    const struct bench_log_arg * const a = arg;
+    bench_log_threads(bench_log_thread, a->log, a->threads);
+    ctk_log_flush(a->log);
+}
+// Creates a logger writing to `stream`
+static struct ctk_log * bench_log_create(
+    FILE * const stream, const enum ctk_log_overflow overflow
+)
+{
+    struct ctk_log * const log = ctk_log_create(&(struct ctk_log_config){
+        .fd = fileno(stream),
+        .queue_capacity = CTK_LOG_QUEUE_CAPACITY,
+        .overflow = overflow,
+        .level = CTK_LOG_INFO
+    });
+    if(log == NULL) {
+        printf("\tbench_log_create(): can't create a logger\n");
+        exit(EXIT_FAILURE);
+    }
+    return log;
+}
+static void BENCH_ctk_log_write(void)
+{
+    FILE * const stream = fopen("/dev/null", "w");
+    if(stream == NULL) {
+        printf("\tBENCH_ctk_log_write(): can't open /dev/null\n");
+        exit(EXIT_FAILURE);
+    }
+    struct ctk_log * block = bench_log_create(stream, CTK_LOG_OVERFLOW_BLOCK);
+    struct ctk_log * drop = bench_log_create(stream, CTK_LOG_OVERFLOW_DROP);
+    const size_t threads[] = {1, 4, 16, BENCH_THREADS_MAX};
+    for(size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        const size_t records = threads[i] * BENCH_RECORDS;
+        struct bench_log_arg arg = {block, stream, threads[i]};
+        char label[64];
+        snprintf(label, sizeof(label), "fprintf %zu threads", threads[i]);
+        const struct bench_result sys = bench_run(
+            label, bench_fprintf_run, &arg, 0, records
+        );
+        snprintf(label, sizeof(label), "ctk_log_write block %zu threads",
+            threads[i]);
+        const struct bench_result ctk = bench_run(
+            label, bench_log_run, &arg, 0, records
+        );
+        bench_speedup(sys, ctk);
+        // Records that don't fit in the queues are dropped instead of waited
+        // for: the cost of a full queue for the producers
+        arg.log = drop;
+        snprintf(label, sizeof(label), "ctk_log_write drop %zu threads",
+            threads[i]);
+        bench_run(label, bench_log_run, &arg, 0, records);
+    }
+    ctk_log_destroy(&drop);
+    ctk_log_destroy(&block);
+    fclose(stream);
+}
@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Searches with a ctk_searcher compared to ctk_strpos() and ctk_strpos_n(),
+ * which preprocess the needle on every call.
+ *
+ * @details
+ * - Log lines: #BENCH_LINES lines of 60 to 180 bytes of random lowercase
+ *   words, one in 16 containing the needle: "ERROR" whose letters don't occur
+ *   elsewhere, or "timeout" whose letters are frequent.
+ * - Long text: the needle, absent, is searched in #BENCH_TEXT bytes of the
+ *   same words.
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "bench_ctk_searcher.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_searcher.h"
+#include "ctk_string.h"
+// C Standard Library
+#include <stddef.h> // size_t
+#include <stdint.h> // UINT64_C, uint64_t
+#include <stdio.h>  // printf(), snprintf()
+#include <stdlib.h> // EXIT_FAILURE, exit()
+#include <string.h> // memcpy(), strlen()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+#define BENCH_LINES 4096
+#define BENCH_LINE_SIZE 192
+#define BENCH_TEXT ((size_t)64 * 1024)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct bench_searcher_arg {
+    const char * needle;
+    struct ctk_searcher * searcher;
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+static char bench_lines[BENCH_LINES][BENCH_LINE_SIZE];
+static size_t bench_line_lengths[BENCH_LINES];
+static char bench_text[BENCH_TEXT + 1];
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static uint64_t bench_searcher_random(uint64_t * state);
+static size_t bench_searcher_words(char * str, size_t length, uint64_t * state);
+static void BENCH_ctk_searcher_lines(const char * needle);
+static void BENCH_ctk_searcher_text(const char * needle);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_searcher()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_searcher(void)
+{
+    bench_group(__func__);
+    uint64_t state = 0;
+    bench_searcher_words(bench_text, BENCH_TEXT, &state);
+
+    BENCH_ctk_searcher_lines("ERROR");
+    BENCH_ctk_searcher_lines("timeout");
+    BENCH_ctk_searcher_text("zqxj");
+    BENCH_ctk_searcher_text("Content-Length:");
+    BENCH_ctk_searcher_text(
+        "a needle of 48 bytes, past the Two-Way threshold"
+    );
+}
+/*------------------------------------------------------------------------------
+    bench_searcher_random()
+------------------------------------------------------------------------------*/
+// splitmix64
+static uint64_t bench_searcher_random(uint64_t * const state)
+{
+    uint64_t x = (*state += UINT64_C(0x9E3779B97F4A7C15));
+    x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+/*------------------------------------------------------------------------------
+    bench_searcher_words()
+------------------------------------------------------------------------------*/
+// Writes up to `length` bytes of words of 1 to 8 lowercase letters separated
+// by spaces and a null character, returns the number of bytes written before
+// the null character
+static size_t bench_searcher_words(
+    char * const str, const size_t length, uint64_t * const state
+)
+{
+    size_t i = 0;
+    while(i + 9 < length) {
+        const size_t word = 1 + bench_searcher_random(state) % 8;
+        for(size_t k = 0; k < word; k++) {
+            str[i++] = (char)('a' + bench_searcher_random(state) % 26);
+        }
+        str[i++] = ' ';
+    }
+    str[i] = '\0';
+    return i;
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_searcher_lines()
+------------------------------------------------------------------------------*/
+static void bench_strpos_lines(void * const arg)
+{
+    const struct bench_searcher_arg * const a = arg;
+    size_t found = 0;
+    for(size_t i = 0; i < BENCH_LINES; i++) {
+        found += ctk_strpos(bench_lines[i], a->needle) >= 0;
+    }
+    // Keeps the searches from being optimized away
+    volatile size_t sink = found;
+    (void)sink;
+}
+static void bench_strpos_n_lines(void * const arg)
+{
+    const struct bench_searcher_arg * const a = arg;
+    const size_t needle_len = strlen(a->needle);
+    size_t found = 0;
+    for(size_t i = 0; i < BENCH_LINES; i++) {
+        found += ctk_strpos_n(bench_lines[i], bench_line_lengths[i],
+            a->needle, needle_len) >= 0;
+    }
+    volatile size_t sink = found;
+    (void)sink;
+}
+static void bench_searcher_lines(void * const arg)
+{
+    const struct bench_searcher_arg * const a = arg;
+    size_t found = 0;
+    for(size_t i = 0; i < BENCH_LINES; i++) {
+        found += ctk_searcher_pos_n(a->searcher, bench_lines[i],
+            bench_line_lengths[i]) >= 0;
+    }
+    volatile size_t sink = found;
+    (void)sink;
+}
+static void BENCH_ctk_searcher_lines(const char * const needle)
+{
+    struct bench_searcher_arg arg = {needle, ctk_searcher_create(needle)};
+    if(arg.searcher == NULL) {
+        printf("\tBENCH_ctk_searcher_lines(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    // Same words for every needle
+    uint64_t state = BENCH_LINES;
+    size_t bytes = 0;
+    for(size_t i = 0; i < BENCH_LINES; i++) {
+        const size_t length = 60 + bench_searcher_random(&state) % 121;
+        bench_line_lengths[i] =
+            bench_searcher_words(bench_lines[i], length, &state);
+        if(i % 16 == 15) {
+            memcpy(bench_lines[i] + bench_line_lengths[i] / 2, needle,
+                strlen(needle));
+        }
+        bytes += bench_line_lengths[i];
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "ctk_strpos \"%s\" x4096 lines", needle);
+    const struct bench_result strpos = bench_run(
+        label, bench_strpos_lines, &arg, bytes, BENCH_LINES
+    );
+    snprintf(label, sizeof(label), "ctk_strpos_n \"%s\" x4096 lines", needle);
+    const struct bench_result strpos_n = bench_run(
+        label, bench_strpos_n_lines, &arg, bytes, BENCH_LINES
+    );
+    snprintf(label, sizeof(label), "ctk_searcher_pos_n \"%s\" x4096 lines",
+        needle);
+    const struct bench_result searcher = bench_run(
+        label, bench_searcher_lines, &arg, bytes, BENCH_LINES
+    );
+    bench_speedup(strpos, searcher);
+    bench_speedup(strpos_n, searcher);
+    ctk_searcher_destroy(&arg.searcher);
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_searcher_text()
+------------------------------------------------------------------------------*/
+static void bench_strpos_text(void * const arg)
+{
+    const struct bench_searcher_arg * const a = arg;
+    volatile ptrdiff_t sink = ctk_strpos(bench_text, a->needle);
+    (void)sink;
+}
+static void bench_strpos_n_text(void * const arg)
+{
+    const struct bench_searcher_arg * const a = arg;
+    volatile ptrdiff_t sink = ctk_strpos_n(
+        bench_text, BENCH_TEXT, a->needle, strlen(a->needle)
+    );
+    (void)sink;
+}
+static void bench_searcher_text(void * const arg)
+{
+    const struct bench_searcher_arg * const a = arg;
+    volatile ptrdiff_t sink =
+        ctk_searcher_pos_n(a->searcher, bench_text, BENCH_TEXT);
+    (void)sink;
+}
+static void BENCH_ctk_searcher_text(const char * const needle)
+{
+    struct bench_searcher_arg arg = {needle, ctk_searcher_create(needle)};
+    if(arg.searcher == NULL) {
+        printf("\tBENCH_ctk_searcher_text(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "ctk_strpos %zu B needle 64 KiB",
+        strlen(needle));
+    const struct bench_result strpos = bench_run(
+        label, bench_strpos_text, &arg, BENCH_TEXT, 0
+    );
+    snprintf(label, sizeof(label), "ctk_strpos_n %zu B needle 64 KiB",
+        strlen(needle));
+    const struct bench_result strpos_n = bench_run(
+        label, bench_strpos_n_text, &arg, BENCH_TEXT, 0
+    );
+    snprintf(label, sizeof(label), "ctk_searcher_pos_n %zu B needle 64 KiB",
+        strlen(needle));
+    const struct bench_result searcher = bench_run(
+        label, bench_searcher_text, &arg, BENCH_TEXT, 0
+    );
+    bench_speedup(strpos, searcher);
+    bench_speedup(strpos_n, searcher);
+    ctk_searcher_destroy(&arg.searcher);
+}
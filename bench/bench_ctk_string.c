@@ -0,0 +1,517 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "bench_ctk_string.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_string.h"
+#include "ctk_strview.h"
+// C Standard Library
+#include <ctype.h>  // isspace()
+#include <stdbool.h>
+#include <stddef.h> // ptrdiff_t
+#include <stdint.h> // UINT64_C, uint64_t
+#include <stdio.h>  // printf(), snprintf()
+#include <stdlib.h> // EXIT_FAILURE, exit(), free(), malloc()
+#include <string.h> // memcmp(), memcpy(), memset(), strstr()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Size of the haystacks
+#define BENCH_HAY_LENGTH (64 * 1024)
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void BENCH_ctk_hash(void);
+static void BENCH_ctk_strcasepos(void);
+static void BENCH_ctk_strrstr(void);
+static void BENCH_ctk_strtolower(void);
+static void BENCH_ctk_strtrim(void);
+static void BENCH_ctk_string_short(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_string()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_string(void)
+{
+    bench_group(__func__);
+    BENCH_ctk_hash();
+    BENCH_ctk_strcasepos();
+    BENCH_ctk_strrstr();
+    BENCH_ctk_strtolower();
+    BENCH_ctk_strtrim();
+    BENCH_ctk_string_short();
+}
+/*------------------------------------------------------------------------------
+    bench_fill()
+------------------------------------------------------------------------------*/
+static char * bench_fill(const size_t length, const char c)
+{
+    char * const str = malloc(length + 1);
+    if(str == NULL) {
+        printf("\tbench_fill(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(str, c, length);
+    str[length] = '\0';
+    return str;
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_hash()
+------------------------------------------------------------------------------*/
+// FNV-1a, the usual byte-at-a-time string hash: one multiply per byte, each
+// depending on the previous one.
+static uint64_t bench_hash_fnv1a(const char * const data, const size_t length)
+{
+    uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    for(size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+struct bench_hash_arg {
+    const char * data;
+    size_t length;
+};
+static void bench_hash_old(void * const arg)
+{
+    const struct bench_hash_arg * const a = arg;
+    volatile uint64_t res = bench_hash_fnv1a(a->data, a->length);
+    (void)res;
+}
+static void bench_hash_new(void * const arg)
+{
+    const struct bench_hash_arg * const a = arg;
+    volatile uint64_t res = ctk_hash_n(a->data, a->length);
+    (void)res;
+}
+static void BENCH_ctk_hash(void)
+{
+    const size_t lengths[] = {8, 16, 32, 64, 1024, 64 * 1024};
+    char * const str = bench_fill(64 * 1024, ' ');
+    for(size_t i = 0; i < 64 * 1024; i++) {
+        str[i] = (char)('a' + i * 7 % 26);
+    }
+    for(size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        struct bench_hash_arg arg = {str, lengths[i]};
+        char label[64];
+        snprintf(label, sizeof(label), "fnv1a %zu", lengths[i]);
+        const struct bench_result old = bench_run(
+            label, bench_hash_old, &arg, lengths[i], 1
+        );
+        snprintf(label, sizeof(label), "ctk_hash_n %zu", lengths[i]);
+        const struct bench_result new = bench_run(
+            label, bench_hash_new, &arg, lengths[i], 1
+        );
+        bench_speedup(old, new);
+    }
+    free(str);
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_strcasepos()
+------------------------------------------------------------------------------*/
+struct bench_strcase_arg {
+    const char * hay;
+    size_t length;
+    const char * needle; // In lower case for the copy, in mixed case otherwise
+    size_t needle_len;
+    char * copy;         // Scratch buffer of the previous approach
+};
+// Previous approach: convert a copy of the haystack to lower case, then search
+// or compare it
+static void bench_strcase_copy_pos(void * const arg)
+{
+    const struct bench_strcase_arg * const a = arg;
+    memcpy(a->copy, a->hay, a->length);
+    ctk_strtolower_n(a->copy, a->length);
+    volatile ptrdiff_t res =
+        ctk_strpos_n(a->copy, a->length, a->needle, a->needle_len);
+    (void)res;
+}
+static void bench_strcase_pos(void * const arg)
+{
+    const struct bench_strcase_arg * const a = arg;
+    volatile ptrdiff_t res =
+        ctk_strcasepos_n(a->hay, a->length, a->needle, a->needle_len);
+    (void)res;
+}
+static void bench_strcase_copy_eq(void * const arg)
+{
+    const struct bench_strcase_arg * const a = arg;
+    memcpy(a->copy, a->hay, a->length);
+    ctk_strtolower_n(a->copy, a->length);
+    volatile bool res = a->length == a->needle_len
+        && memcmp(a->copy, a->needle, a->length) == 0;
+    (void)res;
+}
+static void bench_strcase_eq(void * const arg)
+{
+    const struct bench_strcase_arg * const a = arg;
+    volatile bool res =
+        ctk_strcaseeq_n(a->hay, a->length, a->needle, a->needle_len);
+    (void)res;
+}
+static void BENCH_ctk_strcasepos(void)
+{
+    // Request headers with the one looked for at the end
+    const char headers[] = "Accept-Encoding: gzip, deflate\r\n"
+        "X-Forwarded-For: 10.0.0.1\r\nUser-Agent: Mozilla/5.0\r\n"
+        "Cookie: session=0123456789abcdef\r\n";
+    const char last[] = "Content-Length: 42\r\n";
+    const size_t lengths[] = {256, 1024, 4 * 1024, 64 * 1024};
+    char * const str = bench_fill(64 * 1024, ' ');
+    char * const copy = bench_fill(64 * 1024, ' ');
+    for(size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        const size_t length = lengths[i];
+        for(size_t j = 0; j < length; j++) {
+            str[j] = headers[j % (sizeof(headers) - 1)];
+        }
+        memcpy(str + length - sizeof(last) + 1, last, sizeof(last) - 1);
+        struct bench_strcase_arg arg = {
+            str, length, "content-length:", 15, copy
+        };
+        char label[64];
+        snprintf(label, sizeof(label), "lower copy + ctk_strpos_n %zu",
+            length);
+        const struct bench_result old = bench_run(
+            label, bench_strcase_copy_pos, &arg, length, 0
+        );
+        arg.needle = "CONTENT-length:";
+        snprintf(label, sizeof(label), "ctk_strcasepos_n %zu", length);
+        const struct bench_result new = bench_run(
+            label, bench_strcase_pos, &arg, length, 0
+        );
+        bench_speedup(old, new);
+    }
+    // Header name
+    struct bench_strcase_arg arg = {
+        "Content-Length", 14, "content-length", 14, copy
+    };
+    const struct bench_result old = bench_run(
+        "lower copy + memcmp 14", bench_strcase_copy_eq, &arg, 14, 0
+    );
+    const struct bench_result new = bench_run(
+        "ctk_strcaseeq_n 14", bench_strcase_eq, &arg, 14, 0
+    );
+    bench_speedup(old, new);
+    free(str);
+    free(copy);
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_strrstr()
+------------------------------------------------------------------------------*/
+// Previous implementation of ctk_strrstr(): restart strstr() after each match.
+static const char * bench_strrstr_strstr(
+    const char * const str, const char * const substr
+)
+{
+    if(substr[0] == '\0') {
+        return str;
+    }
+    const char * found = NULL;
+    const char * it = str;
+    while((it = strstr(it, substr))) {
+        found = it++;
+    }
+    return found;
+}
+struct bench_strrstr_arg {
+    const char * hay;
+    const char * needle;
+};
+static void bench_strrstr_old(void * const arg)
+{
+    const struct bench_strrstr_arg * const a = arg;
+    const char * volatile res = bench_strrstr_strstr(a->hay, a->needle);
+    (void)res;
+}
+static void bench_strrstr_new(void * const arg)
+{
+    const struct bench_strrstr_arg * const a = arg;
+    const char * volatile res = ctk_strrstr(a->hay, a->needle);
+    (void)res;
+}
+static void bench_strrstr_case(
+    const char * const name, const char * const hay, const char * const needle
+)
+{
+    // Both implementations must agree before comparing them
+    if(ctk_strrstr(hay, needle) != bench_strrstr_strstr(hay, needle)) {
+        printf("\t%s: ctk_strrstr() differs from the strstr() loop\n", name);
+        return;
+    }
+    struct bench_strrstr_arg arg = {hay, needle};
+    char label[64];
+    snprintf(label, sizeof(label), "strstr loop %s", name);
+    const struct bench_result old = bench_run(
+        label, bench_strrstr_old, &arg, BENCH_HAY_LENGTH, 0
+    );
+    snprintf(label, sizeof(label), "ctk_strrstr %s", name);
+    const struct bench_result new = bench_run(
+        label, bench_strrstr_new, &arg, BENCH_HAY_LENGTH, 0
+    );
+    bench_speedup(old, new);
+}
+// One forward scan is the floor of a reverse search for an absent needle: both
+// read the whole haystack once.
+static void bench_strrstr_fwd(void * const arg)
+{
+    const struct bench_strrstr_arg * const a = arg;
+    const char * volatile res = strstr(a->hay, a->needle);
+    (void)res;
+}
+static void bench_strrstr_absent(
+    const char * const name, const char * const hay, const char * const needle
+)
+{
+    if(strstr(hay, needle) != NULL) {
+        printf("\t%s: the needle isn't absent\n", name);
+        return;
+    }
+    struct bench_strrstr_arg arg = {hay, needle};
+    char label[64];
+    snprintf(label, sizeof(label), "strstr %s", name);
+    const struct bench_result fwd = bench_run(
+        label, bench_strrstr_fwd, &arg, BENCH_HAY_LENGTH, 0
+    );
+    snprintf(label, sizeof(label), "ctk_strrstr %s", name);
+    const struct bench_result rev = bench_run(
+        label, bench_strrstr_new, &arg, BENCH_HAY_LENGTH, 0
+    );
+    bench_speedup(fwd, rev);
+}
+static void BENCH_ctk_strrstr(void)
+{
+    char * const hay_a = bench_fill(BENCH_HAY_LENGTH, 'a');
+    char * const needle_a16 = bench_fill(16, 'a');
+    char * const needle_a512 = bench_fill(512, 'a');
+    char * const needle_ba255 = bench_fill(256, 'a');
+    needle_ba255[0] = 'b';
+    char * const needle_a255b = bench_fill(256, 'a');
+    needle_a255b[255] = 'b';
+    // Log line made of repeated tokens
+    const char token[] = "key=value; ";
+    char * const hay_log = bench_fill(BENCH_HAY_LENGTH, ' ');
+    for(size_t i = 0; i + sizeof(token) - 1 <= BENCH_HAY_LENGTH;
+        i += sizeof(token) - 1) {
+        memcpy(hay_log + i, token, sizeof(token) - 1);
+    }
+    bench_strrstr_case("a{64K} / a{16}", hay_a, needle_a16);
+    bench_strrstr_case("a{64K} / a{512}", hay_a, needle_a512);
+    bench_strrstr_case("a{64K} / ba{255}", hay_a, needle_ba255);
+    bench_strrstr_case("a{64K} / a{255}b", hay_a, needle_a255b);
+    bench_strrstr_case("(key=value; ){6K} / key=", hay_log, "key=");
+    bench_strrstr_case("(key=value; ){6K} / e; k", hay_log, "e; k");
+    // Random lower case text and absent needles, against a forward search
+    char * const hay_text = bench_fill(BENCH_HAY_LENGTH, ' ');
+    uint32_t x = 2; // A seed whose text holds none of the needles
+    for(size_t i = 0; i < BENCH_HAY_LENGTH; i++) {
+        x = x * 1103515245u + 12345u;
+        hay_text[i] = (char)('a' + (x >> 16) % 26);
+    }
+    bench_strrstr_absent("[a-z]{64K} / qzxv", hay_text, "qzxv");
+    bench_strrstr_absent("[a-z]{64K} / timeout", hay_text, "timeout");
+    bench_strrstr_absent(
+        "[a-z]{64K} / connectionrefused", hay_text, "connectionrefused"
+    );
+    free(hay_text);
+    free(hay_a);
+    free(needle_a16);
+    free(needle_a512);
+    free(needle_ba255);
+    free(needle_a255b);
+    free(hay_log);
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_strtolower()
+------------------------------------------------------------------------------*/
+struct bench_case_arg {
+    char * (* fn)(char *, size_t);
+    char * str;
+    size_t length;
+};
+// Both paths are branchless: converting an already converted string costs the
+// same
+static void bench_case_call(void * const arg)
+{
+    const struct bench_case_arg * const a = arg;
+    a->fn(a->str, a->length);
+}
+static void BENCH_ctk_strtolower(void)
+{
+    // Mixed case HTTP header keys
+    const char keys[] = "Content-Type Accept-Encoding X-Forwarded-For Host ";
+    const size_t lengths[] = {16, 64, 256, 4 * 1024, 64 * 1024};
+    char * const str = bench_fill(64 * 1024, ' ');
+    for(size_t i = 0; i < 64 * 1024; i++) {
+        str[i] = keys[i % (sizeof(keys) - 1)];
+    }
+    for(size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        struct bench_case_arg arg = {ctk_strtolower_locale_n, str, lengths[i]};
+        char label[64];
+        snprintf(label, sizeof(label), "ctk_strtolower_locale_n %zu",
+            lengths[i]);
+        const struct bench_result locale = bench_run(
+            label, bench_case_call, &arg, lengths[i], 0
+        );
+        arg.fn = ctk_strtolower_n;
+        snprintf(label, sizeof(label), "ctk_strtolower_n %zu", lengths[i]);
+        const struct bench_result ascii = bench_run(
+            label, bench_case_call, &arg, lengths[i], 0
+        );
+        bench_speedup(locale, ascii);
+    }
+    free(str);
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_strtrim()
+------------------------------------------------------------------------------*/
+// Previous implementation of ctk_strtrim_n(): `isspace()` on each byte, from
+// the end then from the beginning
+static char * bench_strtrim_isspace(char * const str, const size_t length)
+{
+    size_t end = length;
+    while(end > 0 && isspace((unsigned char)str[end - 1])) {
+        end--;
+    }
+    if(end < length) {
+        str[end] = '\0';
+    }
+    size_t start = 0;
+    while(start < end && isspace((unsigned char)str[start])) {
+        start++;
+    }
+    return str + start;
+}
+struct bench_trim_arg {
+    char * (* fn)(char *, size_t);
+    char * str;
+    size_t length;
+    size_t end; // Position of the null character written by the call
+};
+// The null character written by the trim is replaced by a whitespace again
+static void bench_trim_call(void * const arg)
+{
+    const struct bench_trim_arg * const a = arg;
+    char * volatile res = a->fn(a->str, a->length);
+    (void)res;
+    a->str[a->end] = ' ';
+}
+static void bench_trim_str(void * const arg)
+{
+    const struct bench_trim_arg * const a = arg;
+    char * volatile res = ctk_strtrim(a->str);
+    (void)res;
+    a->str[a->end] = ' ';
+}
+static void BENCH_ctk_strtrim(void)
+{
+    // Fields padded with a quarter of whitespaces on each side, as in fixed
+    // width columns
+    const size_t lengths[] = {4, 16, 64, 256, 1024, 4 * 1024};
+    for(size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        const size_t length = lengths[i];
+        const size_t pad = length / 4;
+        char * const str = bench_fill(length, 'x');
+        memset(str, ' ', pad);
+        memset(str + length - pad, ' ', pad);
+        str[pad / 2] = '\t';
+        struct bench_trim_arg arg = {
+            bench_strtrim_isspace, str, length, length - pad
+        };
+        char label[64];
+        snprintf(label, sizeof(label), "isspace loops %zu", length);
+        const struct bench_result old = bench_run(
+            label, bench_trim_call, &arg, length, 0
+        );
+        arg.fn = ctk_strtrim_n;
+        snprintf(label, sizeof(label), "ctk_strtrim_n %zu", length);
+        const struct bench_result new = bench_run(
+            label, bench_trim_call, &arg, length, 0
+        );
+        bench_speedup(old, new);
+        snprintf(label, sizeof(label), "ctk_strtrim %zu", length);
+        bench_run(label, bench_trim_str, &arg, length, 0);
+        free(str);
+    }
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_string_short()
+------------------------------------------------------------------------------*/
+// Calls on a few bytes where the argument checks of the CTK_ERROR_* macros are
+// a noticeable part of the work: compare builds of the library with
+// `CTK_CHECKS=checked` and `CTK_CHECKS=trusted`
+static void bench_short_strpos(void * const arg)
+{
+    (void)arg;
+    volatile ptrdiff_t res = ctk_strpos("key=value", "=");
+    (void)res;
+}
+static void bench_short_strtolower_n(void * const arg)
+{
+    char * volatile res = ctk_strtolower_n(arg, 8);
+    (void)res;
+}
+static void bench_short_strtrimr_n(void * const arg)
+{
+    char * volatile res = ctk_strtrimr_n(arg, 5);
+    (void)res;
+}
+static void bench_short_strview_eq(void * const arg)
+{
+    (void)arg;
+    volatile bool res = ctk_strview_eq(
+        CTK_STRVIEW_LITERAL("Host"), CTK_STRVIEW_LITERAL("host")
+    );
+    (void)res;
+}
+static void bench_short_strview_starts_with(void * const arg)
+{
+    (void)arg;
+    volatile bool res = ctk_strview_starts_with(
+        CTK_STRVIEW_LITERAL("Content-Type"), CTK_STRVIEW_LITERAL("Content-")
+    );
+    (void)res;
+}
+static void BENCH_ctk_string_short(void)
+{
+    bench_group(__func__);
+    char header[] = "X-Header";
+    char value[] = "value";
+    bench_run("ctk_strpos 9/1", bench_short_strpos, NULL, 9, 0);
+    bench_run("ctk_strtolower_n 8", bench_short_strtolower_n, header, 8, 0);
+    bench_run("ctk_strtrimr_n 5", bench_short_strtrimr_n, value, 5, 0);
+    bench_run("ctk_strview_eq 4", bench_short_strview_eq, NULL, 4, 0);
+    bench_run(
+        "ctk_strview_starts_with 12/8", bench_short_strview_starts_with, NULL,
+        8, 0
+    );
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Keyword search with ctk_strmatch compared to a ctk_strpos_n() loop per
+ * keyword, the way ctk users searched for several patterns before.
+ *
+ * @details
+ * - The text is #BENCH_TEXT bytes of random lowercase words in which a
+ *   keyword is planted every 64 words. Keywords are 4 to 8 letters long.
+ * - Both sides count all the occurrences of all the keywords.
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "bench_ctk_strmatch.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_strmatch.h"
+#include "ctk_string.h"
+// C Standard Library
+#include <stddef.h> // ptrdiff_t, size_t
+#include <stdint.h> // UINT64_C, uint64_t
+#include <stdio.h>  // printf(), snprintf()
+#include <stdlib.h> // EXIT_FAILURE, exit()
+#include <string.h> // memcpy(), strlen()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Length of the text
+#define BENCH_TEXT ((size_t)64 * 1024)
+// Largest number of keywords
+#define BENCH_KEYWORDS 256
+// Longest keyword, terminating null character included
+#define BENCH_KEYWORD_SIZE 9
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct bench_strmatch_arg {
+    const char * const * keywords;
+    size_t count;
+    struct ctk_strmatch * matcher;
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+static char bench_text[BENCH_TEXT];
+static char bench_keyword[BENCH_KEYWORDS][BENCH_KEYWORD_SIZE];
+static const char * bench_keywords[BENCH_KEYWORDS];
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static uint64_t bench_strmatch_random(uint64_t * state);
+static void bench_strmatch_word(char * word, size_t length, uint64_t * state);
+static void BENCH_ctk_strmatch_count(size_t count);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_strmatch()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_strmatch(void)
+{
+    bench_group(__func__);
+    uint64_t state = 0;
+    for(size_t i = 0; i < BENCH_KEYWORDS; i++) {
+        const size_t length = 4 + bench_strmatch_random(&state) % 5;
+        bench_strmatch_word(bench_keyword[i], length, &state);
+        bench_keyword[i][length] = '\0';
+        bench_keywords[i] = bench_keyword[i];
+    }
+    size_t words = 0;
+    for(size_t i = 0; i + BENCH_KEYWORD_SIZE < BENCH_TEXT; words++) {
+        if(words % 64 == 63) {
+            const char * const keyword =
+                bench_keywords[bench_strmatch_random(&state) % BENCH_KEYWORDS];
+            const size_t length = strlen(keyword);
+            memcpy(bench_text + i, keyword, length);
+            i += length;
+        }
+        if(words % 64 != 63) {
+            const size_t length = 1 + bench_strmatch_random(&state) % 8;
+            bench_strmatch_word(bench_text + i, length, &state);
+            i += length;
+        }
+        bench_text[i++] = ' ';
+    }
+
+    for(size_t count = 4; count <= BENCH_KEYWORDS; count *= 4) {
+        BENCH_ctk_strmatch_count(count);
+    }
+}
+/*------------------------------------------------------------------------------
+    bench_strmatch_random()
+------------------------------------------------------------------------------*/
+// splitmix64
+static uint64_t bench_strmatch_random(uint64_t * const state)
+{
+    uint64_t x = (*state += UINT64_C(0x9E3779B97F4A7C15));
+    x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+/*------------------------------------------------------------------------------
+    bench_strmatch_word()
+------------------------------------------------------------------------------*/
+static void bench_strmatch_word(
+    char * const word, const size_t length, uint64_t * const state
+)
+{
+    for(size_t i = 0; i < length; i++) {
+        word[i] = (char)('a' + bench_strmatch_random(state) % 26);
+    }
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_strmatch_count()
+------------------------------------------------------------------------------*/
+static void bench_strpos_all(void * const arg)
+{
+    const struct bench_strmatch_arg * const a = arg;
+    size_t found = 0;
+    for(size_t k = 0; k < a->count; k++) {
+        const size_t length = strlen(a->keywords[k]);
+        size_t start = 0;
+        for(;;) {
+            const ptrdiff_t pos = ctk_strpos_n(bench_text + start,
+                BENCH_TEXT - start, a->keywords[k], length);
+            if(pos < 0) {
+                break;
+            }
+            found++;
+            start += (size_t)pos + 1;
+        }
+    }
+    // Keeps the searches from being optimized away
+    volatile size_t sink = found;
+    (void)sink;
+}
+static void bench_strmatch_all(void * const arg)
+{
+    const struct bench_strmatch_arg * const a = arg;
+    volatile size_t sink =
+        ctk_strmatch_all_n(a->matcher, bench_text, BENCH_TEXT, NULL, NULL);
+    (void)sink;
+}
+static void BENCH_ctk_strmatch_count(const size_t count)
+{
+    struct bench_strmatch_arg arg = {bench_keywords, count, NULL};
+    arg.matcher = ctk_strmatch_create(bench_keywords, NULL, count);
+    if(arg.matcher == NULL) {
+        printf("\tBENCH_ctk_strmatch_count(): out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "ctk_strpos_n x%zu keywords 64 KiB", count);
+    const struct bench_result strpos = bench_run(
+        label, bench_strpos_all, &arg, BENCH_TEXT, 0
+    );
+    snprintf(label, sizeof(label), "ctk_strmatch_all_n %zu keywords 64 KiB",
+        count);
+    const struct bench_result strmatch = bench_run(
+        label, bench_strmatch_all, &arg, BENCH_TEXT, 0
+    );
+    bench_speedup(strpos, strmatch);
+    ctk_strmatch_destroy(&arg.matcher);
+}
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Timestamps per second of ctk_iso8601_time_cached() compared to
+ * ctk_iso8601_time(), and cost of reading the clocks.
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "bench_ctk_time.h"
+// Bench headers
+#include "bench_harness.h"
+// The API to benchmark
+#include "ctk_time.h"
+// C Standard Library
+#include <stdint.h> // int64_t, uint64_t
+#include <stdio.h>  // printf(), snprintf()
+#include <string.h> // strcmp()
+#include <time.h>   // time(), time_t
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void BENCH_ctk_iso8601_time(void);
+static void BENCH_ctk_time_clock(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    BENCH_ctk_time()
+------------------------------------------------------------------------------*/
+void BENCH_ctk_time(void)
+{
+    bench_group(__func__);
+    BENCH_ctk_iso8601_time();
+    BENCH_ctk_time_clock();
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_iso8601_time()
+------------------------------------------------------------------------------*/
+// The time moves forward by one second every `per_second` timestamps
+struct bench_iso8601_arg {
+    char * (* fn)(time_t, char *, size_t);
+    time_t start;
+    uint64_t per_second;
+    uint64_t count;
+};
+static void bench_iso8601_call(void * const arg)
+{
+    struct bench_iso8601_arg * const a = arg;
+    char buf[CTK_TIME_ISO8601_STR_LENGTH];
+    char * volatile res = a->fn(
+        a->start + (time_t)(a->count++ / a->per_second), buf, sizeof(buf)
+    );
+    (void)res;
+}
+static void BENCH_ctk_iso8601_time(void)
+{
+    const time_t now = time(NULL);
+    // Both functions must agree before comparing them
+    char expected[CTK_TIME_ISO8601_STR_LENGTH];
+    char actual[CTK_TIME_ISO8601_STR_LENGTH];
+    if(ctk_iso8601_time(now, expected, sizeof(expected)) == NULL
+        || ctk_iso8601_time_cached(now, actual, sizeof(actual)) == NULL
+        || strcmp(expected, actual) != 0) {
+        printf("\tctk_iso8601_time_cached() differs from ctk_iso8601_time()\n");
+        return;
+    }
+    // From a busy logger to a new minute every timestamp
+    const struct {
+        const char * name;
+        uint64_t per_second;
+    } cases[] = {
+        {"1M stamps/s", 1000000},
+        {"1K stamps/s", 1000},
+        {"1 stamp/s", 1},
+    };
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct bench_iso8601_arg arg = {
+            ctk_iso8601_time, now, cases[i].per_second, 0
+        };
+        char label[64];
+        snprintf(label, sizeof(label), "ctk_iso8601_time %s", cases[i].name);
+        const struct bench_result old = bench_run(
+            label, bench_iso8601_call, &arg, 0, 1
+        );
+        arg.fn = ctk_iso8601_time_cached;
+        arg.count = 0;
+        snprintf(label, sizeof(label), "ctk_iso8601_time_cached %s",
+            cases[i].name);
+        const struct bench_result new = bench_run(
+            label, bench_iso8601_call, &arg, 0, 1
+        );
+        bench_speedup(old, new);
+    }
+}
+/*------------------------------------------------------------------------------
+    BENCH_ctk_time_clock()
+------------------------------------------------------------------------------*/
+static void bench_clock_call(void * const arg)
+{
+    int64_t (* const * const fn)(void) = arg;
+    volatile int64_t res = (*fn)();
+    (void)res;
+}
+static void BENCH_ctk_time_clock(void)
+{
+    struct {
+        const char * name;
+        int64_t (* fn)(void);
+    } clocks[] = {
+        {"ctk_time_monotonic_ns", ctk_time_monotonic_ns},
+        {"ctk_time_monotonic_coarse_ns", ctk_time_monotonic_coarse_ns},
+        {"ctk_time_realtime_ns", ctk_time_realtime_ns},
+        {"ctk_time_realtime_coarse_ns", ctk_time_realtime_coarse_ns},
+    };
+    for(size_t i = 0; i < sizeof(clocks) / sizeof(clocks[0]); i++) {
+        bench_run(clocks[i].name, bench_clock_call, &clocks[i].fn, 0, 0);
+    }
+}
@@ -0,0 +1,392 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "bench_harness.h"
+// C Standard Library
+#include <stdbool.h>
+#include <stdint.h> // UINT64_C, uint64_t
+#include <stdio.h>  // FILE, fclose(), fgets(), fopen(), fprintf(), printf(),
+                    // snprintf()
+#include <stdlib.h> // EXIT_FAILURE, EXIT_SUCCESS, qsort(), strtod(), strtol()
+#include <string.h> // memcpy(), strcmp(), strcspn(), strlen(), strncmp(),
+                    // strstr()
+#include <time.h>   // POSIX clock_gettime(), struct timespec
+// Cycle counter
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h> // __rdtsc()
+#endif
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Default number of timed samples per case
+#define BENCH_SAMPLES 11
+// Maximum number of timed samples per case
+#define BENCH_SAMPLES_MAX 1000
+// Minimum duration of the warmup of a case in nanoseconds
+#define BENCH_WARMUP_NS 20000000
+// Default slowdown, in percent, above which a case is a regression
+#define BENCH_THRESHOLD 10
+// Maximum number of cases read from a baseline
+#define BENCH_BASELINE_MAX 512
+// Maximum length of a case name: group/name
+#define BENCH_NAME_MAX 128
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+enum bench_format {
+    BENCH_FORMAT_TEXT,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON,
+};
+struct bench_baseline {
+    char name[BENCH_NAME_MAX];
+    double median_ns;
+};
+/*==============================================================================
+    STATIC VARIABLE
+==============================================================================*/
+static struct {
+    enum bench_format format;
+    FILE * out;
+    const char * filter;
+    double threshold;
+    int samples;
+    const char * group;
+    bool group_printed;
+    size_t results;
+    size_t regressions;
+    size_t baseline_count;
+    struct bench_baseline baseline[BENCH_BASELINE_MAX];
+} bench = {
+    .format = BENCH_FORMAT_TEXT,
+    .threshold = BENCH_THRESHOLD,
+    .samples = BENCH_SAMPLES,
+    .group = "",
+};
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    bench_usage()
+------------------------------------------------------------------------------*/
+static void bench_usage(const char * const program)
+{
+    printf(
+        "Usage: %s [OPTION]...\n"
+        "  --format=FORMAT   text(default), csv or json\n"
+        "  --output=FILE     Write the results to FILE instead of stdout\n"
+        "  --baseline=FILE   Compare with the CSV results of a previous run\n"
+        "  --threshold=PCT   Slowdown in percent above which a case fails\n"
+        "                    (default: %d)\n"
+        "  --filter=STRING   Only run the cases whose name contains STRING\n"
+        "  --samples=N       Number of timed samples per case(default: %d)\n",
+        program, BENCH_THRESHOLD, BENCH_SAMPLES
+    );
+}
+/*------------------------------------------------------------------------------
+    bench_load_baseline()
+------------------------------------------------------------------------------*/
+// Reads the name and median columns of a CSV written with --format=csv
+static int bench_load_baseline(const char * const path)
+{
+    FILE * const file = fopen(path, "r");
+    if(file == NULL) {
+        fprintf(stderr, "bench: can't open baseline '%s'\n", path);
+        return -1;
+    }
+    char line[BENCH_NAME_MAX + 256];
+    while(fgets(line, sizeof(line), file) != NULL) {
+        const size_t comma = strcspn(line, ",");
+        if(line[comma] != ',' || comma >= BENCH_NAME_MAX
+            || strncmp(line, "name,", 5) == 0) {
+            continue;
+        }
+        if(bench.baseline_count == BENCH_BASELINE_MAX) {
+            fprintf(stderr, "bench: too many cases in baseline '%s'\n", path);
+            break;
+        }
+        struct bench_baseline * const entry =
+            &bench.baseline[bench.baseline_count];
+        memcpy(entry->name, line, comma);
+        entry->name[comma] = '\0';
+        char * end = NULL;
+        entry->median_ns = strtod(line + comma + 1, &end);
+        if(end != line + comma + 1 && entry->median_ns > 0) {
+            bench.baseline_count++;
+        }
+    }
+    fclose(file);
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    bench_init()
+------------------------------------------------------------------------------*/
+// Returns the value of `arg` if it starts with `option`, NULL otherwise
+static const char * bench_option(
+    const char * const arg, const char * const option
+)
+{
+    const size_t length = strlen(option);
+    return strncmp(arg, option, length) == 0 ? arg + length : NULL;
+}
+static int bench_parse(const char * const arg, const char ** const output)
+{
+    const char * value = NULL;
+    char * end = NULL;
+    if((value = bench_option(arg, "--format=")) != NULL) {
+        bench.format = strcmp(value, "csv") == 0 ? BENCH_FORMAT_CSV
+            : strcmp(value, "json") == 0 ? BENCH_FORMAT_JSON
+            : BENCH_FORMAT_TEXT;
+        return strcmp(value, "text") == 0 || bench.format != BENCH_FORMAT_TEXT
+            ? 0 : -1;
+    }
+    if((value = bench_option(arg, "--output=")) != NULL) {
+        *output = value;
+        return *value != '\0' ? 0 : -1;
+    }
+    if((value = bench_option(arg, "--baseline=")) != NULL) {
+        return bench_load_baseline(value);
+    }
+    if((value = bench_option(arg, "--threshold=")) != NULL) {
+        bench.threshold = strtod(value, &end);
+        return end != value && *end == '\0' && bench.threshold >= 0 ? 0 : -1;
+    }
+    if((value = bench_option(arg, "--filter=")) != NULL) {
+        bench.filter = value;
+        return 0;
+    }
+    if((value = bench_option(arg, "--samples=")) != NULL) {
+        const long samples = strtol(value, &end, 10);
+        bench.samples = (int)samples;
+        return end != value && *end == '\0'
+            && samples > 0 && samples <= BENCH_SAMPLES_MAX ? 0 : -1;
+    }
+    return -1;
+}
+int bench_init(const int argc, char ** const argv)
+{
+    bench.out = stdout;
+    const char * output = NULL;
+    for(int i = 1; i < argc; i++) {
+        if(bench_parse(argv[i], &output) != 0) {
+            if(strcmp(argv[i], "--help") != 0) {
+                fprintf(stderr, "bench: invalid option '%s'\n", argv[i]);
+            }
+            bench_usage(argv[0]);
+            return -1;
+        }
+    }
+    if(output != NULL && (bench.out = fopen(output, "w")) == NULL) {
+        fprintf(stderr, "bench: can't open output '%s'\n", output);
+        return -1;
+    }
+    if(bench.format == BENCH_FORMAT_TEXT) {
+        fprintf(bench.out, "*** Benchmarking: ctk ***\n");
+    }
+    if(bench.format == BENCH_FORMAT_CSV) {
+        fprintf(bench.out, "name,median_ns,p99_ns,cycles_per_call,"
+            "cycles_per_byte,mops_per_s\n");
+    }
+    if(bench.format == BENCH_FORMAT_JSON) {
+        fprintf(bench.out, "[");
+    }
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    bench_finish()
+------------------------------------------------------------------------------*/
+int bench_finish(void)
+{
+    if(bench.format == BENCH_FORMAT_JSON) {
+        fprintf(bench.out, "%s]\n", bench.results > 0 ? "\n" : "");
+    }
+    if(bench.out != stdout) {
+        fclose(bench.out);
+    }
+    if(bench.regressions > 0) {
+        fprintf(stderr, "bench: %zu case(s) slower than the baseline by more "
+            "than %.1f%%\n", bench.regressions, bench.threshold);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+/*------------------------------------------------------------------------------
+    bench_now()
+------------------------------------------------------------------------------*/
+uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+/*------------------------------------------------------------------------------
+    bench_cycles()
+------------------------------------------------------------------------------*/
+uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return bench_now();
+#endif
+}
+/*------------------------------------------------------------------------------
+    bench_group()
+------------------------------------------------------------------------------*/
+void bench_group(const char * const name)
+{
+    bench.group = name;
+    bench.group_printed = false;
+}
+/*------------------------------------------------------------------------------
+    bench_run()
+------------------------------------------------------------------------------*/
+static int bench_compare(const void * const lhs, const void * const rhs)
+{
+    const double a = *(const double *)lhs;
+    const double b = *(const double *)rhs;
+    return (a > b) - (a < b);
+}
+// Compares a case with the baseline, returns false if the case isn't in it
+static bool bench_check(
+    const char * const name, const double median_ns, double * const slowdown
+)
+{
+    for(size_t i = 0; i < bench.baseline_count; i++) {
+        if(strcmp(bench.baseline[i].name, name) != 0) {
+            continue;
+        }
+        *slowdown = (median_ns / bench.baseline[i].median_ns - 1) * 100;
+        if(*slowdown > bench.threshold) {
+            bench.regressions++;
+            fprintf(stderr, "bench: %s: %.1f ns -> %.1f ns(+%.1f%%)\n",
+                name, bench.baseline[i].median_ns, median_ns, *slowdown);
+        }
+        return true;
+    }
+    return false;
+}
+static void bench_report(
+    const char * const name, const char * const full_name,
+    const struct bench_result res, const size_t bytes, const size_t items
+)
+{
+    const double per_byte = bytes > 0 ? res.cycles / (double)bytes : 0;
+    const double mops = items > 0 ? (double)items * 1000 / res.median_ns : 0;
+    double slowdown = 0;
+    const bool in_baseline = bench_check(full_name, res.median_ns, &slowdown);
+    if(bench.format == BENCH_FORMAT_CSV) {
+        fprintf(bench.out, "%s,%.3f,%.3f,%.1f,%.4f,%.3f\n",
+            full_name, res.median_ns, res.p99_ns, res.cycles, per_byte, mops);
+        return;
+    }
+    if(bench.format == BENCH_FORMAT_JSON) {
+        fprintf(bench.out, "%s\n  {\"name\": \"%s\", \"median_ns\": %.3f, "
+            "\"p99_ns\": %.3f, \"cycles_per_call\": %.1f, "
+            "\"cycles_per_byte\": %.4f, \"mops_per_s\": %.3f}",
+            bench.results > 1 ? "," : "", full_name, res.median_ns,
+            res.p99_ns, res.cycles, per_byte, mops);
+        return;
+    }
+    // Groups without any case left by the filter aren't printed
+    if(!bench.group_printed) {
+        fprintf(bench.out, "%s:\n", bench.group);
+        bench.group_printed = true;
+    }
+    fprintf(bench.out, "\t%-44s %12.1f ns | p99 %12.1f ns", name,
+        res.median_ns, res.p99_ns);
+    if(bytes > 0) {
+        fprintf(bench.out, " | %7.3f %s/B", per_byte, BENCH_CYCLE_UNIT);
+    }
+    if(items > 0) {
+        fprintf(bench.out, " | %8.2f Mops/s", mops);
+    }
+    if(in_baseline) {
+        fprintf(bench.out, " | %+.1f%%", slowdown);
+    }
+    fprintf(bench.out, "\n");
+}
+struct bench_result bench_run(
+    const char * const name, void (* const fn)(void * arg), void * const arg,
+    const size_t bytes, const size_t items
+)
+{
+    struct bench_result res = {0, 0, 0};
+    char full_name[BENCH_NAME_MAX];
+    snprintf(full_name, sizeof(full_name), "%s/%s", bench.group, name);
+    if(bench.filter != NULL && strstr(full_name, bench.filter) == NULL) {
+        return res;
+    }
+    // Warms up the caches and the branch predictors while estimating the
+    // duration of a call to size the batches
+    uint64_t calls = 0;
+    const uint64_t warmup_start = bench_now();
+    uint64_t elapsed = 0;
+    do {
+        fn(arg);
+        calls++;
+        elapsed = bench_now() - warmup_start;
+    } while(elapsed < BENCH_WARMUP_NS);
+    const uint64_t per_call = elapsed / calls + 1;
+    const uint64_t batch = per_call >= BENCH_SAMPLE_MIN_NS
+        ? 1 : BENCH_SAMPLE_MIN_NS / per_call + 1;
+    double ns[BENCH_SAMPLES_MAX];
+    double cycles[BENCH_SAMPLES_MAX];
+    for(int i = 0; i < bench.samples; i++) {
+        const uint64_t start = bench_now();
+        const uint64_t start_cycles = bench_cycles();
+        for(uint64_t j = 0; j < batch; j++) {
+            fn(arg);
+        }
+        cycles[i] = (double)(bench_cycles() - start_cycles) / (double)batch;
+        ns[i] = (double)(bench_now() - start) / (double)batch;
+    }
+    const size_t count = (size_t)bench.samples;
+    qsort(ns, count, sizeof(ns[0]), bench_compare);
+    qsort(cycles, count, sizeof(cycles[0]), bench_compare);
+    // Nearest-rank percentiles
+    res.median_ns = ns[(count - 1) / 2];
+    res.p99_ns = ns[(count * 99 + 99) / 100 - 1];
+    res.cycles = cycles[(count - 1) / 2];
+    bench.results++;
+    bench_report(name, full_name, res, bytes, items);
+    return res;
+}
+/*------------------------------------------------------------------------------
+    bench_speedup()
+------------------------------------------------------------------------------*/
+void bench_speedup(
+    const struct bench_result before, const struct bench_result after
+)
+{
+    if(bench.format != BENCH_FORMAT_TEXT
+        || before.median_ns <= 0 || after.median_ns <= 0) {
+        return;
+    }
+    fprintf(bench.out, "\t%-44s x%.2f\n", "",
+        before.median_ns / after.median_ns);
+}
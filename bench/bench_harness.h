@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Minimal harness shared by all benchmarks.
+ *
+ * @details
+ * - Each case is warmed up, then timed over a number of samples. A sample
+ *   runs the case enough times in a row to last at least
+ *   #BENCH_SAMPLE_MIN_NS, which hides the cost of reading the clock.
+ * - The median and the 99th percentile of the time per call are reported,
+ *   with the cycles per byte for cases processing bytes and the throughput
+ *   for cases made of several operations.
+ * - Results are printed as text, CSV or JSON and can be compared with a
+ *   baseline saved as CSV by a previous run: the program then fails if a
+ *   case got slower than a threshold.
+ * - Run the program with `--help` for its options.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef BENCH_HARNESS_H_20261018170540
+#define BENCH_HARNESS_H_20261018170540
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Minimum duration of a sample in nanoseconds
+#define BENCH_SAMPLE_MIN_NS 1000000
+// Unit of bench_cycles()
+#if defined(__x86_64__) || defined(__i386__)
+    #define BENCH_CYCLE_UNIT "cycle"
+#else
+    #define BENCH_CYCLE_UNIT "ns"
+#endif
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+// Statistics of a case, all zero if the case was filtered out
+struct bench_result {
+    double median_ns; // Median time per call
+    double p99_ns;    // 99th percentile of the time per call
+    double cycles;    // Median cycles per call
+};
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+// Parses the command line, returns 0 on success and -1 if the program must
+// stop(e.g. invalid option or `--help`)
+int bench_init(int argc, char ** argv);
+// Ends the output, returns EXIT_FAILURE if a case is slower than the baseline
+// by more than the threshold, EXIT_SUCCESS otherwise
+int bench_finish(void);
+// Nanoseconds from a monotonic clock
+uint64_t bench_now(void);
+// Reference cycles from the time-stamp counter on x86, nanoseconds elsewhere
+uint64_t bench_cycles(void);
+// Starts a group of cases, usually named after the benchmark function. In text
+// output, the name is printed before the first case of the group.
+void bench_group(const char * name);
+// Times `fn(arg)` and reports it as `name` in the current group. `bytes` is
+// the number of bytes processed by a call and `items` its number of
+// operations, `0` if not relevant.
+struct bench_result bench_run(
+    const char * name, void (* fn)(void * arg), void * arg,
+    size_t bytes, size_t items
+);
+// Prints how many times `after` is faster than `before`(text output only)
+void bench_speedup(struct bench_result before, struct bench_result after);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // BENCH_HARNESS_H_20261018170540
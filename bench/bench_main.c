@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Bench headers
+#include "bench_ctk_alloc.h"
+#include "bench_ctk_hashmap.h"
+#include "bench_ctk_log.h"
+#include "bench_ctk_searcher.h"
+#include "bench_ctk_strmatch.h"
+#include "bench_ctk_string.h"
+#include "bench_ctk_time.h"
+#include "bench_harness.h"
+// C Standard Library
+#include <stdlib.h> // EXIT_FAILURE
+/*==============================================================================
+    MAIN
+==============================================================================*/
+int main(int argc, char ** argv)
+{
+    if(bench_init(argc, argv) != 0) {
+        return EXIT_FAILURE;
+    }
+    BENCH_ctk_alloc();
+    BENCH_ctk_hashmap();
+    BENCH_ctk_log();
+    BENCH_ctk_searcher();
+    BENCH_ctk_strmatch();
+    BENCH_ctk_string();
+    BENCH_ctk_time();
+    return bench_finish();
+}
@@ -31,11 +31,26 @@
  * In order to have a predictable behaviour, wrappers return `NULL` if
  * they are called with a size of `0`.
  *
+ * When the library is built with `ALLOC_CACHE=true`, ctk_malloc(), ctk_calloc()
+ * and ctk_free() keep freed blocks of up to 1 KiB in per-thread caches split in
+ * size classes. Caches exchange blocks with a shared depot in batches, so most
+ * small allocations never take a lock. Blocks remain regular `malloc()` blocks:
+ * they can still be passed to `free()`/`realloc()` and blocks from `malloc()`
+ * can be passed to ctk_free().
+ *
+ * ctk_mmap_alloc(), ctk_mmap_realloc() and ctk_mmap_free() map big blocks, e.g.
+ * lookup tables of hundreds of megabytes, straight from the OS. They can be
+ * backed by transparent huge pages, which cuts TLB misses, and grow without
+ * copying their content on Linux.
+ *
+ * When the library is built with `ALLOC_STATS=true`, every call to the wrappers
+ * is counted in per-thread counters which are read with
+ * ctk_alloc_stats_snapshot() or ctk_alloc_stats_dump(). Counters are only
+ * written by their own thread, without locks nor atomic read-modify-write
+ * instructions. Otherwise the instrumentation isn't compiled at all.
+ *
  * @see
  * @C17{7,22,3}
- *
- * @todo
- * - Add wrapper around `aligned_alloc()`
  */
 /*==============================================================================
     GUARD
@@ -47,6 +62,70 @@
 ==============================================================================*/
 // C Standard Library
 #include <stddef.h> // size_t
+#include <stdint.h> // int64_t, uint64_t
+#include <stdio.h>  // FILE
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Number of buckets of the size histogram of struct ctk_alloc_stats.
+ */
+#define CTK_ALLOC_STATS_BUCKETS 32
+/*==============================================================================
+    ENUM
+==============================================================================*/
+/**
+ * Options of ctk_mmap_alloc(), combined with `|`.
+ */
+enum ctk_mmap_flag {
+    /**
+     * Ask the OS to back the block with transparent huge pages with
+     * `madvise(MADV_HUGEPAGE)`: blocks of at least ctk_huge_page_size() bytes
+     * are mapped at an address aligned on a huge page.
+     */
+    CTK_MMAP_HUGE = 1 << 0,
+    /**
+     * Fault all the pages in at allocation time(`MAP_POPULATE`), and the pages
+     * added by ctk_mmap_realloc(), instead of on first access.
+     */
+    CTK_MMAP_POPULATE = 1 << 1
+};
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Allocation statistics of the whole process.
+ *
+ * - Only the successful calls are counted in #bytes and #histogram.
+ * - Live and peak bytes are counted with the usable size of the blocks, which
+ *   may be bigger than the requested size.
+ */
+struct ctk_alloc_stats {
+    uint64_t malloc_calls;     //!< Number of calls to ctk_malloc().
+    uint64_t calloc_calls;     //!< Number of calls to ctk_calloc().
+    uint64_t aligned_calls;    //!< Number of calls to ctk_aligned_alloc().
+    uint64_t realloc_calls;    //!< Number of calls to ctk_realloc().
+    uint64_t free_calls;       //!< Number of calls to ctk_free().
+    uint64_t failed_calls;     //!< Number of allocations which returned `NULL`.
+    uint64_t bytes;            //!< Total number of bytes requested.
+    /**
+     * Bytes currently allocated, negative if ctk_free() released more blocks
+     * than the wrappers allocated(e.g. blocks from `malloc()`).
+     */
+    int64_t live_bytes;
+    /**
+     * Sum of the highest live bytes of each thread: it is exact for a single
+     * thread and an upper bound of the real peak otherwise.
+     */
+    uint64_t peak_bytes;
+    uint64_t realloc_in_place; //!< Reallocations which didn't move the block.
+    uint64_t realloc_moved;    //!< Reallocations which moved the block.
+    /**
+     * Number of allocations per size: bucket `i` counts the sizes in
+     * `(2^(i - 1), 2^i]`, the last bucket counts all the bigger sizes.
+     */
+    uint64_t histogram[CTK_ALLOC_STATS_BUCKETS];
+};
 /*==============================================================================
     PUBLIC FUNCTION
 ==============================================================================*/
@@ -103,6 +182,41 @@ void * ctk_malloc(size_t size);
  * @C17{7,22,3,2}
  */
 void * ctk_calloc(size_t num, size_t size);
+/*------------------------------------------------------------------------------
+    ctk_aligned_alloc()
+------------------------------------------------------------------------------*/
+/**
+ * Wrapper around `aligned_alloc()` returning `NULL` if \p{size} is `0` or
+ * \p{alignment} isn't a power of two.
+ *
+ * - \p{size} is rounded up to a multiple of \p{alignment}, as required by
+ *   C11 `aligned_alloc()`.
+ * - The memory is released with ctk_free() and can't be resized with
+ *   ctk_realloc() without losing its alignment.
+ * - Blocks aligned on #CTK_CACHE_LINE_SIZE hold types using
+ *   #CTK_CACHE_ALIGNED.
+ *
+ * @param[in] alignment : Alignment of the memory in bytes.
+ * @param[in] size      : Number of bytes to allocate.
+ *
+ * @return
+ * - @success: A pointer to the allocated memory, aligned on \p{alignment}.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{alignment} must be a power of two.
+ * - \p{size} must be > `0`.
+ *
+ * @example{
+ *  int * a = ctk_aligned_alloc(64, sizeof(*a)); // Ok: 64 bytes allocated
+ *  int * b = ctk_aligned_alloc(64, 0);          // Error: b == NULL
+ *  int * c = ctk_aligned_alloc(48, sizeof(*c)); // Error: c == NULL
+ * }
+ *
+ * @see
+ * @C17{7,22,3,1}
+ */
+void * ctk_aligned_alloc(size_t alignment, size_t size);
 /*------------------------------------------------------------------------------
     ctk_realloc()
 ------------------------------------------------------------------------------*/
@@ -220,6 +334,170 @@ void ctk_free(void ** ptr);
  */
 #define ctk_free(ptr) \
     (ctk_free)((void*)(ptr))
+/*------------------------------------------------------------------------------
+    ctk_mmap_alloc()
+------------------------------------------------------------------------------*/
+/**
+ * Maps a zero-initialized block of \p{size} bytes straight from the OS.
+ *
+ * - Meant for big blocks: the mapping is rounded up to whole pages and starts
+ *   with a small header holding its length.
+ * - The block is aligned on #CTK_CACHE_LINE_SIZE.
+ * - Must be released with ctk_mmap_free(), not with ctk_free().
+ * - On platforms without `mmap()`, the block is allocated with
+ *   ctk_aligned_alloc() and \p{flags} are ignored.
+ *
+ * @param[in] size  : Number of bytes to allocate.
+ * @param[in] flags : `0` or values of enum ctk_mmap_flag combined with `|`.
+ *
+ * @return
+ * - @success: A pointer to the allocated memory.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{size} must be > `0`.
+ * - \p{flags} must only contain values of enum ctk_mmap_flag.
+ *
+ * @example{
+ *  // 512 MiB lookup table backed by huge pages
+ *  uint32_t * table = ctk_mmap_alloc(
+ *      (size_t)1 << 29, CTK_MMAP_HUGE | CTK_MMAP_POPULATE
+ *  );
+ *  int * a = ctk_mmap_alloc(0, 0);          // Error: a == NULL
+ *  int * b = ctk_mmap_alloc(sizeof(*b), 8); // Error: b == NULL
+ * }
+ */
+void * ctk_mmap_alloc(size_t size, unsigned int flags);
+/*------------------------------------------------------------------------------
+    ctk_mmap_realloc()
+------------------------------------------------------------------------------*/
+/**
+ * Resizes a block allocated with ctk_mmap_alloc() and sets \p{ptr} to `NULL`
+ * if the reallocation succeeded.
+ *
+ * - On Linux the block is resized with `mremap()`: it grows in place when the
+ *   following addresses are free, otherwise its pages are moved to a new
+ *   address without copying their content.
+ * - Bytes added at the end are zero, the flags given to ctk_mmap_alloc() still
+ *   apply.
+ * - #ctk_mmap_realloc() macro having the same name, this function must be
+ *   enclosed with parenthesis to call it(i.e,
+ *   `(ctk_mmap_realloc)((void*)&ptr, size)`).
+ *
+ * @param[in,out] ptr  : Address of the pointer to the block to reallocate.
+ * @param[in]     size : Number of bytes to allocate.
+ *
+ * @return
+ * - @success: A pointer to the reallocated memory.
+ * - @failure: `NULL`, the block is unchanged.
+ *
+ * @warning
+ * - \p{size} must be > `0`.
+ *
+ * @example{
+ *  char * ptr = ctk_mmap_alloc(1 << 20, CTK_MMAP_HUGE);
+ *  char * a = (ctk_mmap_realloc)((void*)&ptr, 1 << 30); // Ok: ptr == NULL
+ *  char * b = (ctk_mmap_realloc)((void*)&a, 0);  // Error: b == NULL
+ *  char * c = (ctk_mmap_realloc)(NULL, 1 << 20); // Ok: same as
+ *                                                // ctk_mmap_alloc(1 << 20, 0)
+ * }
+ */
+void * ctk_mmap_realloc(void ** ptr, size_t size);
+/**
+ * Macro easing the use of `ctk_mmap_realloc()` by removing the need to cast
+ * \p{ptr} to `(void*)`.
+ *
+ * @param[in,out] ptr  : Address of the pointer to the block to reallocate.
+ * @param[in]     size : Number of bytes to allocate.
+ *
+ * @return
+ * - @success: A pointer to the reallocated memory.
+ * - @failure: `NULL`, the block is unchanged.
+ *
+ * @example{
+ *  char * ptr = ctk_mmap_alloc(1 << 20, CTK_MMAP_HUGE);
+ *  char * a = ctk_mmap_realloc(&ptr, 1 << 30); // Ok: ptr == NULL
+ * }
+ */
+#define ctk_mmap_realloc(ptr, size) \
+    (ctk_mmap_realloc)((void*)(ptr), (size))
+/*------------------------------------------------------------------------------
+    ctk_mmap_free()
+------------------------------------------------------------------------------*/
+/**
+ * Unmaps a block allocated with ctk_mmap_alloc() and sets \p{*ptr} to `NULL`.
+ *
+ * - #ctk_mmap_free() macro having the same name, this function must be
+ *   enclosed with parenthesis to call it(i.e, `(ctk_mmap_free)((void*)&ptr)`).
+ *
+ * @param[in,out] ptr : Address of the pointer to the block to unmap.
+ *
+ * @return Nothing.
+ *
+ * @example{
+ *  (ctk_mmap_free)(NULL);      // Ok
+ *  char * a = ctk_mmap_alloc(1 << 20, 0);
+ *  (ctk_mmap_free)((void*)&a); // Ok: a == NULL
+ * }
+ */
+void ctk_mmap_free(void ** ptr);
+/**
+ * Macro easing the use of `ctk_mmap_free()` by removing the need to cast
+ * \p{ptr} to `(void*)`.
+ *
+ * @param[in,out] ptr : Address of the pointer to the block to unmap.
+ *
+ * @return Nothing.
+ *
+ * @example{
+ *  char * a = ctk_mmap_alloc(1 << 20, 0);
+ *  ctk_mmap_free(&a); // Ok: a == NULL
+ * }
+ */
+#define ctk_mmap_free(ptr) \
+    (ctk_mmap_free)((void*)(ptr))
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_snapshot()
+------------------------------------------------------------------------------*/
+/**
+ * Sums the allocation counters of all threads, including finished ones.
+ *
+ * - Counters of running threads keep changing during the sum, so the snapshot
+ *   isn't atomic as a whole.
+ *
+ * @param[out] stats : Where to store the statistics, zeroed on failure.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1` if \p{stats} is `NULL` or the library was built without
+ *   `ALLOC_STATS=true`.
+ *
+ * @example{
+ *  struct ctk_alloc_stats stats;
+ *  if(ctk_alloc_stats_snapshot(&stats) == 0) {
+ *      printf("%" PRIu64 " moves\n", stats.realloc_moved);
+ *  }
+ * }
+ */
+int ctk_alloc_stats_snapshot(struct ctk_alloc_stats * stats);
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_dump()
+------------------------------------------------------------------------------*/
+/**
+ * Prints a snapshot of the allocation statistics to \p{stream}.
+ *
+ * - Only the non-empty buckets of the size histogram are printed.
+ *
+ * @param[in] stream : The stream to print to.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1` if \p{stream} is `NULL`, the library was built without
+ *   `ALLOC_STATS=true` or printing failed.
+ *
+ * @see ctk_alloc_stats_snapshot()
+ */
+int ctk_alloc_stats_dump(FILE * stream);
 /*==============================================================================
     GUARD
 ==============================================================================*/
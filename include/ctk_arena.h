@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide an arena allocator handing out memory by bumping a pointer.
+ *
+ * @details
+ * - Memory is carved out of chunks allocated with ctk_malloc(): an allocation
+ *   is a pointer increment and most of them never reach the system allocator.
+ * - Objects can't be freed one by one: all the memory of an arena is given back
+ *   at once with ctk_arena_reset() or up to a marker with ctk_arena_restore().
+ *   Chunks are kept to be reused by later allocations.
+ * - ctk_arena_destroy() gives the chunks back to the system allocator.
+ * - An arena isn't thread-safe: use one arena per thread.
+ *
+ * @example{
+ *  struct ctk_arena * arena = ctk_arena_create(CTK_ARENA_CHUNK_SIZE);
+ *  for(;;) {
+ *      struct request * req = ctk_arena_alloc(arena, sizeof(*req));
+ *      // Handle the request, allocating from `arena` as needed
+ *      ctk_arena_reset(arena); // Everything allocated for `req` is gone
+ *  }
+ *  ctk_arena_destroy(&arena);
+ * }
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_ARENA_H_20261018124512
+#define CTK_ARENA_H_20261018124512
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stddef.h> // size_t
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Suggested chunk size for ctk_arena_create().
+ */
+#define CTK_ARENA_CHUNK_SIZE (64 * 1024)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque arena allocator.
+ */
+struct ctk_arena;
+/**
+ * Opaque memory block from which an arena allocates.
+ */
+struct ctk_arena_chunk;
+/**
+ * Position in an arena returned by ctk_arena_save().
+ *
+ * - Members are private: a marker must only be passed to ctk_arena_restore().
+ */
+struct ctk_arena_marker {
+    struct ctk_arena_chunk * chunk; //!< Chunk in use when the marker was saved.
+    size_t used;                    //!< Bytes used in \p{chunk}.
+};
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_arena_create()
+------------------------------------------------------------------------------*/
+/**
+ * Creates an arena.
+ *
+ * - The first chunk is allocated right away.
+ * - Allocations bigger than \p{chunk_size} get a dedicated chunk.
+ *
+ * @param[in] chunk_size : Size in bytes of the chunks.
+ *
+ * @return
+ * - @success: A pointer to the new arena.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{chunk_size} must be > `0`.
+ * - The arena must be destroyed with ctk_arena_destroy().
+ */
+struct ctk_arena * ctk_arena_create(size_t chunk_size);
+/*------------------------------------------------------------------------------
+    ctk_arena_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Destroys an arena and sets \p{*arena} to `NULL`.
+ *
+ * - All chunks are given back with ctk_free(): every pointer allocated from the
+ *   arena becomes invalid.
+ *
+ * @param[in,out] arena : Address of the pointer to the arena to destroy.
+ *
+ * @return Nothing.
+ *
+ * @example{
+ *  ctk_arena_destroy(NULL); // Ok
+ *  struct ctk_arena * arena = NULL;
+ *  ctk_arena_destroy(&arena); // Ok
+ *  arena = ctk_arena_create(CTK_ARENA_CHUNK_SIZE);
+ *  ctk_arena_destroy(&arena); // Ok: arena == NULL
+ * }
+ */
+void ctk_arena_destroy(struct ctk_arena ** arena);
+/*------------------------------------------------------------------------------
+    ctk_arena_alloc()
+------------------------------------------------------------------------------*/
+/**
+ * Allocates memory from an arena.
+ *
+ * - The memory is suitably aligned for any object type, as with `malloc()`.
+ * - A new chunk is allocated only when the current ones are full.
+ *
+ * @param[in,out] arena : The arena to allocate from.
+ * @param[in]     size  : Number of bytes to allocate.
+ *
+ * @return
+ * - @success: A pointer to the allocated memory.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{size} must be > `0`.
+ */
+void * ctk_arena_alloc(struct ctk_arena * arena, size_t size);
+/*------------------------------------------------------------------------------
+    ctk_arena_alloc_aligned()
+------------------------------------------------------------------------------*/
+/**
+ * Allocates memory from an arena with a given alignment.
+ *
+ * @param[in,out] arena     : The arena to allocate from.
+ * @param[in]     size      : Number of bytes to allocate.
+ * @param[in]     alignment : Alignment of the allocated memory.
+ *
+ * @return
+ * - @success: A pointer to the allocated memory, which is a multiple of
+ *   \p{alignment}.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{size} must be > `0`.
+ * - \p{alignment} must be a power of two.
+ *
+ * @example{
+ *  // Cache line aligned
+ *  struct counter * c = ctk_arena_alloc_aligned(arena, sizeof(*c), 64);
+ * }
+ */
+void * ctk_arena_alloc_aligned(
+    struct ctk_arena * arena, size_t size, size_t alignment
+);
+/*------------------------------------------------------------------------------
+    ctk_arena_calloc()
+------------------------------------------------------------------------------*/
+/**
+ * Allocates zero-initialized memory for an array of objects from an arena.
+ *
+ * - Same as ctk_arena_alloc() but the memory is set to zero.
+ *
+ * @param[in,out] arena : The arena to allocate from.
+ * @param[in]     num   : Number of objects to allocate.
+ * @param[in]     size  : Size of an object in bytes.
+ *
+ * @return
+ * - @success: A pointer to the allocated memory.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{num} must be > `0`.
+ * - \p{size} must be > `0`.
+ * - `num * size` must not overflow.
+ */
+void * ctk_arena_calloc(struct ctk_arena * arena, size_t num, size_t size);
+/*------------------------------------------------------------------------------
+    ctk_arena_reset()
+------------------------------------------------------------------------------*/
+/**
+ * Frees all the memory allocated from an arena in `O(1)`.
+ *
+ * - Chunks aren't given back to the system allocator: later allocations reuse
+ *   them.
+ *
+ * @param[in,out] arena : The arena to reset.
+ *
+ * @return Nothing.
+ */
+void ctk_arena_reset(struct ctk_arena * arena);
+/*------------------------------------------------------------------------------
+    ctk_arena_save()
+------------------------------------------------------------------------------*/
+/**
+ * Saves the current position of an arena.
+ *
+ * @param[in] arena : The arena whose position to save.
+ *
+ * @return
+ * - @success: A marker to pass to ctk_arena_restore().
+ * - @failure: A marker with a `NULL` chunk, ignored by ctk_arena_restore().
+ *
+ * @example{
+ *  struct ctk_arena_marker scope = ctk_arena_save(arena);
+ *  char * tmp = ctk_arena_alloc(arena, 4096);
+ *  // ...
+ *  ctk_arena_restore(arena, scope); // `tmp` is freed
+ * }
+ */
+struct ctk_arena_marker ctk_arena_save(const struct ctk_arena * arena);
+/*------------------------------------------------------------------------------
+    ctk_arena_restore()
+------------------------------------------------------------------------------*/
+/**
+ * Frees all the memory allocated from an arena since a marker was saved.
+ *
+ * - Runs in `O(1)`: chunks used after the marker are kept to be reused.
+ * - Markers may be nested: restoring a marker also invalidates the markers
+ *   saved after it.
+ *
+ * @param[in,out] arena  : The arena to restore.
+ * @param[in]     marker : A marker returned by ctk_arena_save() on \p{arena}.
+ *
+ * @return Nothing.
+ *
+ * @warning
+ * - \b [UB] \p{marker} must have been saved on \p{arena} and not have been
+ *           invalidated by ctk_arena_reset() or by restoring an older marker.
+ */
+void ctk_arena_restore(struct ctk_arena * arena, struct ctk_arena_marker marker);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_ARENA_H_20261018124512
@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide locale-independent classification and case mapping of ASCII
+ * characters.
+ *
+ * @details
+ * - A character is classified with a single lookup in #ctk_ascii_table, a
+ *   table of #ctk_ascii_class bitmasks indexed by the value of the byte: no
+ *   call, no branch and, unlike the `<ctype.h>` functions, no access to the
+ *   locale of the thread.
+ * - The classes are those of the `<ctype.h>` functions in the `"C"` locale.
+ *   Bytes greater than `0x7F` belong to no class and are never converted,
+ *   whatever the locale: the results are the same in every deployment.
+ * - The CTK_ASCII_*() macros are meant for tight loops(e.g. tokenizers), the
+ *   functions check their argument.
+ *
+ * @example{
+ *  // Length of the identifier at the beginning of str
+ *  size_t length = 0;
+ *  while(CTK_ASCII_IS(str[length], CTK_ASCII_ALNUM) || str[length] == '_') {
+ *      length++;
+ *  }
+ * }
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_ASCII_H_20261018170512
+#define CTK_ASCII_H_20261018170512
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <limits.h> // UCHAR_MAX
+#include <stdbool.h>
+#include <stddef.h> // size_t
+/*==============================================================================
+    ENUM
+==============================================================================*/
+/**
+ * Classes of a character, the entries of #ctk_ascii_table are combinations of
+ * them.
+ */
+enum ctk_ascii_class {
+    CTK_ASCII_SPACE = 0x01, //!< `' '`, `'\t'`, `'\n'`, `'\v'`, `'\f'`, `'\r'`
+    CTK_ASCII_DIGIT = 0x02, //!< `'0'` to `'9'`.
+    CTK_ASCII_ALPHA = 0x04, //!< `'A'` to `'Z'` and `'a'` to `'z'`.
+    CTK_ASCII_HEX   = 0x08, //!< Digits, `'A'` to `'F'` and `'a'` to `'f'`.
+    CTK_ASCII_PUNCT = 0x10, //!< Graphic characters which aren't alphanumeric.
+    /**
+     * `'A'` to `'Z'`. Its value is the bit which differs between the two
+     * cases of a letter.
+     */
+    CTK_ASCII_UPPER = 0x20,
+    CTK_ASCII_LOWER = 0x40, //!< `'a'` to `'z'`.
+    CTK_ASCII_ALNUM = CTK_ASCII_ALPHA | CTK_ASCII_DIGIT //!< Alphanumeric.
+};
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Checks whether the character \p{c} belongs to one of \p{classes}.
+ *
+ * - \p{c} is converted to `unsigned char`: `char` values can be given
+ *   directly, `EOF` must be checked by the caller.
+ *
+ * @example{
+ *  CTK_ASCII_IS('7', CTK_ASCII_DIGIT | CTK_ASCII_SPACE); // true
+ * }
+ */
+#define CTK_ASCII_IS(c, classes) \
+    ((ctk_ascii_table[(unsigned char)(c)] & (classes)) != 0)
+/**
+ * Converts the character \p{c} to lowercase, as an `int`.
+ *
+ * - Branch-free: the case bit of uppercase letters is set with the
+ *   #CTK_ASCII_UPPER bit of their entry.
+ *
+ * @warning
+ * - \p{c} is evaluated twice.
+ */
+#define CTK_ASCII_TOLOWER(c) \
+    ((unsigned char)(c) \
+        | (ctk_ascii_table[(unsigned char)(c)] & CTK_ASCII_UPPER))
+/**
+ * Converts the character \p{c} to uppercase, as an `int`.
+ *
+ * - Branch-free: the case bit of lowercase letters is cleared with the
+ *   #CTK_ASCII_LOWER bit of their entry.
+ *
+ * @warning
+ * - \p{c} is evaluated twice.
+ */
+#define CTK_ASCII_TOUPPER(c) \
+    ((unsigned char)(c) \
+        ^ ((ctk_ascii_table[(unsigned char)(c)] & CTK_ASCII_LOWER) >> 1))
+/*==============================================================================
+    PUBLIC VARIABLE
+==============================================================================*/
+/**
+ * Classes of each `unsigned char` value, combination of #ctk_ascii_class.
+ */
+extern const unsigned char ctk_ascii_table[UCHAR_MAX + 1];
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_ascii_is()
+------------------------------------------------------------------------------*/
+/**
+ * Checks whether a character belongs to one of the given classes.
+ *
+ * - Same as CTK_ASCII_IS() but \p{c} is checked as by the `<ctype.h>`
+ *   functions.
+ *
+ * @param[in] c       : The character to check.
+ * @param[in] classes : Combination of #ctk_ascii_class.
+ *
+ * @return
+ * - @success: `true` if \p{c} belongs to one of \p{classes}, `false`
+ *   otherwise.
+ * - @failure: `false` if \p{c} isn't representable as an `unsigned char`,
+ *   `EOF` included.
+ *
+ * @example{
+ *  ctk_ascii_is('\t', CTK_ASCII_SPACE); // true
+ *  ctk_ascii_is(0xA0, CTK_ASCII_SPACE); // false, whatever the locale
+ * }
+ */
+bool ctk_ascii_is(int c, int classes);
+/*------------------------------------------------------------------------------
+    ctk_ascii_tolower()
+------------------------------------------------------------------------------*/
+/**
+ * Converts an uppercase ASCII letter to lowercase.
+ *
+ * - Same as `tolower()` in the `"C"` locale, whatever the current locale.
+ *
+ * @param[in] c : The character to convert.
+ *
+ * @return
+ * - @success: The lowercase version of \p{c}.
+ * - @failure: Unmodified \p{c} if it isn't representable as an
+ *   `unsigned char`.
+ */
+int ctk_ascii_tolower(int c);
+/*------------------------------------------------------------------------------
+    ctk_ascii_toupper()
+------------------------------------------------------------------------------*/
+/**
+ * Converts a lowercase ASCII letter to uppercase.
+ *
+ * - Same as `toupper()` in the `"C"` locale, whatever the current locale.
+ *
+ * @param[in] c : The character to convert.
+ *
+ * @return
+ * - @success: The uppercase version of \p{c}.
+ * - @failure: Unmodified \p{c} if it isn't representable as an
+ *   `unsigned char`.
+ */
+int ctk_ascii_toupper(int c);
+/*------------------------------------------------------------------------------
+    ctk_ascii_triml()
+------------------------------------------------------------------------------*/
+/**
+ * Counts the leading whitespaces of an array.
+ *
+ * - Whitespaces are the #CTK_ASCII_SPACE characters.
+ * - Compares 16 bytes at a time with SSE2.
+ * - The array isn't modified and doesn't need to be null-terminated.
+ *
+ * @param[in] str    : The array to scan, may be `NULL` if \p{length} is `0`.
+ * @param[in] length : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: The index of the first non-whitespace character of \p{str}, or
+ *   \p{length} if there is none.
+ * - @failure: `0` if \p{str} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+size_t ctk_ascii_triml(const char * str, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_ascii_trimr()
+------------------------------------------------------------------------------*/
+/**
+ * Computes the length of an array without its trailing whitespaces.
+ *
+ * - Whitespaces are the #CTK_ASCII_SPACE characters.
+ * - Compares 16 bytes at a time with SSE2, from the end of the array.
+ * - The array isn't modified and doesn't need to be null-terminated.
+ *
+ * @param[in] str    : The array to scan, may be `NULL` if \p{length} is `0`.
+ * @param[in] length : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: The number of characters before the trailing whitespaces of
+ *   \p{str}.
+ * - @failure: `0` if \p{str} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+size_t ctk_ascii_trimr(const char * str, size_t length);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_ASCII_H_20261018170512
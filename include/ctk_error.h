@@ -18,6 +18,34 @@
  * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
  * PERFORMANCE OF THIS SOFTWARE.
  * }
+ *
+ * @brief
+ * Argument checks making the calling function return an error value.
+ *
+ * @details
+ * - The error path is marked as unlikely and cold so the compiler lays out the
+ *   function for valid arguments and moves the error path out of the way.
+ * - If `CTK_CHECKS_TRUSTED` is defined(`make CTK_CHECKS=trusted`), the checks
+ *   are compiled down to assumptions: the compiler drops the tests and may
+ *   optimize the function as if the conditions were false.
+ *   Only use it when all callers already validate the arguments: a condition
+ *   which is true is then \b [UB].
+ * - Each check records its failures in a static #ctk_error_site: a failure
+ *   does no I/O and takes no lock, it only increments a counter with a relaxed
+ *   atomic operation. A pointer to every site is put in the
+ *   `ctk_error_site_table` section of the library(GCC/Clang on ELF platforms)
+ *   so ctk_error_sites_dump() can list them all.
+ * - If `CTK_ERROR_RING` is defined(`make ERROR_RING=true`), each failure is
+ *   also recorded, with `errno` and a timestamp, in a ring buffer of the
+ *   failing thread keeping its last #CTK_ERROR_RING_CAPACITY events. The ring
+ *   is read later with ctk_error_ring_drain() or written to a file descriptor
+ *   by ctk_error_ring_dump(), which can be called from a signal handler.
+ *
+ * @example{
+ *   // At exit or from a signal handler of a debug build
+ *   ctk_error_sites_dump(stderr);
+ *   // src/ctk_string.c:116: ctk_strpos(): str == NULL: 3
+ * }
  */
 /*==============================================================================
     GUARD
@@ -28,37 +56,179 @@
     INCLUDE
 ==============================================================================*/
 // C Standard Library
-#include <stdio.h> // EOF, NULL, fprintf()
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t
+#include <stdio.h>  // EOF, FILE, NULL
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Defined if failed checks are counted per call site.
+ *
+ * - Requires a compiler supporting the `section` attribute, an ELF linker
+ *   providing `__start_`/`__stop_` symbols and C11 atomics.
+ * - Not defined when `CTK_CHECKS_TRUSTED` is since there are no checks left.
+ */
+#if defined(__GNUC__) && defined(__ELF__) && !defined(__STDC_NO_ATOMICS__) \
+    && !defined(CTK_CHECKS_TRUSTED)
+    #define CTK_ERROR_SITES 1
+    // C Standard Library
+    #include <stdatomic.h> // atomic_fetch_add_explicit(), memory_order_relaxed
+#endif
+/**
+ * Number of events kept by the error ring of a thread.
+ */
+#define CTK_ERROR_RING_CAPACITY 64
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * A check of a `CTK_ERROR_*` macro and the number of times it failed.
+ */
+struct ctk_error_site {
+    const char * file;     //!< Source file of the check.
+    const char * function; //!< Function containing the check.
+    const char * cond;     //!< The condition of the check, as written.
+    int line;              //!< Line of the check.
+#if defined(CTK_ERROR_SITES)
+    _Atomic uint64_t hits; //!< Number of times the check failed.
+#else
+    uint64_t hits;         //!< Always `0`.
+#endif
+};
+/**
+ * A failure recorded in the error ring of a thread.
+ */
+struct ctk_error_event {
+    const struct ctk_error_site * site; //!< The check which failed.
+    int64_t time_ns; //!< Nanoseconds since Epoch(ctk_time_realtime_ns()).
+    int errnum;      //!< Value of `errno` when the check failed.
+};
 /*==============================================================================
     MACRO
 ==============================================================================*/
+/*------------------------------------------------------------------------------
+    CTK_ERROR_UNLIKELY()
+------------------------------------------------------------------------------*/
+/**
+ * Tell the compiler that \p{cond} is expected to be false.
+ *
+ * @param[in] cond : Condition to be evaluated.
+ *
+ * @return The value of \p{cond} converted to `0` or `1`.
+ */
+#if defined(__GNUC__)
+    #define CTK_ERROR_UNLIKELY(cond) __builtin_expect(!!(cond), 0)
+#else
+    #define CTK_ERROR_UNLIKELY(cond) (!!(cond))
+#endif
+/*------------------------------------------------------------------------------
+    CTK_ERROR_COLD
+------------------------------------------------------------------------------*/
+/**
+ * Mark the path following it as rarely executed.
+ *
+ * - Expands to a label with the `cold` attribute(GCC only), named after the
+ *   line so it can be used several times in a function.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+    #define CTK_ERROR_COLD                                                     \
+        CTK_ERROR_CONCAT(ctk_error_cold_, __LINE__):                           \
+        __attribute__((cold, unused));
+#else
+    #define CTK_ERROR_COLD
+#endif
+#define CTK_ERROR_CONCAT(lhs, rhs) CTK_ERROR_CONCAT_(lhs, rhs)
+#define CTK_ERROR_CONCAT_(lhs, rhs) lhs##rhs
+/*------------------------------------------------------------------------------
+    CTK_ERROR_SITE_HIT()
+------------------------------------------------------------------------------*/
+/**
+ * Count a failure of the check of \p{cond} at the current line.
+ *
+ * - The site is a block scope static object, a pointer to which is added to
+ *   the `ctk_error_site_table` section. Pointers rather than sites are put in
+ *   the section so the compiler can't insert padding between the entries.
+ *
+ * @param[in] cond : String literal of the condition.
+ */
+#if defined(CTK_ERROR_SITES)
+    #define CTK_ERROR_SITE_HIT(cond)                                           \
+        do {                                                                   \
+            static struct ctk_error_site ctk_error_site = {                    \
+                __FILE__, __func__, cond, __LINE__, 0                          \
+            };                                                                 \
+            static struct ctk_error_site * ctk_error_site_entry                \
+                __attribute__((section("ctk_error_site_table"), used))         \
+                = &ctk_error_site;                                             \
+            atomic_fetch_add_explicit(                                         \
+                &ctk_error_site.hits, 1, memory_order_relaxed                  \
+            );                                                                 \
+            CTK_ERROR_RING_PUSH(&ctk_error_site);                              \
+        } while(0)
+#else
+    #define CTK_ERROR_SITE_HIT(cond) do {} while(0)
+#endif
+/*------------------------------------------------------------------------------
+    CTK_ERROR_RING_PUSH()
+------------------------------------------------------------------------------*/
+/**
+ * Record a failure of \p{site} in the error ring of the calling thread if
+ * `CTK_ERROR_RING` is defined.
+ *
+ * @param[in] site : The check which failed.
+ */
+#if defined(CTK_ERROR_RING)
+    #define CTK_ERROR_RING_PUSH(site) ctk_error_ring_push(site)
+#else
+    #define CTK_ERROR_RING_PUSH(site) ((void)0)
+#endif
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_VAL_IF_MSG()
 ------------------------------------------------------------------------------*/
 /**
- * Print \p{msg} to `stderr` and make the calling fuction return \p{retval} if
- * \p{cond} is true.
+ * Count a failure of the call site and make the calling fuction return
+ * \p{retval} if \p{cond} is true.
  *
  * @param[in] cond   : Condition to be evaluated.
  * @param[in] retval : Value to return.
- * @param[in] msg    : Message to print.
+ * @param[in] msg    : Message describing the error.
+ *
+ * - The #ctk_error_site of the call records \p{cond} as written, \p{msg}
+ *   isn't evaluated.
+ * - Compiled down to an assumption that \p{cond} is false if
+ *   `CTK_CHECKS_TRUSTED` is defined.
  *
  * @example{
  *   CTK_ERROR_RET_VAL_IF_MSG(buf == NULL, -1, "foo() failed! buf == NULL");
  * }
  */
 #define CTK_ERROR_RET_VAL_IF_MSG(cond, retval, msg)                            \
-    do {                                                                       \
-        if(cond) {                                                             \
-            /*fprintf(stderr, "%s() failed! %s\n", __func__, msg);*/           \
-            return retval;                                                     \
-        }                                                                      \
-    } while(0)
+    CTK_ERROR_RET_VAL_IF_(cond, retval, #cond)
+// Implementation of the CTK_ERROR_RET_*_IF() macros, which stringify the
+// condition before it is expanded
+#if defined(CTK_CHECKS_TRUSTED) && defined(__GNUC__)
+    #define CTK_ERROR_RET_VAL_IF_(cond, retval, cond_str)                      \
+        do {                                                                   \
+            if(cond) {                                                         \
+                __builtin_unreachable();                                       \
+            }                                                                  \
+        } while(0)
+#else
+    #define CTK_ERROR_RET_VAL_IF_(cond, retval, cond_str)                      \
+        do {                                                                   \
+            if(CTK_ERROR_UNLIKELY(cond)) {                                     \
+                CTK_ERROR_COLD                                                 \
+                CTK_ERROR_SITE_HIT(cond_str);                                  \
+                return retval;                                                 \
+            }                                                                  \
+        } while(0)
+#endif
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_VAL_IF()
 ------------------------------------------------------------------------------*/
 /**
- * Print an error message to `stderr` and make the calling fuction return
+ * Count a failure of the call site and make the calling fuction return
  * \p{retval} if \p{cond} is true.
  *
  * @param[in] cond   : Condition to be evaluated.
@@ -69,12 +239,12 @@
  * }
  */
 #define CTK_ERROR_RET_VAL_IF(cond, retval)                                     \
-    CTK_ERROR_RET_VAL_IF_MSG(cond, retval, #cond)
+    CTK_ERROR_RET_VAL_IF_(cond, retval, #cond)
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_IF()
 ------------------------------------------------------------------------------*/
 /**
- * Print an error message to `stderr` and make the calling fuction return if
+ * Count a failure of the call site and make the calling fuction return if
  * \p{cond} is true.
  *
  * @param[in] cond : Condition to be evaluated.
@@ -84,12 +254,12 @@
  * }
  */
 #define CTK_ERROR_RET_IF(cond)                                                 \
-    CTK_ERROR_RET_VAL_IF(cond, )
+    CTK_ERROR_RET_VAL_IF_(cond, , #cond)
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_NULL_IF()
 ------------------------------------------------------------------------------*/
 /**
- * Print an error message to `stderr` and make the calling fuction return `NULL`
+ * Count a failure of the call site and make the calling fuction return `NULL`
  * if \p{cond} is true.
  *
  * @param[in] cond : Condition to be evaluated.
@@ -99,12 +269,12 @@
  * }
  */
 #define CTK_ERROR_RET_NULL_IF(cond)                                            \
-    CTK_ERROR_RET_VAL_IF(cond, NULL)
+    CTK_ERROR_RET_VAL_IF_(cond, NULL, #cond)
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_0_IF()
 ------------------------------------------------------------------------------*/
 /**
- * Print an error message to `stderr` and make the calling fuction return `0` if
+ * Count a failure of the call site and make the calling fuction return `0` if
  * \p{cond} is true.
  *
  * @param[in] cond : Condition to be evaluated.
@@ -114,12 +284,12 @@
  * }
  */
 #define CTK_ERROR_RET_0_IF(cond)                                               \
-    CTK_ERROR_RET_VAL_IF(cond, 0)
+    CTK_ERROR_RET_VAL_IF_(cond, 0, #cond)
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_EOF_IF()
 ------------------------------------------------------------------------------*/
 /**
- * Print an error message to `stderr` and make the calling fuction return `EOF`
+ * Count a failure of the call site and make the calling fuction return `EOF`
  * if \p{cond} is true.
  *
  * @param[in] cond : Condition to be evaluated.
@@ -129,7 +299,7 @@
  * }
  */
 #define CTK_ERROR_RET_EOF_IF(cond)                                             \
-    CTK_ERROR_RET_VAL_IF(cond, EOF)
+    CTK_ERROR_RET_VAL_IF_(cond, EOF, #cond)
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_FALSE_IF()
 ------------------------------------------------------------------------------*/
@@ -143,7 +313,7 @@
  * }
  */
 #define CTK_ERROR_RET_FALSE_IF(cond)                                           \
-    CTK_ERROR_RET_VAL_IF(cond, false)
+    CTK_ERROR_RET_VAL_IF_(cond, false, #cond)
 /*------------------------------------------------------------------------------
     CTK_ERROR_RET_NEG_1_IF()
 ------------------------------------------------------------------------------*/
@@ -157,7 +327,99 @@
  * }
  */
 #define CTK_ERROR_RET_NEG_1_IF(cond)                                           \
-    CTK_ERROR_RET_VAL_IF(cond, -1)
+    CTK_ERROR_RET_VAL_IF_(cond, -1, #cond)
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_error_sites()
+------------------------------------------------------------------------------*/
+/**
+ * Lists the call sites of the `CTK_ERROR_*` macros in the library.
+ *
+ * - Sites of the macros used outside the library aren't listed.
+ * - The order of the sites is unspecified.
+ *
+ * @param[out] count : Number of sites.
+ *
+ * @return
+ * - @success: An array of \p{count} pointers to the sites, `NULL` if
+ *   \p{count} is `0`(e.g. #CTK_ERROR_SITES isn't defined).
+ * - @failure: `NULL` if \p{count} is `NULL`.
+ */
+struct ctk_error_site * const * ctk_error_sites(size_t * count);
+/*------------------------------------------------------------------------------
+    ctk_error_sites_dump()
+------------------------------------------------------------------------------*/
+/**
+ * Prints the sites which failed at least once with their number of failures.
+ *
+ * - One line per site: `file:line: function(): cond: hits`.
+ *
+ * @param[in] stream : The stream to print to.
+ *
+ * @return
+ * - @success: The number of sites printed.
+ * - @failure: `-1`.
+ */
+int ctk_error_sites_dump(FILE * stream);
+/*------------------------------------------------------------------------------
+    ctk_error_sites_reset()
+------------------------------------------------------------------------------*/
+/**
+ * Sets the number of failures of all the sites to `0`.
+ */
+void ctk_error_sites_reset(void);
+/*------------------------------------------------------------------------------
+    ctk_error_ring_push()
+------------------------------------------------------------------------------*/
+/**
+ * Records a failure of \p{site} in the error ring of the calling thread.
+ *
+ * - Called by the `CTK_ERROR_*` macros, the oldest event is overwritten when
+ *   the ring is full.
+ * - Does no I/O and preserves `errno`.
+ * - Does nothing if the library is built without `CTK_ERROR_RING`.
+ *
+ * @param[in] site : The check which failed.
+ */
+void ctk_error_ring_push(const struct ctk_error_site * site);
+/*------------------------------------------------------------------------------
+    ctk_error_ring_drain()
+------------------------------------------------------------------------------*/
+/**
+ * Moves the oldest events out of the error ring of the calling thread.
+ *
+ * @param[out] events   : Array receiving the events, oldest first.
+ * @param[in]  capacity : Number of elements of \p{events}.
+ *
+ * @return
+ * - @success: The number of events moved(`0` if the library is built without
+ *   `CTK_ERROR_RING`).
+ * - @failure: `0` if \p{events} is `NULL` and \p{capacity} isn't `0`.
+ */
+size_t ctk_error_ring_drain(struct ctk_error_event * events, size_t capacity);
+/*------------------------------------------------------------------------------
+    ctk_error_ring_dump()
+------------------------------------------------------------------------------*/
+/**
+ * Writes the events of the error ring of the calling thread to \p{fd},
+ * oldest first, without removing them.
+ *
+ * - Only uses `write()`: it can be called from a signal handler, e.g. on a
+ *   crash.
+ * - A header line with the number of events and of overwritten events is
+ *   followed by one line per event:
+ *   `time_ns file:line: function(): cond: errno errnum`.
+ *
+ * @param[in] fd : File descriptor to write to.
+ *
+ * @return
+ * - @success: The number of events written.
+ * - @failure: `-1`(e.g. \p{fd} is negative, a write failed or the library is
+ *   built without `CTK_ERROR_RING`).
+ */
+int ctk_error_ring_dump(int fd);
 /*==============================================================================
     GUARD
 ==============================================================================*/
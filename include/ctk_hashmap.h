@@ -0,0 +1,364 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide an open-addressing hash map with SIMD probing of control bytes.
+ *
+ * @details
+ * - Slots are split in groups of #CTK_HASHMAP_GROUP_SIZE. Each slot has a
+ *   control byte holding 7 bits of the hash of its key, or marking it empty. A
+ *   lookup compares the control bytes of a whole group at once(SSE2 or a
+ *   portable SWAR fallback) and only compares the keys of the matching slots.
+ * - Keys of 4 or 8 bytes without a custom comparison are compared as
+ *   integers.
+ * - Groups are probed quadratically. Each group counts the keys which probed
+ *   past it while it was full: a lookup stops at the first group whose count is
+ *   `0`. Removing a key decrements the counts of the groups it probed past and
+ *   marks its slot empty, so there are no tombstones and lookups never slow
+ *   down after many removals.
+ * - Keys and values are copied in the slots. String keys are stored as
+ *   pointers to null-terminated strings which must outlive the map.
+ * - The map grows when it is 7/8 full. Memory is allocated with ctk_malloc()
+ *   or with the functions given by struct ctk_hashmap_config.
+ * - A map isn't thread-safe.
+ *
+ * @example{
+ *  struct ctk_hashmap * ages = ctk_hashmap_create(&(struct ctk_hashmap_config){
+ *      .keys = CTK_HASHMAP_KEYS_STRING,
+ *      .value_size = sizeof(int),
+ *  });
+ *  ctk_hashmap_insert(ages, "alice", &(int){42});
+ *  const int * age = ctk_hashmap_get(ages, "alice"); // *age == 42
+ *  ctk_hashmap_remove(ages, "alice");
+ *  ctk_hashmap_destroy(&ages);
+ * }
+ *
+ * @see
+ * - Abseil, "Swiss Tables Design Notes".
+ * - Bronson N., Shi X., "Open-sourcing F14 for faster, more memory-efficient
+ *   hash tables", 2019.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_HASHMAP_H_20261018180311
+#define CTK_HASHMAP_H_20261018180311
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stdbool.h>
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Number of slots whose control bytes are compared at once.
+ */
+#define CTK_HASHMAP_GROUP_SIZE 16
+/*==============================================================================
+    ENUM
+==============================================================================*/
+/**
+ * Kinds of keys.
+ */
+enum ctk_hashmap_keys {
+    /**
+     * Keys of struct ctk_hashmap_config::key_size bytes, copied in the map and
+     * compared with `memcmp()` by default.
+     */
+    CTK_HASHMAP_KEYS_BYTES,
+    /**
+     * Null-terminated strings, passed as `const char *`. Only the pointer is
+     * stored and the strings are compared with `strcmp()` by default.
+     */
+    CTK_HASHMAP_KEYS_STRING
+};
+/*==============================================================================
+    TYPE
+==============================================================================*/
+/**
+ * Hashes \p{key} with the context \p{ctx} of the map.
+ */
+typedef uint64_t ctk_hashmap_hash_fn(const void * key, void * ctx);
+/**
+ * Returns `true` if the key \p{key} equals the key stored in the map
+ * \p{stored}.
+ */
+typedef bool ctk_hashmap_eq_fn(
+    const void * key, const void * stored, void * ctx
+);
+/**
+ * Allocates \p{size} bytes, as ctk_malloc().
+ */
+typedef void * ctk_hashmap_alloc_fn(size_t size, void * ctx);
+/**
+ * Frees memory returned by the matching ctk_hashmap_alloc_fn.
+ */
+typedef void ctk_hashmap_free_fn(void * ptr, void * ctx);
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque hash map.
+ */
+struct ctk_hashmap;
+/**
+ * Parameters of a hash map, members left to zero take their default value.
+ */
+struct ctk_hashmap_config {
+    enum ctk_hashmap_keys keys; //!< Kind of keys.
+    size_t key_size;   //!< Size of a key in bytes, ignored for string keys.
+    size_t value_size; //!< Size of a value in bytes, `0` for a set.
+    /**
+     * Hash of a key, ctk_hash_n() of its bytes by default(ctk_hash() for
+     * string keys). Set with #eq. All 64 bits should be well mixed: the low
+     * bits select a group and the 7 high bits are kept in the control byte.
+     */
+    ctk_hashmap_hash_fn * hash;
+    ctk_hashmap_eq_fn * eq; //!< Key equality, set with #hash.
+    void * ctx;             //!< Passed to #hash and #eq.
+    /**
+     * Allocates the memory of the map, ctk_malloc() by default. Set with
+     * #free.
+     */
+    ctk_hashmap_alloc_fn * alloc;
+    ctk_hashmap_free_fn * free; //!< Frees the memory of the map.
+    void * alloc_ctx;           //!< Passed to #alloc and #free.
+};
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hashmap_create()
+------------------------------------------------------------------------------*/
+/**
+ * Creates an empty hash map.
+ *
+ * - No slot is allocated until the first insertion or reservation.
+ * - Keys and values are aligned for any type of their size, up to the
+ *   alignment of `max_align_t`.
+ *
+ * @param[in] config : Parameters of the map.
+ *
+ * @return
+ * - @success: A pointer to the new map.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{config} must not be `NULL`.
+ * - \p{config->key_size} must be > `0` for keys of type
+ *   #CTK_HASHMAP_KEYS_BYTES.
+ * - \p{config->hash} and \p{config->eq} must both be set or both be `NULL`,
+ *   as must \p{config->alloc} and \p{config->free}.
+ * - The map must be destroyed with ctk_hashmap_destroy().
+ */
+struct ctk_hashmap * ctk_hashmap_create(
+    const struct ctk_hashmap_config * config
+);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Destroys a hash map and sets \p{*map} to `NULL`.
+ *
+ * - Nothing happens if \p{*map} is `NULL`.
+ * - String keys aren't freed.
+ *
+ * @param[in,out] map : Address of the pointer to the map to destroy.
+ *
+ * @return Nothing.
+ */
+void ctk_hashmap_destroy(struct ctk_hashmap ** map);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_size()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the number of keys of a hash map.
+ *
+ * @param[in] map : The map.
+ *
+ * @return
+ * - @success: The number of keys.
+ * - @failure: `0` if \p{map} is `NULL`.
+ */
+size_t ctk_hashmap_size(const struct ctk_hashmap * map);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_capacity()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the number of keys a hash map can hold before growing.
+ *
+ * @param[in] map : The map.
+ *
+ * @return
+ * - @success: 7/8 of the number of slots.
+ * - @failure: `0` if \p{map} is `NULL`.
+ */
+size_t ctk_hashmap_capacity(const struct ctk_hashmap * map);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_get()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the value of a key.
+ *
+ * @param[in] map : The map to search in.
+ * @param[in] key : Address of the key, or the string for string keys.
+ *
+ * @return
+ * - @success: A pointer to the value of \p{key} in the map, or to the key
+ *   in the map for a set(a `const char **` for string keys). It is valid
+ *   until the next insertion, reservation or rehash.
+ * - @failure: `NULL` if \p{key} isn't in the map.
+ *
+ * @example{
+ *  const int * age = ctk_hashmap_get(ages, "alice");
+ * }
+ */
+void * ctk_hashmap_get(const struct ctk_hashmap * map, const void * key);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_insert()
+------------------------------------------------------------------------------*/
+/**
+ * Inserts a key with its value, or replaces the value of an existing key.
+ *
+ * - \p{value} is copied in the map. If it is `NULL`, the value of a new key is
+ *   zeroed and the value of an existing key is kept.
+ * - The map grows first if it is full, which moves all the keys and values.
+ *
+ * @param[in,out] map   : The map to insert in.
+ * @param[in]     key   : Address of the key, or the string for string keys.
+ * @param[in]     value : Address of the value, may be `NULL`.
+ *
+ * @return
+ * - @success: A pointer to the value of \p{key} in the map, or to the key
+ *   in the map for a set, as ctk_hashmap_get().
+ * - @failure: `NULL` if the map couldn't grow.
+ *
+ * @example{
+ *  int * count = ctk_hashmap_insert(counts, &word_id, NULL);
+ *  (*count)++;
+ * }
+ */
+void * ctk_hashmap_insert(
+    struct ctk_hashmap * map, const void * key, const void * value
+);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_remove()
+------------------------------------------------------------------------------*/
+/**
+ * Removes a key and its value.
+ *
+ * - The other keys don't move.
+ *
+ * @param[in,out] map : The map to remove from.
+ * @param[in]     key : Address of the key, or the string for string keys.
+ *
+ * @return
+ * - @success: `true` if \p{key} was removed.
+ * - @failure: `false` if \p{key} isn't in the map.
+ */
+bool ctk_hashmap_remove(struct ctk_hashmap * map, const void * key);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_clear()
+------------------------------------------------------------------------------*/
+/**
+ * Removes all the keys of a hash map, keeping its memory.
+ *
+ * @param[in,out] map : The map to clear.
+ *
+ * @return Nothing.
+ */
+void ctk_hashmap_clear(struct ctk_hashmap * map);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_reserve()
+------------------------------------------------------------------------------*/
+/**
+ * Grows a hash map so that it holds at least \p{count} keys without growing
+ * again.
+ *
+ * - Never shrinks the map, see ctk_hashmap_rehash().
+ *
+ * @param[in,out] map   : The map to grow.
+ * @param[in]     count : Number of keys.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`.
+ */
+int ctk_hashmap_reserve(struct ctk_hashmap * map, size_t count);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_rehash()
+------------------------------------------------------------------------------*/
+/**
+ * Rebuilds a hash map with the smallest number of slots holding
+ * \p{count} keys, or all its keys if there are more.
+ *
+ * - `ctk_hashmap_rehash(map, 0)` shrinks the map to fit its keys, or frees its
+ *   slots if it is empty.
+ *
+ * @param[in,out] map   : The map to rebuild.
+ * @param[in]     count : Number of keys.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the map is unchanged.
+ */
+int ctk_hashmap_rehash(struct ctk_hashmap * map, size_t count);
+/*------------------------------------------------------------------------------
+    ctk_hashmap_next()
+------------------------------------------------------------------------------*/
+/**
+ * Iterates over the keys of a hash map, in no particular order.
+ *
+ * - \p{*iter} must be `0` to get the first key.
+ * - Removing the key just returned doesn't break the iteration, any other
+ *   change to the map does.
+ *
+ * @param[in]     map   : The map to iterate over.
+ * @param[in,out] iter  : Position of the iteration.
+ * @param[out]    key   : Address of the stored key, or the string for string
+ *                        keys. May be `NULL`.
+ * @param[out]    value : Address of the value, as ctk_hashmap_get(). May be
+ *                        `NULL`.
+ *
+ * @return
+ * - @success: `true` if a key was found.
+ * - @failure: `false` at the end of the map.
+ *
+ * @example{
+ *  size_t iter = 0;
+ *  const void * name;
+ *  void * age;
+ *  while(ctk_hashmap_next(ages, &iter, &name, &age)) {
+ *      printf("%s: %d\n", (const char *)name, *(int *)age);
+ *  }
+ * }
+ */
+bool ctk_hashmap_next(
+    const struct ctk_hashmap * map, size_t * iter,
+    const void ** key, void ** value
+);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_HASHMAP_H_20261018180311
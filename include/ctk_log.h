@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide an asynchronous logger writing timestamped records from a
+ * background thread.
+ *
+ * @details
+ * - Each thread logging to a logger gets its own lock-free single-producer
+ *   single-consumer queue of fixed-size records, so producers never contend
+ *   with each other: together the queues form a multi-producer
+ *   single-consumer queue drained by the writer thread of the logger.
+ * - Records are formatted by the producer, directly in the queue, with an
+ *   ISO 8601 timestamp(ctk_iso8601_time_us()) and the level as prefix.
+ * - The writer gathers the records of all queues in batches of up to
+ *   #CTK_LOG_BATCH records which are written with a single `writev()`.
+ * - When a queue is full, a record is either dropped and counted, or the
+ *   producer waits for the writer, see `enum ctk_log_overflow`.
+ * - The queue of a finished thread is reused by the next thread logging to
+ *   the same logger.
+ * - Only available on POSIX platforms: ctk_log_create() fails otherwise.
+ *
+ * @example{
+ *  struct ctk_log * log = ctk_log_create(&(struct ctk_log_config){
+ *      .fd = STDERR_FILENO,
+ *      .queue_capacity = CTK_LOG_QUEUE_CAPACITY,
+ *      .overflow = CTK_LOG_OVERFLOW_DROP,
+ *      .level = CTK_LOG_INFO,
+ *  });
+ *  ctk_log_write(log, CTK_LOG_INFO, "listening on port %d", 8080);
+ *  // 2026-10-18T05:37:10.123456+0000 INFO listening on port 8080
+ *  ctk_log_destroy(&log); // Writes the pending records
+ * }
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_LOG_H_20261018140512
+#define CTK_LOG_H_20261018140512
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stdarg.h> // va_list
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Size in bytes of a record, prefix and final newline included: longer
+ * messages are truncated.
+ */
+#define CTK_LOG_RECORD_SIZE 256
+/**
+ * Suggested number of records per queue.
+ */
+#define CTK_LOG_QUEUE_CAPACITY 1024
+/**
+ * Maximum number of records written by a single `writev()`.
+ */
+#define CTK_LOG_BATCH 64
+/**
+ * Check the arguments of a function taking a `printf()` format.
+ */
+#if defined(__GNUC__)
+    #define CTK_LOG_FORMAT(format_index, args_index) \
+        __attribute__((__format__(__printf__, format_index, args_index)))
+#else
+    #define CTK_LOG_FORMAT(format_index, args_index)
+#endif
+/*==============================================================================
+    ENUM
+==============================================================================*/
+/**
+ * Severity of a record.
+ */
+enum ctk_log_level {
+    CTK_LOG_DEBUG,   //!< Details for debugging.
+    CTK_LOG_INFO,    //!< Normal operation.
+    CTK_LOG_WARNING, //!< Unexpected but handled condition.
+    CTK_LOG_ERROR    //!< Failed operation.
+};
+/**
+ * What a producer does when its queue is full.
+ */
+enum ctk_log_overflow {
+    CTK_LOG_OVERFLOW_DROP,  //!< Drop the record and count it.
+    CTK_LOG_OVERFLOW_BLOCK  //!< Wait until the writer frees a record.
+};
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque asynchronous logger.
+ */
+struct ctk_log;
+/**
+ * Parameters of a logger.
+ */
+struct ctk_log_config {
+    int fd;                         //!< Where records are written.
+    size_t queue_capacity;          //!< Records per thread, a power of two.
+    enum ctk_log_overflow overflow; //!< Policy when a queue is full.
+    enum ctk_log_level level;       //!< Records below it are discarded.
+};
+/**
+ * Counters of a logger.
+ */
+struct ctk_log_stats {
+    uint64_t records; //!< Records written.
+    uint64_t dropped; //!< Records dropped because their queue was full.
+    uint64_t bytes;   //!< Bytes written.
+    uint64_t writes;  //!< Calls to `writev()`, i.e. batches.
+    uint64_t errors;  //!< Batches lost because `writev()` failed.
+};
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_log_create()
+------------------------------------------------------------------------------*/
+/**
+ * Creates a logger and starts its writer thread.
+ *
+ * - Queues are allocated with ctk_malloc() the first time a thread logs.
+ * - \p{config->fd} isn't closed by ctk_log_destroy().
+ *
+ * @param[in] config : Parameters of the logger.
+ *
+ * @return
+ * - @success: A pointer to the new logger.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{config} must not be `NULL`.
+ * - \p{config->queue_capacity} must be a power of two.
+ * - The logger must be destroyed with ctk_log_destroy().
+ */
+struct ctk_log * ctk_log_create(const struct ctk_log_config * config);
+/*------------------------------------------------------------------------------
+    ctk_log_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Writes the pending records, stops the writer thread, destroys a logger and
+ * sets \p{*log} to `NULL`.
+ *
+ * - Nothing happens if \p{*log} is `NULL`.
+ *
+ * @param[in,out] log : Address of the pointer to the logger to destroy.
+ *
+ * @return Nothing.
+ *
+ * @warning
+ * - \b [UB] No other thread may use the logger during or after the call.
+ */
+void ctk_log_destroy(struct ctk_log ** log);
+/*------------------------------------------------------------------------------
+    ctk_log_write()
+------------------------------------------------------------------------------*/
+/**
+ * Formats a record and queues it for the writer thread.
+ *
+ * - The record is `"<timestamp> <LEVEL> <message>\n"`, truncated to
+ *   #CTK_LOG_RECORD_SIZE bytes.
+ * - Doesn't wait for the record to be written, except when the queue is full
+ *   with #CTK_LOG_OVERFLOW_BLOCK.
+ *
+ * @param[in,out] log    : The logger to write to.
+ * @param[in]     level  : Severity of the record.
+ * @param[in]     format : `printf()` format of the message.
+ * @param[in]     ...    : Arguments of \p{format}.
+ *
+ * @return
+ * - @success: `0`, also if \p{level} is below the level of the logger.
+ * - @failure: `-1`, e.g. the record was dropped.
+ */
+int ctk_log_write(
+    struct ctk_log * log, enum ctk_log_level level, const char * format, ...
+) CTK_LOG_FORMAT(3, 4);
+/*------------------------------------------------------------------------------
+    ctk_log_vwrite()
+------------------------------------------------------------------------------*/
+/**
+ * Same as ctk_log_write() but with a `va_list`.
+ *
+ * @param[in,out] log    : The logger to write to.
+ * @param[in]     level  : Severity of the record.
+ * @param[in]     format : `printf()` format of the message.
+ * @param[in]     args   : Arguments of \p{format}.
+ *
+ * @return
+ * - @success: `0`, also if \p{level} is below the level of the logger.
+ * - @failure: `-1`, e.g. the record was dropped.
+ */
+int ctk_log_vwrite(
+    struct ctk_log * log, enum ctk_log_level level, const char * format,
+    va_list args
+) CTK_LOG_FORMAT(3, 0);
+/*------------------------------------------------------------------------------
+    ctk_log_flush()
+------------------------------------------------------------------------------*/
+/**
+ * Waits until every record queued before the call has been written.
+ *
+ * @param[in,out] log : The logger to flush.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`.
+ */
+int ctk_log_flush(struct ctk_log * log);
+/*------------------------------------------------------------------------------
+    ctk_log_stats_snapshot()
+------------------------------------------------------------------------------*/
+/**
+ * Reads the counters of a logger.
+ *
+ * @param[in]  log   : The logger to read.
+ * @param[out] stats : Where the counters are stored.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`.
+ */
+int ctk_log_stats_snapshot(
+    const struct ctk_log * log, struct ctk_log_stats * stats
+);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_LOG_H_20261018140512
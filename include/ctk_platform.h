@@ -21,7 +21,20 @@
  *
  * @brief
  * Detect various platforms, OSes, compilers, language features, etc. through
- * macros.
+ * macros, and the features of the CPU and memory at runtime.
+ *
+ * @details
+ * - Must be included before any other header since it may define
+ *   `_POSIX_C_SOURCE`.
+ * - ctk_cpu_detect() reports the instruction set extensions usable by the
+ *   running CPU and OS: `cpuid`/`xgetbv` on x86, the `AT_HWCAP` auxiliary
+ *   vector on ARM64 Linux.
+ * - #CTK_DISPATCH() selects the kernel of a function once, according to these
+ *   features: at load time through an `ifunc` where supported(#CTK_IFUNC), on
+ *   first call through a function pointer otherwise.
+ * - The sizes of a cache line and of a page are known both at compile time
+ *   and at runtime. #CTK_CACHE_ALIGNED and #CTK_CACHE_PADDED() lay out data
+ *   written by different threads in different cache lines.
  */
 /*==============================================================================
     GUARD
@@ -41,6 +54,256 @@
         #undef _POSIX_C_SOURCE
     #endif
 #endif
+#if defined(__x86_64__) || defined(__i386__)
+    #define CTK_X86 1
+#elif defined(__aarch64__)
+    #define CTK_ARM64 1
+#endif
+// Built with a sanitizer whose runtime must be initialized before any
+// instrumented code runs
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+    #define CTK_SANITIZE 1
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) \
+        || __has_feature(memory_sanitizer)
+        #define CTK_SANITIZE 1
+    #endif
+#endif
+// GNU indirect functions, resolved by the dynamic linker, unless disabled by
+// defining CTK_NO_IFUNC. Sanitized builds don't use them: their resolvers may
+// run before the sanitizer runtime is initialized.
+#if defined(__GNUC__) && defined(__ELF__) && defined(__linux__) \
+    && (defined(CTK_X86) || defined(CTK_ARM64)) \
+    && !defined(CTK_NO_IFUNC) && !defined(CTK_SANITIZE)
+    #define CTK_IFUNC 1
+#endif
+/**
+ * Defines a function with internal linkage \p{name} forwarding its calls to the
+ * kernel returned by \p{resolver}.
+ *
+ * - \p{resolver} takes no parameters, returns a pointer to a function of the
+ *   same type as \p{name} and is called only once. As an `ifunc` resolver it
+ *   runs while the dynamic linker relocates the object defining \p{name}: it
+ *   may call other libraries(e.g. ctk_cpu_detect()) but not the functions of
+ *   its own object through the PLT.
+ * - With #CTK_IFUNC, \p{name} is an `ifunc`: calls jump straight to the
+ *   kernel. Otherwise the kernel is stored in an atomic pointer on first call,
+ *   which requires `<stdatomic.h>`.
+ * - \p{ret} can't be `void` since the kernel result is returned: kernels
+ *   writing to a buffer may return it, as `memcpy()` does.
+ *
+ * @param ret      : Return type of \p{name}.
+ * @param name     : Name of the function to define.
+ * @param params   : Parenthesized parameter list of \p{name}.
+ * @param args     : Parenthesized names of the parameters.
+ * @param resolver : Name of the resolver.
+ *
+ * @example{
+ *  static char * copy_avx2(char * dest, const char * src, size_t n);
+ *  static char * copy_sse2(char * dest, const char * src, size_t n);
+ *  static char * (* copy_resolve(void))(char *, const char *, size_t)
+ *  {
+ *      return ctk_cpu_detect().avx2 ? copy_avx2 : copy_sse2;
+ *  }
+ *  CTK_DISPATCH(char *, copy,
+ *      (char * dest, const char * src, size_t n), (dest, src, n),
+ *      copy_resolve
+ *  )
+ * }
+ */
+#if defined(CTK_IFUNC)
+    #define CTK_DISPATCH(ret, name, params, args, resolver) \
+        static ret name params __attribute__((ifunc(#resolver)));
+#else
+    #define CTK_DISPATCH(ret, name, params, args, resolver)                    \
+        static ret (* _Atomic ctk_dispatch_##name) params;                     \
+        static ret name params                                                 \
+        {                                                                      \
+            ret (* kernel) params = atomic_load_explicit(                      \
+                &ctk_dispatch_##name, memory_order_relaxed                     \
+            );                                                                 \
+            if(kernel == NULL) {                                               \
+                /* Every thread stores the same value */                       \
+                kernel = resolver();                                           \
+                atomic_store_explicit(                                         \
+                    &ctk_dispatch_##name, kernel, memory_order_relaxed         \
+                );                                                             \
+            }                                                                  \
+            return kernel args;                                                \
+        }
+#endif
+/**
+ * Size in bytes of a cache line of the target, known at compile time.
+ *
+ * - Two objects written by different threads must be at least this far apart
+ *   to avoid false sharing.
+ * - Can be overridden by defining it before including this header, e.g. to
+ *   `128` on x86 whose adjacent-line prefetcher pairs cache lines.
+ * - ctk_cache_line_size() returns the size of the running CPU.
+ */
+#if !defined(CTK_CACHE_LINE_SIZE)
+    #if defined(__powerpc64__) || (defined(__APPLE__) && defined(__aarch64__))
+        #define CTK_CACHE_LINE_SIZE 128
+    #elif defined(__s390x__)
+        #define CTK_CACHE_LINE_SIZE 256
+    #else
+        #define CTK_CACHE_LINE_SIZE 64
+    #endif
+#endif
+/**
+ * Smallest size in bytes of a page of the target, known at compile time.
+ *
+ * - Can be overridden by defining it before including this header.
+ * - ctk_page_size() returns the size used by the running OS.
+ */
+#if !defined(CTK_PAGE_SIZE)
+    #if defined(__APPLE__) && defined(__aarch64__)
+        #define CTK_PAGE_SIZE 16384
+    #else
+        #define CTK_PAGE_SIZE 4096
+    #endif
+#endif
+/**
+ * Rounds \p{size} up to a multiple of \p{align}.
+ *
+ * - Integer constant expression if both arguments are.
+ *
+ * @param size  : The size to round up.
+ * @param align : The alignment(must be > `0`).
+ *
+ * @example{
+ *  CTK_ALIGN_UP(1, 64);  // 64
+ *  CTK_ALIGN_UP(64, 64); // 64
+ *  CTK_ALIGN_UP(65, 64); // 128
+ * }
+ */
+#define CTK_ALIGN_UP(size, align) \
+    (((size) + (align) - 1) / (align) * (align))
+/**
+ * Aligns a variable or a struct member on a cache line.
+ *
+ * - The size of a struct having such a member is a multiple of
+ *   #CTK_CACHE_LINE_SIZE, so the elements of an array of this struct never
+ *   share a cache line.
+ * - Objects allocated dynamically must come from ctk_aligned_alloc() with an
+ *   alignment of #CTK_CACHE_LINE_SIZE: `malloc()` only guarantees the alignment
+ *   of the standard types.
+ *
+ * @example{
+ *  struct queue {
+ *      CTK_CACHE_ALIGNED _Atomic size_t head; // Written by the producer
+ *      CTK_CACHE_ALIGNED _Atomic size_t tail; // Written by the consumer
+ *  };
+ * }
+ */
+#define CTK_CACHE_ALIGNED _Alignas(CTK_CACHE_LINE_SIZE)
+/**
+ * Type holding a \p{type} in the member `value`, aligned and padded to whole
+ * cache lines.
+ *
+ * @param type : The type to pad, which can't be an array type: wrap arrays in
+ *               a struct.
+ *
+ * @example{
+ *  // One counter per thread, without false sharing
+ *  static CTK_CACHE_PADDED(_Atomic uint64_t) counters[THREADS];
+ *  atomic_fetch_add(&counters[id].value, 1);
+ * }
+ */
+#define CTK_CACHE_PADDED(type) \
+    union { CTK_CACHE_ALIGNED type value; }
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Instruction set extensions usable on the running CPU.
+ *
+ * - A member is `true` only if both the CPU and the OS support it(e.g. the OS
+ *   saves the AVX registers on context switches).
+ * - Members of other architectures are `false`.
+ */
+struct ctk_cpu_features {
+    // x86
+    bool sse2;     //!< SSE2.
+    bool sse3;     //!< SSE3.
+    bool ssse3;    //!< Supplemental SSE3.
+    bool sse41;    //!< SSE4.1.
+    bool sse42;    //!< SSE4.2.
+    bool popcnt;   //!< POPCNT.
+    bool avx;      //!< AVX.
+    bool avx2;     //!< AVX2.
+    bool bmi1;     //!< BMI1.
+    bool bmi2;     //!< BMI2.
+    bool avx512f;  //!< AVX-512 Foundation.
+    bool avx512bw; //!< AVX-512 Byte and Word.
+    // ARM64
+    bool neon;     //!< Advanced SIMD.
+    bool crc32;    //!< CRC32 instructions.
+    bool sve;      //!< Scalable Vector Extension.
+};
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_cpu_detect()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the instruction set extensions usable on the running CPU.
+ *
+ * - The CPU is probed once, later calls return the cached result.
+ * - Thread-safe and usable from a #CTK_DISPATCH() resolver.
+ *
+ * @return The features of the CPU, all `false` on unsupported platforms.
+ */
+struct ctk_cpu_features ctk_cpu_detect(void);
+/*------------------------------------------------------------------------------
+    ctk_cache_line_size()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the size in bytes of a data cache line of the running CPU.
+ *
+ * - Read from `sysconf()` or `sysfs` on Linux the first time, later calls
+ *   return the cached result.
+ *
+ * @return
+ * - @success: The size of a cache line.
+ * - @failure: #CTK_CACHE_LINE_SIZE if it can't be queried.
+ */
+size_t ctk_cache_line_size(void);
+/*------------------------------------------------------------------------------
+    ctk_page_size()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the size in bytes of a page of the running OS.
+ *
+ * - Read from `sysconf()` the first time, later calls return the cached
+ *   result.
+ *
+ * @return
+ * - @success: The size of a page.
+ * - @failure: #CTK_PAGE_SIZE if it can't be queried.
+ */
+size_t ctk_page_size(void);
+/*------------------------------------------------------------------------------
+    ctk_huge_page_size()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the size in bytes of a transparent huge page of the running OS.
+ *
+ * - Read from `sysfs` or `/proc/meminfo` on Linux the first time, later calls
+ *   return the cached result.
+ *
+ * @return
+ * - @success: The size of a huge page, e.g. 2 MiB on x86-64.
+ * - @failure: `0` if the OS doesn't support huge pages or it can't be queried.
+ */
+size_t ctk_huge_page_size(void);
 /*==============================================================================
     GUARD
 ==============================================================================*/
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide a pool allocator for objects of a single size.
+ *
+ * @details
+ * - Objects are carved out of slabs allocated with ctk_malloc(), a slab holding
+ *   a fixed number of objects.
+ * - Freed objects are kept in a free list threaded through the objects
+ *   themselves: there is no per-object header and both allocating and freeing
+ *   run in `O(1)`.
+ * - Slabs are only given back to the system allocator by ctk_pool_destroy().
+ * - A pool isn't thread-safe: use one pool per thread.
+ *
+ * @example{
+ *  struct ctk_pool * pool = ctk_pool_create(sizeof(struct conn), 256);
+ *  struct conn * conn = ctk_pool_calloc(pool);
+ *  // ...
+ *  ctk_pool_free(pool, &conn); // conn == NULL
+ *  ctk_pool_destroy(&pool);
+ * }
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_POOL_H_20261018131408
+#define CTK_POOL_H_20261018131408
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stddef.h> // size_t
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque pool allocator.
+ */
+struct ctk_pool;
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_pool_create()
+------------------------------------------------------------------------------*/
+/**
+ * Creates a pool of objects of \p{object_size} bytes.
+ *
+ * - No slab is allocated until the first allocation.
+ * - Objects smaller than a pointer use the size of a pointer.
+ * - Objects are aligned for any type whose size is \p{object_size}, up to the
+ *   alignment of `max_align_t`.
+ *
+ * @param[in] object_size    : Size of an object in bytes.
+ * @param[in] slab_capacity  : Number of objects per slab.
+ *
+ * @return
+ * - @success: A pointer to the new pool.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{object_size} must be > `0`.
+ * - \p{slab_capacity} must be > `0`.
+ * - The pool must be destroyed with ctk_pool_destroy().
+ */
+struct ctk_pool * ctk_pool_create(size_t object_size, size_t slab_capacity);
+/*------------------------------------------------------------------------------
+    ctk_pool_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Destroys a pool and sets \p{*pool} to `NULL`.
+ *
+ * - All slabs are given back with ctk_free() at once: objects still allocated
+ *   don't need to be freed first and become invalid.
+ *
+ * @param[in,out] pool : Address of the pointer to the pool to destroy.
+ *
+ * @return Nothing.
+ */
+void ctk_pool_destroy(struct ctk_pool ** pool);
+/*------------------------------------------------------------------------------
+    ctk_pool_alloc()
+------------------------------------------------------------------------------*/
+/**
+ * Allocates an object from a pool.
+ *
+ * - The most recently freed object is handed out first, while it is likely
+ *   still in cache.
+ *
+ * @param[in,out] pool : The pool to allocate from.
+ *
+ * @return
+ * - @success: A pointer to an uninitialized object.
+ * - @failure: `NULL`.
+ */
+void * ctk_pool_alloc(struct ctk_pool * pool);
+/*------------------------------------------------------------------------------
+    ctk_pool_calloc()
+------------------------------------------------------------------------------*/
+/**
+ * Allocates a zero-initialized object from a pool.
+ *
+ * - Same as ctk_pool_alloc() but the object is set to zero, as with
+ *   ctk_calloc().
+ *
+ * @param[in,out] pool : The pool to allocate from.
+ *
+ * @return
+ * - @success: A pointer to a zero-initialized object.
+ * - @failure: `NULL`.
+ */
+void * ctk_pool_calloc(struct ctk_pool * pool);
+/*------------------------------------------------------------------------------
+    ctk_pool_free()
+------------------------------------------------------------------------------*/
+/**
+ * Gives an object back to its pool and sets \p{*ptr} to `NULL`.
+ *
+ * - Since \p{ptr} is a double pointer, a simple pointer parameter must be
+ *   passed as `(void*)&ptr`. Use #ctk_pool_free() macro to pass parameter as
+ *   `&ptr`.
+ * - #ctk_pool_free() macro having the same name, this function must be
+ *   enclosed with parenthesis to call it(i.e,
+ *   `(ctk_pool_free)(pool, (void*)&ptr)`).
+ * - Nothing happens if \p{*ptr} is `NULL`, as with `free()`.
+ *
+ * @param[in,out] pool : The pool the object was allocated from.
+ * @param[in,out] ptr  : Address of the pointer to the object to free.
+ *
+ * @return Nothing.
+ *
+ * @warning
+ * - \b [UB] \p{*ptr} must have been allocated from \p{pool} and not been freed
+ *           already.
+ */
+void ctk_pool_free(struct ctk_pool * pool, void ** ptr);
+/**
+ * Macro easing the use of `ctk_pool_free()` by removing the need to cast
+ * \p{ptr} to `(void*)`.
+ *
+ * @param[in,out] pool : The pool the object was allocated from.
+ * @param[in,out] ptr  : Address of the pointer to the object to free.
+ *
+ * @return Nothing.
+ */
+#define ctk_pool_free(pool, ptr) \
+    (ctk_pool_free)((pool), (void*)(ptr))
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_POOL_H_20261018131408
@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide a substring search whose needle is preprocessed once.
+ *
+ * @details
+ * - ctk_strpos() and its variants analyse the needle on every call: a
+ *   ctk_searcher does it once for a needle then searched in many haystacks.
+ * - Needles are searched by comparing two of their bytes, the rarest ones in
+ *   typical text, with 16 to 64 windows of the haystack at once(SSE2, AVX2,
+ *   AVX-512 selected at creation). Only the windows where both bytes match
+ *   are compared with the whole needle.
+ * - When too many windows match both bytes but not the needle, the Two-Way
+ *   algorithm finishes the search in linear time whatever the haystack: the
+ *   critical factorization and shift table of needles of 32 bytes or more are
+ *   computed at creation.
+ * - A searcher isn't modified by searches: it can be shared between threads.
+ *
+ * @example{
+ *  struct ctk_searcher * searcher = ctk_searcher_create("ERROR");
+ *  for(size_t i = 0; i < count; i++) {
+ *      if(ctk_searcher_pos_n(searcher, lines[i], lengths[i]) >= 0) {
+ *          // lines[i] contains "ERROR"
+ *      }
+ *  }
+ *  ctk_searcher_destroy(&searcher);
+ * }
+ *
+ * @see
+ * - Muła W., "SIMD-friendly algorithms for substring searching",
+ *   http://0x80.pl/articles/simd-strfind.html
+ * - Crochemore M., Perrin D., "Two-way string-matching", Journal of the ACM
+ *   38(3):651-675, 1991.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_SEARCHER_H_20261018184215
+#define CTK_SEARCHER_H_20261018184215
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stddef.h> // ptrdiff_t, size_t
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque preprocessed needle.
+ */
+struct ctk_searcher;
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_searcher_create()
+------------------------------------------------------------------------------*/
+/**
+ * Preprocesses a string to search for.
+ *
+ * - The needle is copied: it can be freed once the searcher is created.
+ *
+ * @param[in] needle : The string to search for.
+ *
+ * @return
+ * - @success: A pointer to the new searcher.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{needle} must not be empty.
+ * - \b [UB] \p{needle} must be a pointer to a null-terminated string.
+ * - The searcher must be destroyed with ctk_searcher_destroy().
+ */
+struct ctk_searcher * ctk_searcher_create(const char * needle);
+/*------------------------------------------------------------------------------
+    ctk_searcher_create_n()
+------------------------------------------------------------------------------*/
+/**
+ * Preprocesses an array to search for.
+ *
+ * - Same as ctk_searcher_create() but the needle isn't scanned for a
+ *   terminating null character: a null character within \p{length} is
+ *   searched like any other character.
+ *
+ * @param[in] needle : The array to search for.
+ * @param[in] length : Number of characters in \p{needle}.
+ *
+ * @return
+ * - @success: A pointer to the new searcher.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{length} must be > `0`.
+ * - \b [UB] The size of the array pointed by \p{needle} must be equal or
+ *           greater than \p{length}.
+ * - The searcher must be destroyed with ctk_searcher_destroy().
+ */
+struct ctk_searcher * ctk_searcher_create_n(const char * needle, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_searcher_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Destroys a searcher and sets \p{*searcher} to `NULL`.
+ *
+ * - Nothing happens if \p{*searcher} is `NULL`.
+ *
+ * @param[in,out] searcher : Address of the pointer to the searcher to
+ *                           destroy.
+ *
+ * @return Nothing.
+ */
+void ctk_searcher_destroy(struct ctk_searcher ** searcher);
+/*------------------------------------------------------------------------------
+    ctk_searcher_count()
+------------------------------------------------------------------------------*/
+/**
+ * Counts the occurrences of the needle of a searcher in a string.
+ *
+ * - Occurrences don't overlap: the search resumes after each one, e.g. "aa"
+ *   occurs twice in "aaaaa".
+ *
+ * @param[in] searcher : The searcher.
+ * @param[in] str      : The string to search in.
+ *
+ * @return
+ * - @success: The number of occurrences.
+ * - @failure: `0`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+size_t ctk_searcher_count(
+    const struct ctk_searcher * searcher, const char * str
+);
+/*------------------------------------------------------------------------------
+    ctk_searcher_count_n()
+------------------------------------------------------------------------------*/
+/**
+ * Counts the occurrences of the needle of a searcher in an array.
+ *
+ * - Same as ctk_searcher_count() but \p{str} isn't scanned for a terminating
+ *   null character.
+ *
+ * @param[in] searcher : The searcher.
+ * @param[in] str      : The array to search in, may be `NULL` if \p{length}
+ *                       is `0`.
+ * @param[in] length   : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: The number of occurrences.
+ * - @failure: `0`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+size_t ctk_searcher_count_n(
+    const struct ctk_searcher * searcher, const char * str, size_t length
+);
+/*------------------------------------------------------------------------------
+    ctk_searcher_pos()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first position of the needle of a searcher in a string.
+ *
+ * - Same result as ctk_strpos() with the needle of \p{searcher}.
+ *
+ * @param[in] searcher : The searcher.
+ * @param[in] str      : The string to search in.
+ *
+ * @return
+ * - @success: The position in \p{str} of the first character of the needle.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+ptrdiff_t ctk_searcher_pos(
+    const struct ctk_searcher * searcher, const char * str
+);
+/*------------------------------------------------------------------------------
+    ctk_searcher_pos_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first position of the needle of a searcher in an array.
+ *
+ * - Same result as ctk_strpos_n() with the needle of \p{searcher}.
+ *
+ * @param[in] searcher : The searcher.
+ * @param[in] str      : The array to search in, may be `NULL` if \p{length}
+ *                       is `0`.
+ * @param[in] length   : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: The position in \p{str} of the first character of the needle.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+ptrdiff_t ctk_searcher_pos_n(
+    const struct ctk_searcher * searcher, const char * str, size_t length
+);
+/*------------------------------------------------------------------------------
+    ctk_searcher_rpos()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last position of the needle of a searcher in a string.
+ *
+ * - Same result as ctk_strrpos() with the needle of \p{searcher}.
+ *
+ * @param[in] searcher : The searcher.
+ * @param[in] str      : The string to search in.
+ *
+ * @return
+ * - @success: The position in \p{str} of the first character of the needle.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+ptrdiff_t ctk_searcher_rpos(
+    const struct ctk_searcher * searcher, const char * str
+);
+/*------------------------------------------------------------------------------
+    ctk_searcher_rpos_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last position of the needle of a searcher in an array.
+ *
+ * - Same result as ctk_strrpos_n() with the needle of \p{searcher}.
+ *
+ * @param[in] searcher : The searcher.
+ * @param[in] str      : The array to search in, may be `NULL` if \p{length}
+ *                       is `0`.
+ * @param[in] length   : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: The position in \p{str} of the first character of the needle.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+ptrdiff_t ctk_searcher_rpos_n(
+    const struct ctk_searcher * searcher, const char * str, size_t length
+);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_SEARCHER_H_20261018184215
@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide a growable, null-terminated buffer of characters to build strings.
+ *
+ * @details
+ * - The capacity of a buffer grows geometrically with ctk_realloc(): building
+ *   a string of `n` characters one append at a time costs `O(n)` copies
+ *   instead of the `O(n^2)` of reallocating on every append.
+ * - The content is always null-terminated, but null characters appended with
+ *   ctk_strbuf_append_n() are ordinary characters: use ctk_strbuf_length()
+ *   rather than `strlen()` on such content.
+ * - A failed append leaves the buffer unchanged.
+ * - ctk_strbuf_steal() hands the content off to the caller without a copy.
+ *
+ * @example{
+ *  struct ctk_strbuf * buf = ctk_strbuf_create(0);
+ *  ctk_strbuf_append(buf, "id=");
+ *  ctk_strbuf_append_int(buf, -42);
+ *  ctk_strbuf_append_char(buf, ';');
+ *  char * str = ctk_strbuf_steal(buf, NULL); // str == "id=-42;"
+ *  ctk_strbuf_destroy(&buf);
+ *  // ...
+ *  ctk_free(&str);
+ * }
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_STRBUF_H_20261018150312
+#define CTK_STRBUF_H_20261018150312
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stddef.h> // size_t
+#include <stdint.h> // intmax_t, uintmax_t
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque growable buffer of characters.
+ */
+struct ctk_strbuf;
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strbuf_create()
+------------------------------------------------------------------------------*/
+/**
+ * Creates an empty buffer able to hold \p{capacity} characters without
+ * growing.
+ *
+ * - Nothing but the buffer itself is allocated if \p{capacity} is `0`.
+ *
+ * @param[in] capacity : Number of characters to reserve, the terminating null
+ *                       character excluded.
+ *
+ * @return
+ * - @success: A pointer to the new buffer.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - The buffer must be destroyed with ctk_strbuf_destroy().
+ */
+struct ctk_strbuf * ctk_strbuf_create(size_t capacity);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Destroys a buffer and its content and sets \p{*buf} to `NULL`.
+ *
+ * @param[in,out] buf : Address of the pointer to the buffer to destroy.
+ *
+ * @return Nothing.
+ */
+void ctk_strbuf_destroy(struct ctk_strbuf ** buf);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_data()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the null-terminated content of a buffer.
+ *
+ * @param[in] buf : The buffer.
+ *
+ * @return
+ * - @success: A pointer to the content, valid until the next call modifying
+ *   \p{buf}.
+ * - @failure: `NULL`.
+ */
+const char * ctk_strbuf_data(const struct ctk_strbuf * buf);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_length()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the number of characters of a buffer.
+ *
+ * @param[in] buf : The buffer.
+ *
+ * @return
+ * - @success: The length of the content, the terminating null character
+ *   excluded.
+ * - @failure: `0`.
+ */
+size_t ctk_strbuf_length(const struct ctk_strbuf * buf);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_capacity()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the number of characters a buffer can hold without growing.
+ *
+ * @param[in] buf : The buffer.
+ *
+ * @return
+ * - @success: The capacity, the terminating null character excluded.
+ * - @failure: `0`.
+ */
+size_t ctk_strbuf_capacity(const struct ctk_strbuf * buf);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_reserve()
+------------------------------------------------------------------------------*/
+/**
+ * Makes sure \p{additional} characters can be appended to a buffer without
+ * growing.
+ *
+ * - Growth is geometric: the capacity at least doubles.
+ *
+ * @param[in,out] buf        : The buffer.
+ * @param[in]     additional : Number of characters to make room for.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`.
+ */
+int ctk_strbuf_reserve(struct ctk_strbuf * buf, size_t additional);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_shrink()
+------------------------------------------------------------------------------*/
+/**
+ * Reduces the capacity of a buffer to its length.
+ *
+ * @param[in,out] buf : The buffer.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the buffer is unchanged.
+ */
+int ctk_strbuf_shrink(struct ctk_strbuf * buf);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_clear()
+------------------------------------------------------------------------------*/
+/**
+ * Empties a buffer, keeping its capacity for reuse.
+ *
+ * @param[in,out] buf : The buffer.
+ *
+ * @return Nothing.
+ */
+void ctk_strbuf_clear(struct ctk_strbuf * buf);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append()
+------------------------------------------------------------------------------*/
+/**
+ * Appends a null-terminated string to a buffer.
+ *
+ * @param[in,out] buf : The buffer.
+ * @param[in]     str : The string to append.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the buffer is unchanged.
+ *
+ * @warning
+ * - \b [UB] \p{str} must not point into the content of \p{buf}.
+ */
+int ctk_strbuf_append(struct ctk_strbuf * buf, const char * str);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_n()
+------------------------------------------------------------------------------*/
+/**
+ * Appends \p{length} characters to a buffer.
+ *
+ * - \p{bytes} doesn't need to be null-terminated and may contain null
+ *   characters.
+ *
+ * @param[in,out] buf    : The buffer.
+ * @param[in]     bytes  : The characters to append.
+ * @param[in]     length : Number of characters to append.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the buffer is unchanged.
+ *
+ * @warning
+ * - \p{bytes} can only be `NULL` if \p{length} is `0`.
+ * - \b [UB] \p{bytes} must not point into the content of \p{buf}.
+ */
+int ctk_strbuf_append_n(
+    struct ctk_strbuf * buf, const char * bytes, size_t length
+);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_char()
+------------------------------------------------------------------------------*/
+/**
+ * Appends a single character to a buffer.
+ *
+ * @param[in,out] buf : The buffer.
+ * @param[in]     c   : The character to append.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the buffer is unchanged.
+ */
+int ctk_strbuf_append_char(struct ctk_strbuf * buf, char c);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_int()
+------------------------------------------------------------------------------*/
+/**
+ * Appends the decimal representation of a signed integer to a buffer.
+ *
+ * - Same output as `printf("%jd", value)` but locale-independent and without
+ *   parsing a format.
+ *
+ * @param[in,out] buf   : The buffer.
+ * @param[in]     value : The integer to append.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the buffer is unchanged.
+ */
+int ctk_strbuf_append_int(struct ctk_strbuf * buf, intmax_t value);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_uint()
+------------------------------------------------------------------------------*/
+/**
+ * Appends the decimal representation of an unsigned integer to a buffer.
+ *
+ * - Same output as `printf("%ju", value)`.
+ *
+ * @param[in,out] buf   : The buffer.
+ * @param[in]     value : The integer to append.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1`, the buffer is unchanged.
+ */
+int ctk_strbuf_append_uint(struct ctk_strbuf * buf, uintmax_t value);
+/*------------------------------------------------------------------------------
+    ctk_strbuf_steal()
+------------------------------------------------------------------------------*/
+/**
+ * Hands the content of a buffer off to the caller without copying it.
+ *
+ * - The buffer is left empty, without capacity, and can be reused.
+ *
+ * @param[in,out] buf    : The buffer.
+ * @param[out]    length : If not `NULL`, where to store the length of the
+ *                         content.
+ *
+ * @return
+ * - @success: A pointer to the null-terminated content, to be freed with
+ *   ctk_free().
+ * - @failure: `NULL`, the buffer is unchanged.
+ *
+ * @example{
+ *  struct ctk_strbuf * buf = ctk_strbuf_create(0);
+ *  ctk_strbuf_append(buf, "abc");
+ *  size_t length = 0;
+ *  char * str = ctk_strbuf_steal(buf, &length); // str == "abc", length == 3
+ *  ctk_strbuf_length(buf);                      // 0
+ *  ctk_free(&str);
+ *  ctk_strbuf_destroy(&buf);
+ * }
+ */
+char * ctk_strbuf_steal(struct ctk_strbuf * buf, size_t * length);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_STRBUF_H_20261018150312
@@ -31,7 +31,9 @@
     INCLUDE
 ==============================================================================*/
 // C Standard Library
+#include <stdbool.h>
 #include <stddef.h> // ptrdiff_t, size_t
+#include <stdint.h> // uint64_t
 /*==============================================================================
     DEFINE
 ==============================================================================*/
@@ -48,9 +50,176 @@
  *   should be good enough.
  */
 #define CTK_STRING_ERR_LENGTH 1024
+/**
+ * Number of bytes a struct ctk_hash_state keeps before hashing them.
+ */
+#define CTK_HASH_BUFFER_SIZE 256
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * State of an incremental hash, see ctk_hash_init().
+ *
+ * - Its members are private: only use it through the ctk_hash_*() functions.
+ */
+struct ctk_hash_state {
+    uint64_t acc[4];   //!< Accumulators of the bulk loop.
+    uint64_t seed;     //!< Seed given to ctk_hash_init().
+    uint64_t length;   //!< Number of bytes hashed so far.
+    size_t stripe;     //!< Index of the next stripe in its block.
+    size_t buffered;   //!< Number of bytes in #buffer.
+    unsigned char buffer[CTK_HASH_BUFFER_SIZE]; //!< Bytes not hashed yet.
+};
 /*==============================================================================
     PUBLIC FUNCTION
 ==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hash()
+------------------------------------------------------------------------------*/
+/**
+ * Computes a 64-bit hash of a string.
+ *
+ * - Same as ctk_hash_n(str, strlen(str)).
+ * - The hash is fast and well distributed but not cryptographic: use
+ *   ctk_hash_seeded() with a secret seed when keys come from untrusted input.
+ * - The value only depends on the bytes and the seed, on every platform, but
+ *   may change between major versions of ctk.
+ *
+ * @param[in] str : The string to hash.
+ *
+ * @return
+ * - @success: The hash of \p{str}.
+ * - @failure: `0` if \p{str} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+uint64_t ctk_hash(const char * str);
+/*------------------------------------------------------------------------------
+    ctk_hash_final()
+------------------------------------------------------------------------------*/
+/**
+ * Computes the hash of all the bytes given to ctk_hash_update().
+ *
+ * - Doesn't modify the state: more bytes can be added afterwards.
+ *
+ * @param[in] state : The state of the hash.
+ *
+ * @return
+ * - @success: The same value as ctk_hash_seeded_n() for the concatenation of
+ *   the bytes and the seed given to ctk_hash_init().
+ * - @failure: `0` if \p{state} is `NULL`.
+ */
+uint64_t ctk_hash_final(const struct ctk_hash_state * state);
+/*------------------------------------------------------------------------------
+    ctk_hash_init()
+------------------------------------------------------------------------------*/
+/**
+ * Starts an incremental hash, for input which comes in chunks.
+ *
+ * @param[out] state : The state to initialize.
+ * @param[in]  seed  : Seed of the hash, `0` for the value of ctk_hash_n().
+ *
+ * @return Nothing.
+ *
+ * @example{
+ *  struct ctk_hash_state state;
+ *  ctk_hash_init(&state, 0);
+ *  while((length = read(fd, chunk, sizeof(chunk))) > 0) {
+ *      ctk_hash_update(&state, chunk, (size_t)length);
+ *  }
+ *  uint64_t hash = ctk_hash_final(&state);
+ * }
+ */
+void ctk_hash_init(struct ctk_hash_state * state, uint64_t seed);
+/*------------------------------------------------------------------------------
+    ctk_hash_n()
+------------------------------------------------------------------------------*/
+/**
+ * Computes a 64-bit hash of an array of bytes.
+ *
+ * - Same as ctk_hash_seeded_n(data, length, 0).
+ * - Null characters are hashed as any other byte, \p{data} doesn't need to be
+ *   null-terminated.
+ *
+ * @param[in] data   : The array to hash, may be `NULL` if \p{length} is `0`.
+ * @param[in] length : Number of bytes to hash.
+ *
+ * @return
+ * - @success: The hash of \p{data}.
+ * - @failure: `0` if \p{data} is `NULL` and \p{length} isn't `0`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{data} must be equal or
+ *           greater than \p{length}.
+ */
+uint64_t ctk_hash_n(const void * data, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_hash_seeded()
+------------------------------------------------------------------------------*/
+/**
+ * Computes a 64-bit hash of a string with a seed.
+ *
+ * - Same as ctk_hash_seeded_n(str, strlen(str), seed).
+ *
+ * @param[in] str  : The string to hash.
+ * @param[in] seed : Seed of the hash.
+ *
+ * @return
+ * - @success: The hash of \p{str}.
+ * - @failure: `0` if \p{str} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+uint64_t ctk_hash_seeded(const char * str, uint64_t seed);
+/*------------------------------------------------------------------------------
+    ctk_hash_seeded_n()
+------------------------------------------------------------------------------*/
+/**
+ * Computes a 64-bit hash of an array of bytes with a seed.
+ *
+ * - Every output bit depends on every bit of the seed: with a random seed
+ *   kept secret, an attacker can't choose keys which collide(hash flooding).
+ * - Inputs of up to 16 bytes are hashed with a single 128-bit multiplication,
+ *   up to 128 bytes with independent 16-byte multiplications and longer ones
+ *   with a loop over 32-byte stripes, vectorized with SSE2 or AVX2 on x86.
+ *
+ * @param[in] data   : The array to hash, may be `NULL` if \p{length} is `0`.
+ * @param[in] length : Number of bytes to hash.
+ * @param[in] seed   : Seed of the hash.
+ *
+ * @return
+ * - @success: The hash of \p{data}.
+ * - @failure: `0` if \p{data} is `NULL` and \p{length} isn't `0`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{data} must be equal or
+ *           greater than \p{length}.
+ */
+uint64_t ctk_hash_seeded_n(const void * data, size_t length, uint64_t seed);
+/*------------------------------------------------------------------------------
+    ctk_hash_update()
+------------------------------------------------------------------------------*/
+/**
+ * Adds bytes to an incremental hash.
+ *
+ * - The bytes are copied in \p{state} until they fill #CTK_HASH_BUFFER_SIZE
+ *   bytes, longer chunks are hashed in place.
+ *
+ * @param[in,out] state  : The state of the hash.
+ * @param[in]     data   : The bytes to add, may be `NULL` if \p{length} is
+ *                         `0`.
+ * @param[in]     length : Number of bytes to add.
+ *
+ * @return
+ * - @success: `0`.
+ * - @failure: `-1` if \p{state} is `NULL`, or \p{data} is `NULL` and
+ *   \p{length} isn't `0`.
+ */
+int ctk_hash_update(
+    struct ctk_hash_state * state, const void * data, size_t length
+);
 /*------------------------------------------------------------------------------
     ctk_stpcpy()
 ------------------------------------------------------------------------------*/
@@ -107,6 +276,228 @@ char * ctk_stpcpy(char * restrict dest, const char * restrict src);
  *           than \p{cnt} if the array isn't a null-terminated string.
  */
 char * ctk_stpncpy(char * restrict dest, const char * restrict src, size_t cnt);
+/*------------------------------------------------------------------------------
+    ctk_strcaseeq()
+------------------------------------------------------------------------------*/
+/**
+ * Checks whether two strings are equal, ignoring the case of ASCII letters.
+ *
+ * - Only the 26 ASCII letters are folded, whatever the current locale: bytes
+ *   >= `0x80` must be equal.
+ * - Compares character by character and stops at the first difference.
+ *
+ * @param[in] lhs : The first string to compare.
+ * @param[in] rhs : The second string to compare.
+ *
+ * @return
+ * - @success: `true` if the strings are equal, `false` otherwise.
+ * - @failure: `false` if \p{lhs} or \p{rhs} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] \p{lhs} must be a pointer to a null-terminated string.
+ * - \b [UB] \p{rhs} must be a pointer to a null-terminated string.
+ *
+ * @example{
+ *  ctk_strcaseeq("Content-Length", "content-length"); // true
+ * }
+ */
+bool ctk_strcaseeq(const char * lhs, const char * rhs);
+/*------------------------------------------------------------------------------
+    ctk_strcaseeq_n()
+------------------------------------------------------------------------------*/
+/**
+ * Checks whether two arrays are equal, ignoring the case of ASCII letters,
+ * when their length is already known.
+ *
+ * - Same as ctk_strcaseeq() but neither array needs to be null-terminated and
+ *   a null character is compared like any other character.
+ * - Arrays of different lengths are never equal, otherwise both are folded to
+ *   lower case in registers and compared 16 bytes at a time with SSE2.
+ *
+ * @param[in] lhs     : The first array to compare.
+ * @param[in] lhs_len : Number of characters in \p{lhs}.
+ * @param[in] rhs     : The second array to compare.
+ * @param[in] rhs_len : Number of characters in \p{rhs}.
+ *
+ * @return
+ * - @success: `true` if the arrays are equal, `false` otherwise.
+ * - @failure: `false` if \p{lhs} or \p{rhs} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{lhs} must be equal or greater
+ *           than \p{lhs_len}.
+ * - \b [UB] The size of the array pointed by \p{rhs} must be equal or greater
+ *           than \p{rhs_len}.
+ */
+bool ctk_strcaseeq_n(
+    const char * lhs, size_t lhs_len, const char * rhs, size_t rhs_len
+);
+/*------------------------------------------------------------------------------
+    ctk_strcasepos()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first position of \p{substr} in \p{str}, ignoring the case of
+ * ASCII letters.
+ *
+ * - Same as ctk_strpos() otherwise.
+ *
+ * @param[in] str    : The string to search in.
+ * @param[in] substr : The string to search for.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{str} of the first character from \p{substr}.
+ *   - '0' if \p{substr} is an empty string.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ * - \b [UB] \p{substr} must be a pointer to a null-terminated string.
+ */
+ptrdiff_t ctk_strcasepos(const char * str, const char * substr);
+/*------------------------------------------------------------------------------
+    ctk_strcasepos_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first position of \p{substr} in \p{str}, ignoring the case of
+ * ASCII letters, when the length of both strings is already known.
+ *
+ * - Same as ctk_strpos_n() otherwise.
+ * - Neither string is copied: 16 windows at a time are filtered with SSE2 on
+ *   their first and last characters folded to lower case, and only the
+ *   candidates are compared. The search switches to the Two-Way algorithm
+ *   when too many candidates fail, which keeps it linear.
+ *
+ * @param[in] str        : The array to search in.
+ * @param[in] length     : Number of characters in \p{str}.
+ * @param[in] substr     : The array to search for.
+ * @param[in] substr_len : Number of characters in \p{substr}.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{str} of the first character from \p{substr}.
+ *   - '0' if \p{substr_len} is `0`.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The size of the array pointed by \p{substr} must be equal or
+ *           greater than \p{substr_len}.
+ */
+ptrdiff_t ctk_strcasepos_n(
+    const char * str, size_t length, const char * substr, size_t substr_len
+);
+/*------------------------------------------------------------------------------
+    ctk_strcaseprefix()
+------------------------------------------------------------------------------*/
+/**
+ * Checks whether \p{str} starts with \p{prefix}, ignoring the case of ASCII
+ * letters.
+ *
+ * - Compares character by character and stops at the first difference, the
+ *   rest of \p{str} isn't read.
+ *
+ * @param[in] str    : The string to check.
+ * @param[in] prefix : The string to look for.
+ *
+ * @return
+ * - @success: `true` if \p{str} starts with \p{prefix}(always the case for an
+ *   empty \p{prefix}), `false` otherwise.
+ * - @failure: `false` if \p{str} or \p{prefix} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ * - \b [UB] \p{prefix} must be a pointer to a null-terminated string.
+ *
+ * @example{
+ *  ctk_strcaseprefix("HOST: example.org", "host:"); // true
+ * }
+ */
+bool ctk_strcaseprefix(const char * str, const char * prefix);
+/*------------------------------------------------------------------------------
+    ctk_strcaseprefix_n()
+------------------------------------------------------------------------------*/
+/**
+ * Checks whether \p{str} starts with \p{prefix}, ignoring the case of ASCII
+ * letters, when the length of both strings is already known.
+ *
+ * - Same as ctk_strcaseprefix() but neither array needs to be null-terminated
+ *   and a null character is compared like any other character.
+ * - Same comparison as ctk_strcaseeq_n() on the first \p{prefix_len}
+ *   characters of \p{str}.
+ *
+ * @param[in] str        : The array to check.
+ * @param[in] length     : Number of characters in \p{str}.
+ * @param[in] prefix     : The array to look for.
+ * @param[in] prefix_len : Number of characters in \p{prefix}.
+ *
+ * @return
+ * - @success: `true` if \p{str} starts with \p{prefix}, `false` otherwise.
+ * - @failure: `false` if \p{str} or \p{prefix} is `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The size of the array pointed by \p{prefix} must be equal or
+ *           greater than \p{prefix_len}.
+ */
+bool ctk_strcaseprefix_n(
+    const char * str, size_t length, const char * prefix, size_t prefix_len
+);
+/*------------------------------------------------------------------------------
+    ctk_strcaserpos()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last position of \p{substr} in \p{str}, ignoring the case of
+ * ASCII letters.
+ *
+ * - Same as ctk_strrpos() otherwise.
+ *
+ * @param[in] str    : The string to search in.
+ * @param[in] substr : The string to search for.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{str} of the first character from \p{substr}.
+ *   - '0' if \p{substr} is an empty string.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ * - \b [UB] \p{substr} must be a pointer to a null-terminated string.
+ */
+ptrdiff_t ctk_strcaserpos(const char * str, const char * substr);
+/*------------------------------------------------------------------------------
+    ctk_strcaserpos_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last position of \p{substr} in \p{str}, ignoring the case of
+ * ASCII letters, when the length of both strings is already known.
+ *
+ * - Same as ctk_strrpos_n() otherwise.
+ * - Same search as ctk_strcasepos_n(), from the end of \p{str}.
+ *
+ * @param[in] str        : The array to search in.
+ * @param[in] length     : Number of characters in \p{str}.
+ * @param[in] substr     : The array to search for.
+ * @param[in] substr_len : Number of characters in \p{substr}.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{str} of the first character from \p{substr}.
+ *   - '0' if \p{substr_len} is `0`.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The size of the array pointed by \p{substr} must be equal or
+ *           greater than \p{substr_len}.
+ */
+ptrdiff_t ctk_strcaserpos_n(
+    const char * str, size_t length, const char * substr, size_t substr_len
+);
 /*------------------------------------------------------------------------------
     ctk_strerror_r()
 ------------------------------------------------------------------------------*/
@@ -162,6 +553,37 @@ int ctk_strerror_r(int errnum, char * result, size_t length);
  * - \b [UB] \p{substr} must be a pointer to a null-terminated string.
  */
 ptrdiff_t ctk_strpos(const char * str, const char * substr);
+/*------------------------------------------------------------------------------
+    ctk_strpos_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first position of \p{substr} in \p{str} when the length of both
+ * strings is already known.
+ *
+ * - Same as ctk_strpos() but neither string is scanned for its terminating
+ *   null character: they don't need to be null-terminated and a null character
+ *   within the given lengths is compared like any other character.
+ *
+ * @param[in] str        : The array to search in.
+ * @param[in] length     : Number of characters in \p{str}.
+ * @param[in] substr     : The array to search for.
+ * @param[in] substr_len : Number of characters in \p{substr}.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{srt} of the first character from \p{substr}.
+ *   - '0' if \p{substr_len} is `0`.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The size of the array pointed by \p{substr} must be equal or
+ *           greater than \p{substr_len}.
+ */
+ptrdiff_t ctk_strpos_n(
+    const char * str, size_t length, const char * substr, size_t substr_len
+);
 /*------------------------------------------------------------------------------
     ctk_strrpos()
 ------------------------------------------------------------------------------*/
@@ -185,6 +607,37 @@ ptrdiff_t ctk_strpos(const char * str, const char * substr);
  * - \b [UB] \p{substr} must be a pointer to a null-terminated string.
  */
 ptrdiff_t ctk_strrpos(const char * str, const char * substr);
+/*------------------------------------------------------------------------------
+    ctk_strrpos_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last position of \p{substr} in \p{str} when the length of both
+ * strings is already known.
+ *
+ * - Same as ctk_strrpos() but neither string is scanned for its terminating
+ *   null character: they don't need to be null-terminated and a null character
+ *   within the given lengths is compared like any other character.
+ *
+ * @param[in] str        : The array to search in.
+ * @param[in] length     : Number of characters in \p{str}.
+ * @param[in] substr     : The array to search for.
+ * @param[in] substr_len : Number of characters in \p{substr}.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{srt} of the first character from \p{substr}.
+ *   - '0' if \p{substr_len} is `0`.
+ * - @failure: `-1`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The size of the array pointed by \p{substr} must be equal or
+ *           greater than \p{substr_len}.
+ */
+ptrdiff_t ctk_strrpos_n(
+    const char * str, size_t length, const char * substr, size_t substr_len
+);
 /*------------------------------------------------------------------------------
     ctk_strrstr()
 ------------------------------------------------------------------------------*/
@@ -210,6 +663,39 @@ ptrdiff_t ctk_strrpos(const char * str, const char * substr);
  *           \p{str}.
  */
 char * ctk_strrstr(const char * str, const char * substr);
+/*------------------------------------------------------------------------------
+    ctk_strrstr_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last occurrence of \p{substr} in \p{str} when the length of both
+ * strings is already known.
+ *
+ * - Same as ctk_strrstr() but neither string is scanned for its terminating
+ *   null character: they don't need to be null-terminated and a null character
+ *   within the given lengths is compared like any other character.
+ *
+ * @param[in] str        : The array to search in.
+ * @param[in] length     : Number of characters in \p{str}.
+ * @param[in] substr     : The array to search for.
+ * @param[in] substr_len : Number of characters in \p{substr}.
+ *
+ * @return
+ * - @success:
+ *   - A pointer to the position in \p{str} where \p{substr} is found.
+ *   - A pointer to the beginning of \p{str} if \p{substr_len} is `0`.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The size of the array pointed by \p{substr} must be equal or
+ *           greater than \p{substr_len}.
+ * - \b [UB] The returned pointer must not be dereferenced after freeing
+ *           \p{str}.
+ */
+char * ctk_strrstr_n(
+    const char * str, size_t length, const char * substr, size_t substr_len
+);
 /*------------------------------------------------------------------------------
     ctk_strtolower()
 ------------------------------------------------------------------------------*/
@@ -218,6 +704,10 @@ char * ctk_strrstr(const char * str, const char * substr);
  *
  * - The conversion is done in-place and the string pointed by \p{str} may be
  *   modified by this function.
+ * - Only the 26 ASCII letters are converted, whatever the current locale: all
+ *   other characters, including the ones >= `0x80`, are left as is.
+ * - The string is processed 16 or 32 bytes at a time with SIMD instructions
+ *   when the CPU supports them.
  *
  * @param[in,out] str : The string to convert.
  *
@@ -225,8 +715,76 @@ char * ctk_strrstr(const char * str, const char * substr);
  *
  * @warning
  * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ *
+ * @see ctk_strtolower_locale()
  */
 char * ctk_strtolower(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtolower_locale()
+------------------------------------------------------------------------------*/
+/**
+ * Converts a string to lower case according to the current locale.
+ *
+ * - Same as ctk_strtolower() but each character is converted with
+ *   `tolower()`, which depends on the `LC_CTYPE` category of the current
+ *   locale(e.g. `0xC9` is converted in a Latin-1 locale).
+ * - Much slower than ctk_strtolower(): only use it when non-ASCII single-byte
+ *   characters must be converted.
+ *
+ * @param[in,out] str : The string to convert.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the string.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+char * ctk_strtolower_locale(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtolower_locale_n()
+------------------------------------------------------------------------------*/
+/**
+ * Converts the first \p{length} characters of an array to lower case
+ * according to the current locale.
+ *
+ * - Same as ctk_strtolower_locale() but the array isn't scanned for a
+ *   terminating null character.
+ *
+ * @param[in,out] str    : The array to convert.
+ * @param[in]     length : Number of characters to convert.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the array.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+char * ctk_strtolower_locale_n(char * str, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_strtolower_n()
+------------------------------------------------------------------------------*/
+/**
+ * Converts the first \p{length} characters of an array to lower case.
+ *
+ * - Same as ctk_strtolower() but the array isn't scanned for a terminating null
+ *   character: null characters within \p{length} are left as is and the
+ *   conversion goes on after them.
+ *
+ * @param[in,out] str    : The array to convert.
+ * @param[in]     length : Number of characters to convert.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the array.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+char * ctk_strtolower_n(char * str, size_t length);
 /*------------------------------------------------------------------------------
     ctk_strtoupper()
 ------------------------------------------------------------------------------*/
@@ -235,6 +793,10 @@ char * ctk_strtolower(char * str);
  *
  * - The conversion is done in-place and the string pointed by \p{str} may be
  *   modified by this function.
+ * - Only the 26 ASCII letters are converted, whatever the current locale: all
+ *   other characters, including the ones >= `0x80`, are left as is.
+ * - The string is processed 16 or 32 bytes at a time with SIMD instructions
+ *   when the CPU supports them.
  *
  * @param[in,out] str : The string to convert.
  *
@@ -242,15 +804,84 @@ char * ctk_strtolower(char * str);
  *
  * @warning
  * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ *
+ * @see ctk_strtoupper_locale()
  */
 char * ctk_strtoupper(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtoupper_locale()
+------------------------------------------------------------------------------*/
+/**
+ * Converts a string to upper case according to the current locale.
+ *
+ * - Same as ctk_strtoupper() but each character is converted with
+ *   `toupper()`, which depends on the `LC_CTYPE` category of the current
+ *   locale(e.g. `0xC9` is converted in a Latin-1 locale).
+ * - Much slower than ctk_strtoupper(): only use it when non-ASCII single-byte
+ *   characters must be converted.
+ *
+ * @param[in,out] str : The string to convert.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the string.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+char * ctk_strtoupper_locale(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtoupper_locale_n()
+------------------------------------------------------------------------------*/
+/**
+ * Converts the first \p{length} characters of an array to upper case
+ * according to the current locale.
+ *
+ * - Same as ctk_strtoupper_locale() but the array isn't scanned for a
+ *   terminating null character.
+ *
+ * @param[in,out] str    : The array to convert.
+ * @param[in]     length : Number of characters to convert.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the array.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+char * ctk_strtoupper_locale_n(char * str, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_strtoupper_n()
+------------------------------------------------------------------------------*/
+/**
+ * Converts the first \p{length} characters of an array to upper case.
+ *
+ * - Same as ctk_strtoupper() but the array isn't scanned for a terminating null
+ *   character: null characters within \p{length} are left as is and the
+ *   conversion goes on after them.
+ *
+ * @param[in,out] str    : The array to convert.
+ * @param[in]     length : Number of characters to convert.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the array.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ */
+char * ctk_strtoupper_n(char * str, size_t length);
 /*------------------------------------------------------------------------------
     ctk_strtrim()
 ------------------------------------------------------------------------------*/
 /**
  * Removes leading and trailing whitespaces from a string.
  *
- * - Whitespaces are the characters for which `isspace()` returns true.
+ * - Whitespaces are the ASCII ones(#CTK_ASCII_SPACE), whatever the locale.
+ * - Same as ctk_strtrim_n(str, strlen(str)).
  * - The removal is done in-place and the string pointed by \p{str} may be
  *   modified by this function.
  *
@@ -265,13 +896,43 @@ char * ctk_strtoupper(char * str);
  *           \p{str}.
  */
 char * ctk_strtrim(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtrim_n()
+------------------------------------------------------------------------------*/
+/**
+ * Removes leading and trailing whitespaces from a string whose length is
+ * already known.
+ *
+ * - Same as ctk_strtrim() but the string isn't scanned for its terminating
+ *   null character.
+ * - If trailing whitespaces are found, a null character replaces the first of
+ *   them. Otherwise the array is left untouched: it doesn't need to be
+ *   null-terminated.
+ * - Only the whitespaces at both ends are read, 16 bytes at a time with SSE2:
+ *   the trailing ones from the end, then the leading ones.
+ *
+ * @param[in,out] str    : The string to trim.
+ * @param[in]     length : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: A pointer to the first non-whitespace character of \p{str}.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The returned pointer must not be passed to `free()`.
+ * - \b [UB] The returned pointer must not be dereferenced after freeing
+ *           \p{str}.
+ */
+char * ctk_strtrim_n(char * str, size_t length);
 /*------------------------------------------------------------------------------
     ctk_strtriml()
 ------------------------------------------------------------------------------*/
 /**
  * Removes leading whitespaces from a string.
  *
- * - Whitespaces are the characters for which `isspace()` returns true.
+ * - Whitespaces are the ASCII ones(#CTK_ASCII_SPACE), whatever the locale.
  * - The removal is done in-place and the string pointed by \p{str} may be
  *   modified by this function.
  *
@@ -286,13 +947,38 @@ char * ctk_strtrim(char * str);
  *           \p{str}.
  */
 char * ctk_strtriml(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtriml_n()
+------------------------------------------------------------------------------*/
+/**
+ * Skips leading whitespaces of the first \p{length} characters of an array.
+ *
+ * - Same as ctk_strtriml() but the array isn't scanned for a terminating null
+ *   character and the search stops after \p{length} characters.
+ *
+ * @param[in] str    : The array to trim.
+ * @param[in] length : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: A pointer to the first non-whitespace character of \p{str} or
+ *   to \p{str} + \p{length} if there is none.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The returned pointer must not be passed to `free()`.
+ * - \b [UB] The returned pointer must not be dereferenced after freeing
+ *           \p{str}.
+ */
+char * ctk_strtriml_n(char * str, size_t length);
 /*------------------------------------------------------------------------------
     ctk_strtrimr()
 ------------------------------------------------------------------------------*/
 /**
  * Removes trailing whitespaces from a string.
  *
- * - Whitespaces are the characters for which `isspace()` returns true.
+ * - Whitespaces are the ASCII ones(#CTK_ASCII_SPACE), whatever the locale.
  * - The removal is done in-place and the string pointed by \p{str} may be
  *   modified by this function.
  *
@@ -306,15 +992,43 @@ char * ctk_strtriml(char * str);
  *           \p{str}.
  */
 char * ctk_strtrimr(char * str);
+/*------------------------------------------------------------------------------
+    ctk_strtrimr_n()
+------------------------------------------------------------------------------*/
+/**
+ * Removes trailing whitespaces from a string whose length is already known.
+ *
+ * - Same as ctk_strtrimr() but `strlen()` isn't called on \p{str}.
+ * - If trailing whitespaces are found, a null character replaces the first of
+ *   them. Otherwise the array is left untouched: it doesn't need to be
+ *   null-terminated.
+ *
+ * @param[in,out] str    : The string to trim.
+ * @param[in]     length : Number of characters in \p{str}.
+ *
+ * @return
+ * - @success: A pointer to the beginning of the string.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{str} must be equal or greater
+ *           than \p{length}.
+ * - \b [UB] The returned pointer must not be dereferenced after freeing
+ *           \p{str}.
+ */
+char * ctk_strtrimr_n(char * str, size_t length);
 /*------------------------------------------------------------------------------
     ctk_tolower()
 ------------------------------------------------------------------------------*/
 /**
  * Converts an uppercase character to a lowercase one.
  *
- * Works as `tolower()` except for the following points:
- * - Returns \p{c} if \p{c} is neither representable as an `unsigned char` nor
- *   has the value of `EOF`(instead of being an undefined behavior).
+ * Works as `tolower()` in the `"C"` locale, whatever the current locale,
+ * except for the following points:
+ * - Returns \p{c} if \p{c} isn't representable as an `unsigned char`
+ *   (instead of being an undefined behavior), as it does for `EOF`.
+ * - Same as ctk_ascii_tolower(): only ASCII letters are converted, use
+ *   ctk_strtolower_locale() for the single-byte characters of the locale.
  *
  * @param[in] c : The character to convert.
  *
@@ -333,9 +1047,12 @@ int ctk_tolower(int c);
 /**
  * Converts a lowercase character to an uppercase one.
  *
- * Works as `toupper()` except for the following points:
- * - Returns \p{c} if \p{c} is neither representable as an `unsigned char` nor
- *   has the value of `EOF`(instead of being an undefined behavior).
+ * Works as `toupper()` in the `"C"` locale, whatever the current locale,
+ * except for the following points:
+ * - Returns \p{c} if \p{c} isn't representable as an `unsigned char`
+ *   (instead of being an undefined behavior), as it does for `EOF`.
+ * - Same as ctk_ascii_toupper(): only ASCII letters are converted, use
+ *   ctk_strtoupper_locale() for the single-byte characters of the locale.
  *
  * @param[in] c : The character to convert.
  *
@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide a multi-pattern substring search with the Aho-Corasick algorithm.
+ *
+ * @details
+ * - A set of patterns is compiled once into an automaton which then finds all
+ *   their occurrences in a text in a single pass, whatever the number of
+ *   patterns: one ctk_strmatch scan replaces a ctk_strpos() call per pattern.
+ * - The automaton is a complete DFA flattened into a single table of
+ *   `uint32_t` rows. Bytes which don't appear in any pattern share a column,
+ *   so a row only has one column per distinct byte of the patterns and the
+ *   table stays small. Each step of a scan is one load in the table, plus one
+ *   in the same row to check for matches.
+ * - Patterns are arrays of explicit length: they may contain null characters
+ *   and don't need to be null-terminated.
+ * - A matcher isn't modified by scans: it can be shared between threads.
+ *
+ * @example{
+ *  const char * const words[] = {"error", "fatal", "panic"};
+ *  struct ctk_strmatch * matcher = ctk_strmatch_create(words, NULL, 3);
+ *  struct ctk_strmatch_match match;
+ *  if(ctk_strmatch_first(matcher, line, &match)) {
+ *      // words[match.pattern] found at line + match.start
+ *  }
+ *  ctk_strmatch_destroy(&matcher);
+ * }
+ *
+ * @see
+ * - Aho A. V., Corasick M. J., "Efficient string matching: an aid to
+ *   bibliographic search", Communications of the ACM 18(6):333-340, 1975.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_STRMATCH_H_20261018174927
+#define CTK_STRMATCH_H_20261018174927
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stdbool.h>
+#include <stddef.h> // size_t
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Opaque multi-pattern matcher.
+ */
+struct ctk_strmatch;
+/**
+ * Occurrence of a pattern in a text.
+ */
+struct ctk_strmatch_match {
+    size_t pattern; //!< Index of the pattern given to ctk_strmatch_create().
+    size_t start;   //!< Position of the first character of the occurrence.
+    size_t length;  //!< Length of the pattern.
+};
+/*==============================================================================
+    TYPE
+==============================================================================*/
+/**
+ * Receives the occurrences found by ctk_strmatch_all(), returns `false` to
+ * stop the scan.
+ */
+typedef bool ctk_strmatch_fn(
+    const struct ctk_strmatch_match * match, void * ctx
+);
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strmatch_create()
+------------------------------------------------------------------------------*/
+/**
+ * Compiles a set of patterns into a matcher.
+ *
+ * - The patterns are copied: they can be freed once the matcher is created.
+ * - A pattern given several times is reported once per index.
+ * - The memory of the matcher grows with the total length of the patterns
+ *   times the number of distinct bytes in them, by 4 bytes.
+ *
+ * @param[in] patterns : The patterns to search for, may be `NULL` if
+ *                       \p{count} is `0`.
+ * @param[in] lengths  : Length of each pattern, or `NULL` if the patterns are
+ *                       null-terminated strings.
+ * @param[in] count    : Number of patterns.
+ *
+ * @return
+ * - @success: A pointer to the new matcher.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - The patterns must not be `NULL` nor empty.
+ * - The matcher must be destroyed with ctk_strmatch_destroy().
+ */
+struct ctk_strmatch * ctk_strmatch_create(
+    const char * const * patterns, const size_t * lengths, size_t count
+);
+/*------------------------------------------------------------------------------
+    ctk_strmatch_destroy()
+------------------------------------------------------------------------------*/
+/**
+ * Destroys a matcher and sets \p{*matcher} to `NULL`.
+ *
+ * - Nothing happens if \p{*matcher} is `NULL`.
+ *
+ * @param[in,out] matcher : Address of the pointer to the matcher to destroy.
+ *
+ * @return Nothing.
+ */
+void ctk_strmatch_destroy(struct ctk_strmatch ** matcher);
+/*------------------------------------------------------------------------------
+    ctk_strmatch_all()
+------------------------------------------------------------------------------*/
+/**
+ * Finds all the occurrences of the patterns of a matcher in a string.
+ *
+ * - Occurrences are reported in the order of their end, the longest first
+ *   when several end at the same position. Overlapping occurrences are all
+ *   reported.
+ * - The string is read once, up to its terminating null character: patterns
+ *   containing a null character never match.
+ *
+ * @param[in] matcher : The matcher.
+ * @param[in] text    : The string to search in.
+ * @param[in] fn      : Called on each occurrence, or `NULL` to only count
+ *                      them.
+ * @param[in] ctx     : Passed to \p{fn}.
+ *
+ * @return
+ * - @success: The number of occurrences found, up to the one for which
+ *   \p{fn} returned `false`.
+ * - @failure: `0`.
+ *
+ * @warning
+ * - \b [UB] \p{text} must be a pointer to a null-terminated string.
+ */
+size_t ctk_strmatch_all(
+    const struct ctk_strmatch * matcher, const char * text,
+    ctk_strmatch_fn * fn, void * ctx
+);
+/*------------------------------------------------------------------------------
+    ctk_strmatch_all_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds all the occurrences of the patterns of a matcher in an array.
+ *
+ * - Same as ctk_strmatch_all() but the array isn't scanned for a terminating
+ *   null character: null characters are matched as any other byte.
+ *
+ * @param[in] matcher : The matcher.
+ * @param[in] text    : The array to search in, may be `NULL` if \p{length} is
+ *                      `0`.
+ * @param[in] length  : Number of characters in \p{text}.
+ * @param[in] fn      : Called on each occurrence, or `NULL` to only count
+ *                      them.
+ * @param[in] ctx     : Passed to \p{fn}.
+ *
+ * @return
+ * - @success: The number of occurrences found, up to the one for which
+ *   \p{fn} returned `false`.
+ * - @failure: `0`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{text} must be equal or
+ *           greater than \p{length}.
+ */
+size_t ctk_strmatch_all_n(
+    const struct ctk_strmatch * matcher, const char * text, size_t length,
+    ctk_strmatch_fn * fn, void * ctx
+);
+/*------------------------------------------------------------------------------
+    ctk_strmatch_first()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first occurrence of any pattern of a matcher in a string.
+ *
+ * - The first occurrence is the one which ends first, the longest if several
+ *   end at the same position: the scan stops as soon as it is found.
+ *
+ * @param[in]  matcher : The matcher.
+ * @param[in]  text    : The string to search in.
+ * @param[out] match   : The occurrence found, may be `NULL`.
+ *
+ * @return
+ * - @success: `true` if a pattern occurs in \p{text}, `false` otherwise.
+ * - @failure: `false`.
+ *
+ * @warning
+ * - \b [UB] \p{text} must be a pointer to a null-terminated string.
+ */
+bool ctk_strmatch_first(
+    const struct ctk_strmatch * matcher, const char * text,
+    struct ctk_strmatch_match * match
+);
+/*------------------------------------------------------------------------------
+    ctk_strmatch_first_n()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first occurrence of any pattern of a matcher in an array.
+ *
+ * - Same as ctk_strmatch_first() but the array isn't scanned for a
+ *   terminating null character.
+ *
+ * @param[in]  matcher : The matcher.
+ * @param[in]  text    : The array to search in, may be `NULL` if \p{length}
+ *                       is `0`.
+ * @param[in]  length  : Number of characters in \p{text}.
+ * @param[out] match   : The occurrence found, may be `NULL`.
+ *
+ * @return
+ * - @success: `true` if a pattern occurs in \p{text}, `false` otherwise.
+ * - @failure: `false`.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{text} must be equal or
+ *           greater than \p{length}.
+ */
+bool ctk_strmatch_first_n(
+    const struct ctk_strmatch * matcher, const char * text, size_t length,
+    struct ctk_strmatch_match * match
+);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_STRMATCH_H_20261018174927
@@ -0,0 +1,317 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Provide a length-aware, non-owning view over an array of characters.
+ *
+ * @details
+ * - A #ctk_strview is a pointer and a length: the viewed characters don't need
+ *   to be null-terminated and are never scanned for a terminating null
+ *   character, which makes views suitable for slices of a bigger buffer(e.g.
+ *   a memory-mapped file).
+ * - Null characters inside a view are ordinary characters.
+ * - A view never owns the memory it points to.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_STRVIEW_H_20261018112036
+#define CTK_STRVIEW_H_20261018112036
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stdbool.h>
+#include <stddef.h> // NULL, ptrdiff_t, size_t
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Non-owning view over \p{length} characters starting at \p{data}.
+ */
+struct ctk_strview {
+    const char * data; //!< First viewed character.
+    size_t length;     //!< Number of viewed characters.
+};
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Creates a #ctk_strview over \p{length} characters starting at \p{data}.
+ *
+ * @example{
+ *  const char buf[] = "key=value";
+ *  struct ctk_strview key = CTK_STRVIEW(buf, 3); // "key"
+ * }
+ */
+#define CTK_STRVIEW(data, length) \
+    ((struct ctk_strview){(data), (length)})
+/**
+ * Creates a #ctk_strview over a string literal without calling `strlen()`.
+ *
+ * @warning
+ * - \p{literal} must be a string literal.
+ *
+ * @example{
+ *  struct ctk_strview sv = CTK_STRVIEW_LITERAL("Lorem"); // sv.length == 5
+ * }
+ */
+#define CTK_STRVIEW_LITERAL(literal) \
+    CTK_STRVIEW(("" literal), sizeof(literal) - 1)
+/**
+ * Empty #ctk_strview, also returned by functions on failure.
+ */
+#define CTK_STRVIEW_EMPTY \
+    CTK_STRVIEW(NULL, 0)
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strview_from_str()
+------------------------------------------------------------------------------*/
+/**
+ * Creates a #ctk_strview over a null-terminated string.
+ *
+ * - `strlen()` is called once, the terminating null character isn't part of
+ *   the view.
+ *
+ * @param[in] str : The string to view.
+ *
+ * @return
+ * - @success: A view over \p{str}.
+ * - @failure: #CTK_STRVIEW_EMPTY.
+ *
+ * @warning
+ * - \b [UB] \p{str} must be a pointer to a null-terminated string.
+ */
+struct ctk_strview ctk_strview_from_str(const char * str);
+/*------------------------------------------------------------------------------
+    ctk_strview_sub()
+------------------------------------------------------------------------------*/
+/**
+ * Creates a view over a part of another view.
+ *
+ * - \p{length} is clamped so that the new view doesn't go past the end of
+ *   \p{view}.
+ *
+ * @param[in] view   : The view to slice.
+ * @param[in] pos    : Position of the first character of the new view.
+ * @param[in] length : Maximum length of the new view.
+ *
+ * @return
+ * - @success: A view over `[pos, pos + length)`.
+ * - @failure: #CTK_STRVIEW_EMPTY.
+ *
+ * @warning
+ * - \p{pos} must be <= `view.length`.
+ */
+struct ctk_strview ctk_strview_sub(
+    struct ctk_strview view, size_t pos, size_t length
+);
+/*------------------------------------------------------------------------------
+    ctk_strview_cmp()
+------------------------------------------------------------------------------*/
+/**
+ * Compares two views lexicographically.
+ *
+ * - Characters are compared as `unsigned char` as with `memcmp()`.
+ * - If a view is a prefix of the other one, the shortest compares less.
+ *
+ * @param[in] lhs : The first view.
+ * @param[in] rhs : The second view.
+ *
+ * @return
+ * - A negative value if \p{lhs} is less than \p{rhs}.
+ * - `0` if \p{lhs} and \p{rhs} are equal.
+ * - A positive value if \p{lhs} is greater than \p{rhs}.
+ */
+int ctk_strview_cmp(struct ctk_strview lhs, struct ctk_strview rhs);
+/*------------------------------------------------------------------------------
+    ctk_strview_eq()
+------------------------------------------------------------------------------*/
+/**
+ * Checks if two views contain the same characters.
+ *
+ * - Views of different lengths are rejected without reading any character.
+ *
+ * @param[in] lhs : The first view.
+ * @param[in] rhs : The second view.
+ *
+ * @return `true` if both views are equal, `false` otherwise.
+ */
+bool ctk_strview_eq(struct ctk_strview lhs, struct ctk_strview rhs);
+/*------------------------------------------------------------------------------
+    ctk_strview_starts_with()
+------------------------------------------------------------------------------*/
+/**
+ * Checks if a view starts with another one.
+ *
+ * @param[in] view   : The view to check.
+ * @param[in] prefix : The prefix to look for.
+ *
+ * @return `true` if \p{view} starts with \p{prefix}, `false` otherwise.
+ */
+bool ctk_strview_starts_with(struct ctk_strview view, struct ctk_strview prefix);
+/*------------------------------------------------------------------------------
+    ctk_strview_ends_with()
+------------------------------------------------------------------------------*/
+/**
+ * Checks if a view ends with another one.
+ *
+ * @param[in] view   : The view to check.
+ * @param[in] suffix : The suffix to look for.
+ *
+ * @return `true` if \p{view} ends with \p{suffix}, `false` otherwise.
+ */
+bool ctk_strview_ends_with(struct ctk_strview view, struct ctk_strview suffix);
+/*------------------------------------------------------------------------------
+    ctk_strview_pos()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first position of \p{substr} in \p{view}.
+ *
+ * @param[in] view   : The view to search in.
+ * @param[in] substr : The view to search for.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{view} of the first character from \p{substr}.
+ *   - '0' if \p{substr} is empty.
+ * - @failure: `-1`.
+ *
+ * @see ctk_strpos_n()
+ */
+ptrdiff_t ctk_strview_pos(struct ctk_strview view, struct ctk_strview substr);
+/*------------------------------------------------------------------------------
+    ctk_strview_rpos()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last position of \p{substr} in \p{view}.
+ *
+ * @param[in] view   : The view to search in.
+ * @param[in] substr : The view to search for.
+ *
+ * @return
+ * - @success:
+ *   - The position in \p{view} of the first character from \p{substr}.
+ *   - '0' if \p{substr} is empty.
+ * - @failure: `-1`.
+ *
+ * @see ctk_strrpos_n()
+ */
+ptrdiff_t ctk_strview_rpos(struct ctk_strview view, struct ctk_strview substr);
+/*------------------------------------------------------------------------------
+    ctk_strview_tolower()
+------------------------------------------------------------------------------*/
+/**
+ * Copies the characters of a view to an array while converting them to lower
+ * case.
+ *
+ * - `view.length` characters are written to \p{dest}, no terminating null
+ *   character is added.
+ * - \p{dest} may be equal to `view.data` to convert a mutable buffer in-place.
+ * - Only the 26 ASCII letters are converted, as with ctk_strtolower().
+ *
+ * @param[out] dest : The array where to write the converted characters.
+ * @param[in]  view : The view to convert.
+ *
+ * @return
+ * - @success: A view over the converted characters in \p{dest}.
+ * - @failure: #CTK_STRVIEW_EMPTY.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{dest} must be equal or greater
+ *           than `view.length`.
+ * - \b [UB] \p{dest} and `view.data` must either be equal or not overlap.
+ */
+struct ctk_strview ctk_strview_tolower(char * dest, struct ctk_strview view);
+/*------------------------------------------------------------------------------
+    ctk_strview_toupper()
+------------------------------------------------------------------------------*/
+/**
+ * Copies the characters of a view to an array while converting them to upper
+ * case.
+ *
+ * - `view.length` characters are written to \p{dest}, no terminating null
+ *   character is added.
+ * - \p{dest} may be equal to `view.data` to convert a mutable buffer in-place.
+ * - Only the 26 ASCII letters are converted, as with ctk_strtoupper().
+ *
+ * @param[out] dest : The array where to write the converted characters.
+ * @param[in]  view : The view to convert.
+ *
+ * @return
+ * - @success: A view over the converted characters in \p{dest}.
+ * - @failure: #CTK_STRVIEW_EMPTY.
+ *
+ * @warning
+ * - \b [UB] The size of the array pointed by \p{dest} must be equal or greater
+ *           than `view.length`.
+ * - \b [UB] \p{dest} and `view.data` must either be equal or not overlap.
+ */
+struct ctk_strview ctk_strview_toupper(char * dest, struct ctk_strview view);
+/*------------------------------------------------------------------------------
+    ctk_strview_trim()
+------------------------------------------------------------------------------*/
+/**
+ * Narrows a view to exclude its leading and trailing whitespaces.
+ *
+ * - Whitespaces are the ASCII ones(#CTK_ASCII_SPACE), whatever the locale.
+ * - The viewed characters are never modified.
+ *
+ * @param[in] view : The view to trim.
+ *
+ * @return A view over the characters of \p{view} without leading and trailing
+ * whitespaces.
+ */
+struct ctk_strview ctk_strview_trim(struct ctk_strview view);
+/*------------------------------------------------------------------------------
+    ctk_strview_triml()
+------------------------------------------------------------------------------*/
+/**
+ * Narrows a view to exclude its leading whitespaces.
+ *
+ * - Whitespaces are the ASCII ones(#CTK_ASCII_SPACE), whatever the locale.
+ * - The viewed characters are never modified.
+ *
+ * @param[in] view : The view to trim.
+ *
+ * @return A view over the characters of \p{view} without leading whitespaces.
+ */
+struct ctk_strview ctk_strview_triml(struct ctk_strview view);
+/*------------------------------------------------------------------------------
+    ctk_strview_trimr()
+------------------------------------------------------------------------------*/
+/**
+ * Narrows a view to exclude its trailing whitespaces.
+ *
+ * - Whitespaces are the ASCII ones(#CTK_ASCII_SPACE), whatever the locale.
+ * - The viewed characters are never modified.
+ *
+ * @param[in] view : The view to trim.
+ *
+ * @return A view over the characters of \p{view} without trailing whitespaces.
+ */
+struct ctk_strview ctk_strview_trimr(struct ctk_strview view);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_STRVIEW_H_20261018112036
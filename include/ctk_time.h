@@ -21,6 +21,21 @@
  *
  * @brief
  * Provide time related functions.
+ *
+ * @details
+ * - Sub-second times and durations are counted in nanoseconds in an `int64_t`,
+ *   which covers about 292 years on each side of the reference point of their
+ *   clock. Durations are then plain integer arithmetic.
+ * - Monotonic clocks measure durations and never go backward, realtime clocks
+ *   give the time since Epoch and may jump when the system time is changed.
+ * - COARSE clocks are much cheaper to read but only updated every system tick
+ *   (usually 1 to 4 ms).
+ *
+ * @example{
+ *  const int64_t start = ctk_time_monotonic_ns();
+ *  // ...
+ *  const int64_t latency_us = ctk_time_elapsed_ns(start) / CTK_TIME_NS_PER_US;
+ * }
  */
 /*==============================================================================
     GUARD
@@ -31,7 +46,8 @@
     INCLUDE
 ==============================================================================*/
 // C Standard Library
-#include <time.h> // struct tm, time_t, size_t
+#include <stdint.h> // INT64_C, int64_t
+#include <time.h>   // struct timespec, struct tm, time_t, size_t
 /*==============================================================================
     DEFINE
 ==============================================================================*/
@@ -40,6 +56,29 @@
  * ctk_iso8601_time().
  */
 #define CTK_TIME_ISO8601_STR_LENGTH sizeof("YYYY-MM-DDThh:mm:ss+hhmm")
+/**
+ * Size needed for a buffer to contain the timestamp string returned by
+ * ctk_iso8601_time_ms().
+ */
+#define CTK_TIME_ISO8601_MS_STR_LENGTH sizeof("YYYY-MM-DDThh:mm:ss.sss+hhmm")
+/**
+ * Size needed for a buffer to contain the timestamp string returned by
+ * ctk_iso8601_time_us().
+ */
+#define CTK_TIME_ISO8601_US_STR_LENGTH \
+    sizeof("YYYY-MM-DDThh:mm:ss.ssssss+hhmm")
+/**
+ * Number of nanoseconds in a microsecond.
+ */
+#define CTK_TIME_NS_PER_US INT64_C(1000)
+/**
+ * Number of nanoseconds in a millisecond.
+ */
+#define CTK_TIME_NS_PER_MS INT64_C(1000000)
+/**
+ * Number of nanoseconds in a second.
+ */
+#define CTK_TIME_NS_PER_SEC INT64_C(1000000000)
 /*==============================================================================
     PUBLIC FUNCTION
 ==============================================================================*/
@@ -113,6 +152,185 @@ struct tm * ctk_localtime_r(
  * - https://en.cppreference.com/w/c/chrono/strftime
  */
 char * ctk_iso8601_time(time_t timer, char * result, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_cached()
+------------------------------------------------------------------------------*/
+/**
+ * Same as ctk_iso8601_time() but much faster when called repeatedly with close
+ * times, e.g. to timestamp log lines.
+ *
+ * - Each thread caches the string of the last minute it converted: a time in
+ *   the same minute only rewrites the seconds, without calling
+ *   `localtime_r()`, which takes a lock, nor `strftime()`.
+ * - Other times are converted with `localtime_r()` and written digit by digit,
+ *   except years which don't have 4 digits, left to `strftime()` so that the
+ *   string stays the same as the one of ctk_iso8601_time().
+ *
+ * @param[in]  timer  : Time in seconds since Epoch.
+ * @param[out] result : Buffer where the string will be stored.
+ * @param[in]  length : Length of the result buffer.
+ *
+ * @return
+ * - @success: A pointer to \p{result}.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{result} must not be `NULL`.
+ * - \p{length} must be >= #CTK_TIME_ISO8601_STR_LENGTH.
+ * - A change of the time zone(e.g. with `tzset()`) may take up to a minute to
+ *   be seen by each thread.
+ * - The UTC offset is assumed to only change on minute boundaries, which
+ *   isn't the case of a few historical offsets.
+ *
+ * @see ctk_iso8601_time()
+ */
+char * ctk_iso8601_time_cached(time_t timer, char * result, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_ms()
+------------------------------------------------------------------------------*/
+/**
+ * Convert time in nanoseconds since Epoch to a null-terminated ISO 8601
+ * formatted string with milliseconds.
+ *
+ * - Same layout as ctk_iso8601_time() with the milliseconds after the seconds:
+ *   `"YYYY-MM-DDThh:mm:ss.sss+hhmm"`.
+ * - The fraction is truncated, not rounded, so that it never carries into the
+ *   seconds.
+ * - Uses the per-thread cache of ctk_iso8601_time_cached().
+ *
+ * @param[in]  ns     : Time in nanoseconds since Epoch, e.g. from
+ *                      ctk_time_realtime_ns().
+ * @param[out] result : Buffer where the string will be stored.
+ * @param[in]  length : Length of the result buffer.
+ *
+ * @return
+ * - @success: A pointer to \p{result}.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{result} must not be `NULL`.
+ * - \p{length} must be >= #CTK_TIME_ISO8601_MS_STR_LENGTH.
+ *
+ * @example{
+ *  char buf[CTK_TIME_ISO8601_MS_STR_LENGTH];
+ *  ctk_iso8601_time_ms(1615837079123456789, buf, sizeof(buf));
+ *  // buf == "2021-03-15T19:37:59.123+0000" in UTC
+ * }
+ */
+char * ctk_iso8601_time_ms(int64_t ns, char * result, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_us()
+------------------------------------------------------------------------------*/
+/**
+ * Same as ctk_iso8601_time_ms() but with microseconds:
+ * `"YYYY-MM-DDThh:mm:ss.ssssss+hhmm"`.
+ *
+ * @param[in]  ns     : Time in nanoseconds since Epoch.
+ * @param[out] result : Buffer where the string will be stored.
+ * @param[in]  length : Length of the result buffer.
+ *
+ * @return
+ * - @success: A pointer to \p{result}.
+ * - @failure: `NULL`.
+ *
+ * @warning
+ * - \p{result} must not be `NULL`.
+ * - \p{length} must be >= #CTK_TIME_ISO8601_US_STR_LENGTH.
+ */
+char * ctk_iso8601_time_us(int64_t ns, char * result, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_time_monotonic_ns()
+------------------------------------------------------------------------------*/
+/**
+ * Reads the monotonic clock.
+ *
+ * - Uses `clock_gettime(CLOCK_MONOTONIC)`, which is served from the vDSO on
+ *   Linux and doesn't enter the kernel.
+ *
+ * @return
+ * - @success: Nanoseconds since an unspecified starting point.
+ * - @failure: `-1`.
+ */
+int64_t ctk_time_monotonic_ns(void);
+/*------------------------------------------------------------------------------
+    ctk_time_monotonic_coarse_ns()
+------------------------------------------------------------------------------*/
+/**
+ * Reads the coarse monotonic clock, updated every system tick.
+ *
+ * - Uses `CLOCK_MONOTONIC_COARSE` when available, `CLOCK_MONOTONIC` otherwise.
+ *
+ * @return
+ * - @success: Nanoseconds since an unspecified starting point, the same as
+ *   ctk_time_monotonic_ns().
+ * - @failure: `-1`.
+ */
+int64_t ctk_time_monotonic_coarse_ns(void);
+/*------------------------------------------------------------------------------
+    ctk_time_realtime_ns()
+------------------------------------------------------------------------------*/
+/**
+ * Reads the realtime clock.
+ *
+ * @return
+ * - @success: Nanoseconds since Epoch.
+ * - @failure: `-1`.
+ */
+int64_t ctk_time_realtime_ns(void);
+/*------------------------------------------------------------------------------
+    ctk_time_realtime_coarse_ns()
+------------------------------------------------------------------------------*/
+/**
+ * Reads the coarse realtime clock, updated every system tick.
+ *
+ * - Uses `CLOCK_REALTIME_COARSE` when available, `CLOCK_REALTIME` otherwise.
+ *
+ * @return
+ * - @success: Nanoseconds since Epoch.
+ * - @failure: `-1`.
+ */
+int64_t ctk_time_realtime_coarse_ns(void);
+/*------------------------------------------------------------------------------
+    ctk_time_elapsed_ns()
+------------------------------------------------------------------------------*/
+/**
+ * Returns the nanoseconds elapsed since \p{start}.
+ *
+ * @param[in] start : A time returned by ctk_time_monotonic_ns().
+ *
+ * @return
+ * - @success: `ctk_time_monotonic_ns() - start`.
+ * - @failure: `-1`.
+ */
+int64_t ctk_time_elapsed_ns(int64_t start);
+/*------------------------------------------------------------------------------
+    ctk_time_from_timespec()
+------------------------------------------------------------------------------*/
+/**
+ * Converts a `struct timespec` to nanoseconds.
+ *
+ * @param[in] ts : The time to convert.
+ *
+ * @return The number of nanoseconds of \p{ts}.
+ *
+ * @warning
+ * - \b [UB] The result must fit in an `int64_t`.
+ */
+int64_t ctk_time_from_timespec(struct timespec ts);
+/*------------------------------------------------------------------------------
+    ctk_time_to_timespec()
+------------------------------------------------------------------------------*/
+/**
+ * Converts nanoseconds to a `struct timespec`, e.g. for `nanosleep()`.
+ *
+ * - `tv_nsec` is always in `[0, 999999999]`, `tv_sec` is negative for
+ *   negative times.
+ *
+ * @param[in] ns : The nanoseconds to convert.
+ *
+ * @return The `struct timespec` equal to \p{ns}.
+ */
+struct timespec ctk_time_to_timespec(int64_t ns);
 /*==============================================================================
     GUARD
 ==============================================================================*/
@@ -27,6 +27,8 @@ BUILD_MODE ?= debug
 ################################################################################
 # Output folder for analysis tools like valgrind or scan-build               [X]
 ANALYSIS_FOLDER := analysis
+# Input/output folder for benchmarks                                         [X]
+BENCH_FOLDER := bench
 # Installation folder for programs                                           [X]
 BIN_FOLDER := bin
 # Output folder for executables, *.a, *.so, etc                              [X]
@@ -51,6 +53,7 @@ SRC_FOLDER := src
 TEST_FOLDER := test
 # Paths to above folders                                                     [R]
 ANALYSIS_PATH   = $(ANALYSIS_FOLDER)
+BENCH_PATH      = $(BENCH_FOLDER)
 BUILD_PATH      = $(BUILD_ROOT_PATH)/$(BUILD_MODE)
 BUILD_ROOT_PATH = $(BUILD_FOLDER)
 DEP_PATH        = $(BUILD_PATH)/$(DEP_FOLDER)
@@ -76,6 +79,8 @@ libdir      = $(exec_prefix)/$(LIB_FOLDER)
 ################################################################################
 # Target to build tests                                                      [X]
 TEST_TARGET = $(wildcard $(TEST_PATH))
+# Target to build benchmarks                                                 [X]
+BENCH_TARGET = $(wildcard $(BENCH_PATH))
 # List of directories containing header files(*.h)                           [+]
 INC_DIRS = $(INC_PATH)
 # List of directories containing source files(*.c)                           [+]
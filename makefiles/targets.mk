@@ -169,6 +169,34 @@ cov_test::
 	$(MAKE) -C $(TEST_PATH) cov MAKEFILE_PATH=../$(MAKEFILE_PATH)
 endif
 ################################################################################
+# BENCH
+################################################################################
+# Build and run benchmarks in release mode if there is a bench folder
+ifneq ($(BENCH_TARGET),)
+# Options forwarded to the benchmark program, paths are relative to the
+# current folder
+BENCH_ARGS += $(if $(BENCH_FORMAT),--format=$(BENCH_FORMAT))
+BENCH_ARGS += $(if $(BENCH_OUTPUT),--output=$(abspath $(BENCH_OUTPUT)))
+BENCH_ARGS += $(if $(BENCH_BASELINE),--baseline=$(abspath $(BENCH_BASELINE)))
+BENCH_ARGS += $(if $(BENCH_THRESHOLD),--threshold=$(BENCH_THRESHOLD))
+BENCH_ARGS += $(if $(BENCH_FILTER),--filter='$(BENCH_FILTER)')
+BENCH_ARGS += $(if $(BENCH_SAMPLES),--samples=$(BENCH_SAMPLES))
+
+.PHONY: bench
+bench::
+	$(MAKE) $(PROJECT_TYPE) BUILD_MODE=release CC=$(CC)
+	$(MAKE) -C $(BENCH_PATH) all BUILD_MODE=release CC=$(CC) \
+		MAKEFILE_PATH=../$(MAKEFILE_PATH)
+	$(MAKE) -C $(BENCH_PATH) run BUILD_MODE=release \
+		MAKEFILE_PATH=../$(MAKEFILE_PATH) BENCH_ARGS="$(strip $(BENCH_ARGS))"
+
+# Remove bench build files
+CLEAN_DEPS += clean_bench
+.PHONY: clean_bench
+clean_bench::
+	$(MAKE) -C $(BENCH_PATH) clean MAKEFILE_PATH=../$(MAKEFILE_PATH)
+endif
+################################################################################
 # CODE ANALYSIS/COVERAGE - DOC
 ################################################################################
 # Code static analysis
@@ -229,6 +257,7 @@ help::
 	@printf "  all                  : Default target. Build program(s), static/dynamic lib(s) and tests.\n"
 	@printf "  all_dr               : Same as 'all' but also build in release mode.\n"
 	@printf "  analyze_static       : \n"
+	@printf "  bench                : Build lib in release mode then build and run benchmarks.\n"
 	@printf "  check                : Run tests(and build them first if needed).\n"
 	@printf "  clean                : \n"
 	@printf "  cov                  : Run code coverage tool(s).\n"
@@ -248,6 +277,12 @@ help::
 	@printf "  uninstall_lib        : Uninstall lib.\n"
 	@printf "\n"
 	@printf "OPTIONS:\n"
+	@printf "  BENCH_BASELINE=<PATH>: Compare benchmarks with a CSV saved with BENCH_FORMAT=csv.\n"
+	@printf "  BENCH_FILTER=<STRING>: Only run benchmarks whose name contains <STRING>.\n"
+	@printf "  BENCH_FORMAT=<FORMAT>: <FORMAT> must be one of [text, csv, json]. Default value is 'text'.\n"
+	@printf "  BENCH_OUTPUT=<PATH>  : Write benchmark results to <PATH> instead of stdout.\n"
+	@printf "  BENCH_SAMPLES=<N>    : Timed samples per benchmark. Default value is '11'.\n"
+	@printf "  BENCH_THRESHOLD=<PCT>: Slowdown over BENCH_BASELINE making 'bench' fail. Default value is '10'.\n"
 	@printf "  BUILD_MODE=<MODE>    : <MODE> must be one of [debug, release]. Default value is '%s'.\n" "$(BUILD_MODE)"
 	@printf "  CC=<COMPILER>        : <COMPILER> must be one of [gcc]. Default value is '%s'.\n" "$(CC)"
 	@printf "  COVERAGE=<true|false>: Default value is '%s'.\n" "$(COVERAGE)"
@@ -24,14 +24,420 @@
 /*==============================================================================
     INCLUDE
 ==============================================================================*/
+// Portability
+#include "ctk_platform.h"
 // Own header
 #include "ctk_alloc.h"
 // C Standard Library
 #include <assert.h>
-#include <stdio.h>  // fputs()
-#include <stdlib.h> // calloc(), free(), malloc(), realloc(), size_t, NULL
+#include <inttypes.h> // PRId64, PRIu64
+#include <stdbool.h>
+#include <stdint.h>   // SIZE_MAX, int64_t, uint64_t, uintptr_t
+#include <stdio.h>    // fprintf(), fputs()
+#include <stdlib.h>   // aligned_alloc(), calloc(), free(), malloc(), realloc(),
+                      // size_t, NULL
+#include <string.h>   // memset()
+#if defined(CTK_ALLOC_CACHE)
+    #if !defined(__GLIBC__) || !defined(CTK_POSIX)
+        #error "CTK_ALLOC_CACHE needs glibc and POSIX threads"
+    #endif
+#endif
+#if defined(CTK_ALLOC_STATS)
+    #if !defined(__GLIBC__) || !defined(CTK_POSIX)
+        #error "CTK_ALLOC_STATS needs glibc and POSIX threads"
+    #endif
+    #include <stdatomic.h>
+#endif
+#if defined(CTK_ALLOC_CACHE) || defined(CTK_ALLOC_STATS)
+    #include <malloc.h> // GNU malloc_usable_size()
+    #include <pthread.h>
+#endif
 // Internal
 #include "ctk_error.h"
+#if defined(CTK_ALLOC_CACHE)
+/*==============================================================================
+    PRIVATE DEFINE
+==============================================================================*/
+// Sizes are rounded up to a multiple of this to find their class
+#define CTK_ALLOC_CACHE_GRANULE 16
+// Number of size classes: sizes up to 1 KiB are cached
+#define CTK_ALLOC_CACHE_CLASSES 64
+// Biggest cached size
+#define CTK_ALLOC_CACHE_MAX (CTK_ALLOC_CACHE_GRANULE * CTK_ALLOC_CACHE_CLASSES)
+// Number of blocks moved at once between a thread cache and the depot. A
+// thread cache holds up to twice this number of blocks per class.
+#define CTK_ALLOC_CACHE_BATCH 32
+// Maximum number of batches kept by the depot per class, extra ones are freed
+#define CTK_ALLOC_CACHE_DEPOT_MAX 64
+/*==============================================================================
+    PRIVATE STRUCT
+==============================================================================*/
+// Cached block: links are stored in the free memory itself, which is why only
+// blocks of at least CTK_ALLOC_CACHE_GRANULE bytes are cached
+struct ctk_alloc_block {
+    struct ctk_alloc_block * next;       // Next block of the same bin/batch
+    struct ctk_alloc_block * next_batch; // Next batch, only valid in the depot
+};
+// Thread-local list of free blocks of a single class
+struct ctk_alloc_bin {
+    struct ctk_alloc_block * head;
+    size_t count;
+};
+// Batches of CTK_ALLOC_CACHE_BATCH blocks of a single class shared by all
+// threads
+struct ctk_alloc_depot {
+    pthread_mutex_t lock;
+    struct ctk_alloc_block * batches;
+    size_t count;
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+// Class `i` holds blocks which can store at least `(i + 1) * GRANULE` bytes
+static _Thread_local struct ctk_alloc_bin ctk_alloc_bins[CTK_ALLOC_CACHE_CLASSES];
+// Whether the thread exit handler is registered for the calling thread
+static _Thread_local bool ctk_alloc_registered;
+static struct ctk_alloc_depot ctk_alloc_depots[CTK_ALLOC_CACHE_CLASSES];
+// Key whose destructor gives the cache of an exiting thread back
+static pthread_key_t ctk_alloc_key;
+static pthread_once_t ctk_alloc_once = PTHREAD_ONCE_INIT;
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_alloc_bin_drain()
+------------------------------------------------------------------------------*/
+// Frees all the blocks of the calling thread's cache
+static void ctk_alloc_bin_drain(void * const unused)
+{
+    (void)unused;
+    for(size_t i = 0; i < CTK_ALLOC_CACHE_CLASSES; i++) {
+        struct ctk_alloc_block * block = ctk_alloc_bins[i].head;
+        while(block != NULL) {
+            struct ctk_alloc_block * const next = block->next;
+            free(block);
+            block = next;
+        }
+        ctk_alloc_bins[i].head = NULL;
+        ctk_alloc_bins[i].count = 0;
+    }
+    // Blocks freed by later destructors register the thread again
+    ctk_alloc_registered = false;
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_init()
+------------------------------------------------------------------------------*/
+static void ctk_alloc_init(void)
+{
+    for(size_t i = 0; i < CTK_ALLOC_CACHE_CLASSES; i++) {
+        pthread_mutex_init(&ctk_alloc_depots[i].lock, NULL);
+    }
+    pthread_key_create(&ctk_alloc_key, ctk_alloc_bin_drain);
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_register()
+------------------------------------------------------------------------------*/
+// Makes sure the cache of the calling thread is drained when it exits
+static void ctk_alloc_register(void)
+{
+    pthread_once(&ctk_alloc_once, ctk_alloc_init);
+    // The destructor is only called for non-NULL values
+    pthread_setspecific(ctk_alloc_key, &ctk_alloc_registered);
+    ctk_alloc_registered = true;
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_cache_get()
+------------------------------------------------------------------------------*/
+// Block of `size`(<= CTK_ALLOC_CACHE_MAX) bytes from the calling thread's cache
+static void * ctk_alloc_cache_get(const size_t size)
+{
+    const size_t class = (size - 1) / CTK_ALLOC_CACHE_GRANULE;
+    struct ctk_alloc_bin * const bin = &ctk_alloc_bins[class];
+    if(bin->head == NULL) {
+        if(!ctk_alloc_registered) {
+            ctk_alloc_register();
+        }
+        // Refill a whole batch from the depot at once
+        struct ctk_alloc_depot * const depot = &ctk_alloc_depots[class];
+        pthread_mutex_lock(&depot->lock);
+        struct ctk_alloc_block * const batch = depot->batches;
+        if(batch != NULL) {
+            depot->batches = batch->next_batch;
+            depot->count--;
+        }
+        pthread_mutex_unlock(&depot->lock);
+        if(batch == NULL) {
+            // Allocate the full class size so that the block can be cached for
+            // any size of its class once freed
+            return malloc((class + 1) * CTK_ALLOC_CACHE_GRANULE);
+        }
+        bin->head = batch;
+        bin->count = CTK_ALLOC_CACHE_BATCH;
+    }
+    struct ctk_alloc_block * const block = bin->head;
+    bin->head = block->next;
+    bin->count--;
+    return block;
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_cache_put()
+------------------------------------------------------------------------------*/
+// Gives a block back to the calling thread's cache, or to the system if it
+// can't be cached
+static void ctk_alloc_cache_put(void * const mem)
+{
+    // Blocks coming straight from malloc() are accepted as well
+    const size_t usable = malloc_usable_size(mem);
+    if(usable < CTK_ALLOC_CACHE_GRANULE
+        || usable >= CTK_ALLOC_CACHE_MAX + CTK_ALLOC_CACHE_GRANULE) {
+        free(mem);
+        return;
+    }
+    if(!ctk_alloc_registered) {
+        ctk_alloc_register();
+    }
+    const size_t class = usable / CTK_ALLOC_CACHE_GRANULE - 1;
+    struct ctk_alloc_bin * const bin = &ctk_alloc_bins[class];
+    if(bin->count == 2 * CTK_ALLOC_CACHE_BATCH) {
+        // Flush a whole batch to the depot at once
+        struct ctk_alloc_block * const batch = bin->head;
+        struct ctk_alloc_block * tail = batch;
+        for(size_t i = 1; i < CTK_ALLOC_CACHE_BATCH; i++) {
+            tail = tail->next;
+        }
+        bin->head = tail->next;
+        bin->count -= CTK_ALLOC_CACHE_BATCH;
+        tail->next = NULL;
+        struct ctk_alloc_depot * const depot = &ctk_alloc_depots[class];
+        bool full = true;
+        pthread_mutex_lock(&depot->lock);
+        if(depot->count < CTK_ALLOC_CACHE_DEPOT_MAX) {
+            batch->next_batch = depot->batches;
+            depot->batches = batch;
+            depot->count++;
+            full = false;
+        }
+        pthread_mutex_unlock(&depot->lock);
+        if(full) {
+            for(struct ctk_alloc_block * it = batch; it != NULL;) {
+                struct ctk_alloc_block * const next = it->next;
+                free(it);
+                it = next;
+            }
+        }
+    }
+    struct ctk_alloc_block * const block = mem;
+    block->next = bin->head;
+    bin->head = block;
+    bin->count++;
+}
+#endif
+#if defined(CTK_ALLOC_STATS)
+/*==============================================================================
+    PRIVATE ENUM
+==============================================================================*/
+// Index of the per-thread counters, the histogram takes the last
+// CTK_ALLOC_STATS_BUCKETS slots
+enum ctk_alloc_stat {
+    CTK_ALLOC_STAT_MALLOC,
+    CTK_ALLOC_STAT_CALLOC,
+    CTK_ALLOC_STAT_ALIGNED,
+    CTK_ALLOC_STAT_REALLOC,
+    CTK_ALLOC_STAT_FREE,
+    CTK_ALLOC_STAT_FAILED,
+    CTK_ALLOC_STAT_BYTES,
+    CTK_ALLOC_STAT_LIVE, // Two's complement: frees may come from other threads
+    CTK_ALLOC_STAT_PEAK,
+    CTK_ALLOC_STAT_IN_PLACE,
+    CTK_ALLOC_STAT_MOVED,
+    CTK_ALLOC_STAT_HISTOGRAM,
+    CTK_ALLOC_STAT_COUNT = CTK_ALLOC_STAT_HISTOGRAM + CTK_ALLOC_STATS_BUCKETS
+};
+/*==============================================================================
+    PRIVATE STRUCT
+==============================================================================*/
+// Counters of a single thread. Records are never freed: they are given back
+// when their thread exits and reused by the next new thread, so the counts of
+// finished threads stay in the totals.
+struct ctk_alloc_stats_record {
+    // Only written by the owning thread, read by ctk_alloc_stats_snapshot()
+    _Atomic uint64_t counters[CTK_ALLOC_STAT_COUNT];
+    atomic_bool in_use;
+    // Immutable once the record is published
+    struct ctk_alloc_stats_record * next;
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+// Lock-free list of all the records ever created
+static struct ctk_alloc_stats_record * _Atomic ctk_alloc_stats_records;
+// Record of the calling thread
+static _Thread_local struct ctk_alloc_stats_record * ctk_alloc_stats_self;
+// Key whose destructor gives the record of an exiting thread back
+static pthread_key_t ctk_alloc_stats_key;
+static pthread_once_t ctk_alloc_stats_once = PTHREAD_ONCE_INIT;
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_release()
+------------------------------------------------------------------------------*/
+static void ctk_alloc_stats_release(void * const record)
+{
+    struct ctk_alloc_stats_record * const self = record;
+    // Allocations made by later destructors attach a record again
+    ctk_alloc_stats_self = NULL;
+    atomic_store_explicit(&self->in_use, false, memory_order_release);
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_init()
+------------------------------------------------------------------------------*/
+static void ctk_alloc_stats_init(void)
+{
+    pthread_key_create(&ctk_alloc_stats_key, ctk_alloc_stats_release);
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_attach()
+------------------------------------------------------------------------------*/
+// Gives a record to the calling thread, NULL if none could be allocated
+static struct ctk_alloc_stats_record * ctk_alloc_stats_attach(void)
+{
+    pthread_once(&ctk_alloc_stats_once, ctk_alloc_stats_init);
+    struct ctk_alloc_stats_record * record = atomic_load_explicit(
+        &ctk_alloc_stats_records, memory_order_acquire
+    );
+    // Reuse the record of a finished thread first
+    for(; record != NULL; record = record->next) {
+        bool expected = false;
+        if(!atomic_load_explicit(&record->in_use, memory_order_relaxed)
+            && atomic_compare_exchange_strong_explicit(
+                &record->in_use, &expected, true,
+                memory_order_acquire, memory_order_relaxed
+            )) {
+            break;
+        }
+    }
+    if(record == NULL) {
+        record = calloc(1, sizeof(*record));
+        if(record == NULL) {
+            return NULL;
+        }
+        atomic_init(&record->in_use, true);
+        record->next = atomic_load_explicit(
+            &ctk_alloc_stats_records, memory_order_relaxed
+        );
+        while(!atomic_compare_exchange_weak_explicit(
+            &ctk_alloc_stats_records, &record->next, record,
+            memory_order_release, memory_order_relaxed
+        )) {
+            // `record->next` was updated with the current head
+        }
+    }
+    pthread_setspecific(ctk_alloc_stats_key, record);
+    ctk_alloc_stats_self = record;
+    return record;
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_add()
+------------------------------------------------------------------------------*/
+// Only the owning thread writes to a counter, so a plain load and store are
+// enough and no locked instruction is needed
+static void ctk_alloc_stats_add(
+    struct ctk_alloc_stats_record * const record,
+    const size_t stat,
+    const uint64_t value
+)
+{
+    _Atomic uint64_t * const counter = &record->counters[stat];
+    atomic_store_explicit(
+        counter,
+        atomic_load_explicit(counter, memory_order_relaxed) + value,
+        memory_order_relaxed
+    );
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_live()
+------------------------------------------------------------------------------*/
+// Adds `delta` to the live bytes of the calling thread and updates its peak
+static void ctk_alloc_stats_live(
+    struct ctk_alloc_stats_record * const record,
+    const uint64_t delta
+)
+{
+    ctk_alloc_stats_add(record, CTK_ALLOC_STAT_LIVE, delta);
+    const uint64_t live = atomic_load_explicit(
+        &record->counters[CTK_ALLOC_STAT_LIVE], memory_order_relaxed
+    );
+    const uint64_t peak = atomic_load_explicit(
+        &record->counters[CTK_ALLOC_STAT_PEAK], memory_order_relaxed
+    );
+    if((int64_t)live > (int64_t)peak) {
+        atomic_store_explicit(
+            &record->counters[CTK_ALLOC_STAT_PEAK], live, memory_order_relaxed
+        );
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_count()
+------------------------------------------------------------------------------*/
+// Records an allocation of `size` bytes which returned `mem`. `old_mem` and
+// `old_usable` describe the block given to realloc(), if any.
+static void ctk_alloc_stats_count(
+    const enum ctk_alloc_stat call,
+    const size_t size,
+    void * const mem,
+    const uintptr_t old_mem,
+    const size_t old_usable
+)
+{
+    struct ctk_alloc_stats_record * record = ctk_alloc_stats_self;
+    if(record == NULL && (record = ctk_alloc_stats_attach()) == NULL) {
+        return;
+    }
+    ctk_alloc_stats_add(record, call, 1);
+    if(mem == NULL) {
+        ctk_alloc_stats_add(record, CTK_ALLOC_STAT_FAILED, 1);
+        return;
+    }
+    ctk_alloc_stats_add(record, CTK_ALLOC_STAT_BYTES, size);
+    // Bucket `i` counts sizes in `(2^(i - 1), 2^i]`
+    size_t bucket = 0;
+    if(size > 1) {
+        bucket = 64 - (size_t)__builtin_clzll((unsigned long long)size - 1);
+    }
+    if(bucket >= CTK_ALLOC_STATS_BUCKETS) {
+        bucket = CTK_ALLOC_STATS_BUCKETS - 1;
+    }
+    ctk_alloc_stats_add(record, CTK_ALLOC_STAT_HISTOGRAM + bucket, 1);
+    if(old_mem != 0) {
+        ctk_alloc_stats_add(
+            record,
+            (uintptr_t)mem == old_mem
+                ? CTK_ALLOC_STAT_IN_PLACE : CTK_ALLOC_STAT_MOVED,
+            1
+        );
+    }
+    // Unsigned wrap-around turns a shrinking realloc() into a subtraction
+    ctk_alloc_stats_live(
+        record, (uint64_t)malloc_usable_size(mem) - old_usable
+    );
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_free()
+------------------------------------------------------------------------------*/
+// Records a call to ctk_free() which is about to release `mem`
+static void ctk_alloc_stats_free(void * const mem)
+{
+    struct ctk_alloc_stats_record * record = ctk_alloc_stats_self;
+    if(record == NULL && (record = ctk_alloc_stats_attach()) == NULL) {
+        return;
+    }
+    ctk_alloc_stats_add(record, CTK_ALLOC_STAT_FREE, 1);
+    if(mem != NULL) {
+        ctk_alloc_stats_live(record, -(uint64_t)malloc_usable_size(mem));
+    }
+}
+#endif
 /*==============================================================================
     PUBLIC FUNCTION DEFINITION
 ==============================================================================*/
@@ -41,7 +447,15 @@
 void * ctk_malloc(const size_t size)
 {
     CTK_ERROR_RET_NULL_IF(size == 0);
+#if defined(CTK_ALLOC_CACHE)
+    void * const mem = size <= CTK_ALLOC_CACHE_MAX
+        ? ctk_alloc_cache_get(size) : malloc(size);
+#else
     void * const mem = malloc(size);
+#endif
+#if defined(CTK_ALLOC_STATS)
+    ctk_alloc_stats_count(CTK_ALLOC_STAT_MALLOC, size, mem, 0, 0);
+#endif
     /*if(mem == NULL) {
         fputs("malloc() failed!\n", stderr);
     }*/
@@ -54,12 +468,43 @@ void * ctk_calloc(const size_t num, const size_t size)
 {
     CTK_ERROR_RET_NULL_IF(num == 0);
     CTK_ERROR_RET_NULL_IF(size == 0);
+#if defined(CTK_ALLOC_CACHE)
+    const bool cached = num <= CTK_ALLOC_CACHE_MAX / size;
+    void * const mem = cached
+        ? ctk_alloc_cache_get(num * size) : calloc(num, size);
+    if(cached && mem != NULL) {
+        memset(mem, 0, num * size);
+    }
+#else
     void * const mem = calloc(num, size);
+#endif
+#if defined(CTK_ALLOC_STATS)
+    // `num * size` is only used if calloc() succeeded, i.e. didn't overflow
+    ctk_alloc_stats_count(CTK_ALLOC_STAT_CALLOC, num * size, mem, 0, 0);
+#endif
     /*if(mem == NULL) {
         fputs("calloc() failed!\n", stderr);
     }*/
     return mem;
 }
+/*------------------------------------------------------------------------------
+    ctk_aligned_alloc()
+------------------------------------------------------------------------------*/
+void * ctk_aligned_alloc(const size_t alignment, const size_t size)
+{
+    CTK_ERROR_RET_NULL_IF(size == 0);
+    CTK_ERROR_RET_NULL_IF(alignment == 0 || (alignment & (alignment - 1)) != 0);
+    // Aligned blocks bypass the thread caches, which only know the size of a
+    // block
+    void * mem = NULL;
+    if(size <= SIZE_MAX - (alignment - 1)) {
+        mem = aligned_alloc(alignment, CTK_ALIGN_UP(size, alignment));
+    }
+#if defined(CTK_ALLOC_STATS)
+    ctk_alloc_stats_count(CTK_ALLOC_STAT_ALIGNED, size, mem, 0, 0);
+#endif
+    return mem;
+}
 /*------------------------------------------------------------------------------
     ctk_realloc()
 ------------------------------------------------------------------------------*/
@@ -67,7 +512,18 @@ void * (ctk_realloc)(void ** const ptr, const size_t size)
 {
     CTK_ERROR_RET_NULL_IF(size == 0);
     void * const ptr_ = ptr != NULL ? *ptr : NULL;
+#if defined(CTK_ALLOC_STATS)
+    // The old pointer can't be used anymore once realloc() succeeded, only its
+    // address can be compared
+    const uintptr_t old_mem = (uintptr_t)ptr_;
+    const size_t old_usable = ptr_ != NULL ? malloc_usable_size(ptr_) : 0;
+#endif
     void * const mem = realloc(ptr_, size);
+#if defined(CTK_ALLOC_STATS)
+    ctk_alloc_stats_count(
+        CTK_ALLOC_STAT_REALLOC, size, mem, old_mem, old_usable
+    );
+#endif
     if(mem != NULL && ptr != NULL) {
         *ptr = NULL;
     }
@@ -81,6 +537,92 @@ void (ctk_free)(void ** const ptr)
     // free(NULL) is a well-defined behaviour, therefore we only need to ensure
     // we can dereference `ptr`.
     CTK_ERROR_RET_IF(ptr == NULL);
+#if defined(CTK_ALLOC_STATS)
+    ctk_alloc_stats_free(*ptr);
+#endif
+#if defined(CTK_ALLOC_CACHE)
+    if(*ptr != NULL) {
+        ctk_alloc_cache_put(*ptr);
+    }
+#else
     free(*ptr);
+#endif
     *ptr = NULL;
 }
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_snapshot()
+------------------------------------------------------------------------------*/
+int ctk_alloc_stats_snapshot(struct ctk_alloc_stats * const stats)
+{
+    CTK_ERROR_RET_NEG_1_IF(stats == NULL);
+    memset(stats, 0, sizeof(*stats));
+#if defined(CTK_ALLOC_STATS)
+    uint64_t sums[CTK_ALLOC_STAT_COUNT] = {0};
+    const struct ctk_alloc_stats_record * record = atomic_load_explicit(
+        &ctk_alloc_stats_records, memory_order_acquire
+    );
+    for(; record != NULL; record = record->next) {
+        for(size_t i = 0; i < CTK_ALLOC_STAT_COUNT; i++) {
+            sums[i] += atomic_load_explicit(
+                &record->counters[i], memory_order_relaxed
+            );
+        }
+    }
+    stats->malloc_calls = sums[CTK_ALLOC_STAT_MALLOC];
+    stats->calloc_calls = sums[CTK_ALLOC_STAT_CALLOC];
+    stats->aligned_calls = sums[CTK_ALLOC_STAT_ALIGNED];
+    stats->realloc_calls = sums[CTK_ALLOC_STAT_REALLOC];
+    stats->free_calls = sums[CTK_ALLOC_STAT_FREE];
+    stats->failed_calls = sums[CTK_ALLOC_STAT_FAILED];
+    stats->bytes = sums[CTK_ALLOC_STAT_BYTES];
+    stats->live_bytes = (int64_t)sums[CTK_ALLOC_STAT_LIVE];
+    stats->peak_bytes = sums[CTK_ALLOC_STAT_PEAK];
+    stats->realloc_in_place = sums[CTK_ALLOC_STAT_IN_PLACE];
+    stats->realloc_moved = sums[CTK_ALLOC_STAT_MOVED];
+    for(size_t i = 0; i < CTK_ALLOC_STATS_BUCKETS; i++) {
+        stats->histogram[i] = sums[CTK_ALLOC_STAT_HISTOGRAM + i];
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_alloc_stats_dump()
+------------------------------------------------------------------------------*/
+int ctk_alloc_stats_dump(FILE * const stream)
+{
+    CTK_ERROR_RET_NEG_1_IF(stream == NULL);
+    struct ctk_alloc_stats stats;
+    if(ctk_alloc_stats_snapshot(&stats) != 0) {
+        return -1;
+    }
+    int ret = fprintf(stream,
+        "malloc:   %" PRIu64 "\n"
+        "calloc:   %" PRIu64 "\n"
+        "aligned:  %" PRIu64 "\n"
+        "realloc:  %" PRIu64 " (in place: %" PRIu64 ", moved: %" PRIu64 ")\n"
+        "free:     %" PRIu64 "\n"
+        "failed:   %" PRIu64 "\n"
+        "bytes:    %" PRIu64 "\n"
+        "live:     %" PRId64 "\n"
+        "peak:     %" PRIu64 "\n"
+        "sizes:\n",
+        stats.malloc_calls, stats.calloc_calls, stats.aligned_calls,
+        stats.realloc_calls, stats.realloc_in_place, stats.realloc_moved,
+        stats.free_calls, stats.failed_calls,
+        stats.bytes, stats.live_bytes, stats.peak_bytes
+    );
+    // Only non-empty buckets are printed, the last one has no upper bound
+    for(size_t i = 0; ret >= 0 && i < CTK_ALLOC_STATS_BUCKETS; i++) {
+        if(stats.histogram[i] == 0) {
+            continue;
+        }
+        const bool last = i == CTK_ALLOC_STATS_BUCKETS - 1;
+        ret = fprintf(stream, "  %-2s %-10" PRIu64 " %" PRIu64 "\n",
+            last ? ">" : "<=", UINT64_C(1) << (last ? i - 1 : i),
+            stats.histogram[i]
+        );
+    }
+    return ret >= 0 ? 0 : -1;
+}
@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+// Must be defined before including any header: expose MAP_ANONYMOUS,
+// MAP_POPULATE, MADV_HUGEPAGE and mremap()
+#define _GNU_SOURCE
+#include "ctk_platform.h"
+// Own header
+#include "ctk_alloc.h"
+// C Standard Library
+#include <stdbool.h>
+#include <stddef.h> // size_t, NULL
+#include <stdint.h> // SIZE_MAX, uintptr_t
+#include <string.h> // memcpy(), memset()
+#if defined(CTK_POSIX)
+    // POSIX
+    #include <sys/mman.h> // madvise(), mmap(), munmap(), GNU mremap()
+    #if defined(MAP_ANONYMOUS)
+        #define CTK_MMAP 1
+    #endif
+#endif
+// Internal
+#include "ctk_error.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// All the values of enum ctk_mmap_flag
+#define CTK_MMAP_FLAGS (CTK_MMAP_HUGE | CTK_MMAP_POPULATE)
+// Bytes before a block, keeping it aligned on a cache line
+#define CTK_MMAP_HEADER \
+    CTK_ALIGN_UP(sizeof(struct ctk_mmap_header), CTK_CACHE_LINE_SIZE)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+// Start of a mapping, right before the block
+struct ctk_mmap_header {
+    size_t length;      // Bytes mapped, header included
+    unsigned int flags; // Flags given to ctk_mmap_alloc()
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_mmap_header()
+------------------------------------------------------------------------------*/
+static struct ctk_mmap_header * ctk_mmap_header(void * const block)
+{
+    return (struct ctk_mmap_header *)((unsigned char *)block - CTK_MMAP_HEADER);
+}
+/*------------------------------------------------------------------------------
+    ctk_mmap_length()
+------------------------------------------------------------------------------*/
+// Bytes to map for a block of `size` bytes, 0 if it overflows
+static size_t ctk_mmap_length(const size_t size)
+{
+    const size_t page = ctk_page_size();
+    if(size > SIZE_MAX - CTK_MMAP_HEADER - page) {
+        return 0;
+    }
+    return CTK_ALIGN_UP(CTK_MMAP_HEADER + size, page);
+}
+#if defined(CTK_MMAP)
+/*------------------------------------------------------------------------------
+    ctk_mmap_populate()
+------------------------------------------------------------------------------*/
+// Faults in the pages of `[mem, mem + length)`
+static void ctk_mmap_populate(unsigned char * const mem, const size_t length)
+{
+    #if defined(MADV_POPULATE_WRITE)
+    // Linux >= 5.14
+    if(madvise(mem, length, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+    #endif
+    const size_t page = ctk_page_size();
+    for(size_t i = 0; i < length; i += page) {
+        // Anonymous pages are zero already, the write only faults them in
+        ((volatile unsigned char *)mem)[i] = 0;
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_mmap_map()
+------------------------------------------------------------------------------*/
+// Maps `length` zeroed bytes, on a huge page boundary if `flags` asks for huge
+// pages and `length` can hold one
+static unsigned char * ctk_mmap_map(
+    const size_t length, const unsigned int flags
+)
+{
+    const bool huge_pages = (flags & CTK_MMAP_HUGE) != 0;
+    const bool populate = (flags & CTK_MMAP_POPULATE) != 0;
+    const size_t huge = huge_pages ? ctk_huge_page_size() : 0;
+    const size_t page = ctk_page_size();
+    // Room to move the start of the mapping to a huge page boundary
+    const size_t extra = huge > page && length >= huge ? huge - page : 0;
+    if(length > SIZE_MAX - extra) {
+        return NULL;
+    }
+    int map_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    bool populated = false;
+    #if defined(MAP_POPULATE)
+    // Pages faulted in before madvise(MADV_HUGEPAGE) wouldn't be huge ones
+    if(populate && !huge_pages) {
+        map_flags |= MAP_POPULATE;
+        populated = true;
+    }
+    #endif
+    unsigned char * const raw = mmap(
+        NULL, length + extra, PROT_READ | PROT_WRITE, map_flags, -1, 0
+    );
+    if(raw == MAP_FAILED) {
+        return NULL;
+    }
+    unsigned char * const mem =
+        raw + (CTK_ALIGN_UP((uintptr_t)raw, extra + page) - (uintptr_t)raw);
+    // Give the unused room back on both sides
+    if(mem != raw) {
+        munmap(raw, (size_t)(mem - raw));
+    }
+    if(mem + length != raw + length + extra) {
+        munmap(mem + length, (size_t)(raw + extra - mem));
+    }
+    #if defined(MADV_HUGEPAGE)
+    if(huge_pages) {
+        // Only a hint: fails if the kernel has no transparent huge pages
+        (void)madvise(mem, length, MADV_HUGEPAGE);
+    }
+    #endif
+    if(populate && !populated) {
+        ctk_mmap_populate(mem, length);
+    }
+    return mem;
+}
+/*------------------------------------------------------------------------------
+    ctk_mmap_unmap()
+------------------------------------------------------------------------------*/
+static void ctk_mmap_unmap(unsigned char * const mem, const size_t length)
+{
+    munmap(mem, length);
+}
+#else
+/*------------------------------------------------------------------------------
+    ctk_mmap_map()
+------------------------------------------------------------------------------*/
+// Without mmap(), blocks come from the heap and the flags are ignored
+static unsigned char * ctk_mmap_map(
+    const size_t length, const unsigned int flags
+)
+{
+    (void)flags;
+    unsigned char * const mem = ctk_aligned_alloc(CTK_CACHE_LINE_SIZE, length);
+    if(mem != NULL) {
+        memset(mem, 0, length);
+    }
+    return mem;
+}
+/*------------------------------------------------------------------------------
+    ctk_mmap_unmap()
+------------------------------------------------------------------------------*/
+static void ctk_mmap_unmap(unsigned char * mem, const size_t length)
+{
+    (void)length;
+    ctk_free(&mem);
+}
+#endif
+/*==============================================================================
+    PUBLIC FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_mmap_alloc()
+------------------------------------------------------------------------------*/
+void * ctk_mmap_alloc(const size_t size, const unsigned int flags)
+{
+    CTK_ERROR_RET_NULL_IF(size == 0);
+    CTK_ERROR_RET_NULL_IF((flags & ~(unsigned int)CTK_MMAP_FLAGS) != 0);
+    const size_t length = ctk_mmap_length(size);
+    if(length == 0) {
+        return NULL;
+    }
+    unsigned char * const mem = ctk_mmap_map(length, flags);
+    if(mem == NULL) {
+        return NULL;
+    }
+    struct ctk_mmap_header * const header = (struct ctk_mmap_header *)mem;
+    header->length = length;
+    header->flags = flags;
+    return mem + CTK_MMAP_HEADER;
+}
+/*------------------------------------------------------------------------------
+    ctk_mmap_realloc()
+------------------------------------------------------------------------------*/
+void * (ctk_mmap_realloc)(void ** const ptr, const size_t size)
+{
+    CTK_ERROR_RET_NULL_IF(size == 0);
+    if(ptr == NULL || *ptr == NULL) {
+        return ctk_mmap_alloc(size, 0);
+    }
+    struct ctk_mmap_header * const header = ctk_mmap_header(*ptr);
+    const size_t old_length = header->length;
+    const unsigned int flags = header->flags;
+    const size_t length = ctk_mmap_length(size);
+    if(length == 0) {
+        return NULL;
+    }
+#if defined(CTK_MMAP) && defined(MREMAP_MAYMOVE)
+    // The kernel moves the page table entries, the content is never copied
+    unsigned char * const mem = mremap(
+        header, old_length, length, MREMAP_MAYMOVE
+    );
+    if(mem == MAP_FAILED) {
+        return NULL;
+    }
+    if(length > old_length && (flags & CTK_MMAP_POPULATE) != 0) {
+        ctk_mmap_populate(mem + old_length, length - old_length);
+    }
+#else
+    unsigned char * const mem = ctk_mmap_map(length, flags);
+    if(mem == NULL) {
+        return NULL;
+    }
+    memcpy(mem + CTK_MMAP_HEADER, *ptr,
+        (old_length < length ? old_length : length) - CTK_MMAP_HEADER);
+    ctk_mmap_unmap((unsigned char *)header, old_length);
+#endif
+    struct ctk_mmap_header * const new_header = (struct ctk_mmap_header *)mem;
+    new_header->length = length;
+    new_header->flags = flags;
+    *ptr = NULL;
+    return mem + CTK_MMAP_HEADER;
+}
+/*------------------------------------------------------------------------------
+    ctk_mmap_free()
+------------------------------------------------------------------------------*/
+void (ctk_mmap_free)(void ** const ptr)
+{
+    CTK_ERROR_RET_IF(ptr == NULL);
+    if(*ptr != NULL) {
+        struct ctk_mmap_header * const header = ctk_mmap_header(*ptr);
+        ctk_mmap_unmap((unsigned char *)header, header->length);
+    }
+    *ptr = NULL;
+}
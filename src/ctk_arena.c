@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "ctk_arena.h"
+// C Standard Library
+#include <stdalign.h> // alignas, alignof
+#include <stddef.h>   // max_align_t, NULL, size_t
+#include <stdint.h>   // SIZE_MAX, uintptr_t
+#include <string.h>   // memset()
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_error.h"
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct ctk_arena_chunk {
+    struct ctk_arena_chunk * next; // Next chunk, reused after a reset/restore
+    size_t capacity;               // Size of `data`
+    size_t used;                   // Bytes of `data` already handed out
+    alignas(max_align_t) unsigned char data[];
+};
+struct ctk_arena {
+    struct ctk_arena_chunk * first;   // Head of the list of chunks
+    struct ctk_arena_chunk * current; // Chunk allocations are carved from
+    size_t chunk_size;                // Minimum capacity of a new chunk
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_arena_chunk_create()
+------------------------------------------------------------------------------*/
+static struct ctk_arena_chunk * ctk_arena_chunk_create(const size_t capacity)
+{
+    if(capacity > SIZE_MAX - sizeof(struct ctk_arena_chunk)) {
+        return NULL;
+    }
+    struct ctk_arena_chunk * const chunk =
+        ctk_malloc(sizeof(*chunk) + capacity);
+    if(chunk == NULL) {
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    return chunk;
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_chunk_fit()
+------------------------------------------------------------------------------*/
+// Offset in `chunk` of `size` bytes aligned on `alignment`, or SIZE_MAX if the
+// chunk is too full
+static size_t ctk_arena_chunk_fit(
+    const struct ctk_arena_chunk * const chunk,
+    const size_t size, const size_t alignment
+)
+{
+    const uintptr_t addr = (uintptr_t)(chunk->data + chunk->used);
+    const size_t padding = (size_t)(-addr & (alignment - 1));
+    const size_t available = chunk->capacity - chunk->used;
+    if(padding > available || size > available - padding) {
+        return SIZE_MAX;
+    }
+    return chunk->used + padding;
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_arena_create()
+------------------------------------------------------------------------------*/
+struct ctk_arena * ctk_arena_create(const size_t chunk_size)
+{
+    CTK_ERROR_RET_NULL_IF(chunk_size == 0);
+    struct ctk_arena * arena = ctk_malloc(sizeof(*arena));
+    if(arena == NULL) {
+        return NULL;
+    }
+    arena->first = ctk_arena_chunk_create(chunk_size);
+    if(arena->first == NULL) {
+        ctk_free(&arena);
+        return NULL;
+    }
+    arena->current = arena->first;
+    arena->chunk_size = chunk_size;
+    return arena;
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_destroy()
+------------------------------------------------------------------------------*/
+void ctk_arena_destroy(struct ctk_arena ** const arena)
+{
+    CTK_ERROR_RET_IF(arena == NULL);
+    if(*arena == NULL) {
+        return;
+    }
+    struct ctk_arena_chunk * chunk = (*arena)->first;
+    while(chunk != NULL) {
+        struct ctk_arena_chunk * next = chunk->next;
+        ctk_free(&chunk);
+        chunk = next;
+    }
+    ctk_free(arena);
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_alloc()
+------------------------------------------------------------------------------*/
+void * ctk_arena_alloc(struct ctk_arena * const arena, const size_t size)
+{
+    return ctk_arena_alloc_aligned(arena, size, alignof(max_align_t));
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_alloc_aligned()
+------------------------------------------------------------------------------*/
+void * ctk_arena_alloc_aligned(
+    struct ctk_arena * const arena, const size_t size, const size_t alignment
+)
+{
+    CTK_ERROR_RET_NULL_IF(arena == NULL);
+    CTK_ERROR_RET_NULL_IF(size == 0);
+    CTK_ERROR_RET_NULL_IF(alignment == 0);
+    CTK_ERROR_RET_NULL_IF((alignment & (alignment - 1)) != 0);
+    struct ctk_arena_chunk * chunk = arena->current;
+    size_t offset = ctk_arena_chunk_fit(chunk, size, alignment);
+    // Chunks following the current one are left over by a reset/restore: reuse
+    // them before allocating a new one
+    while(offset == SIZE_MAX && chunk->next != NULL) {
+        chunk = chunk->next;
+        chunk->used = 0;
+        offset = ctk_arena_chunk_fit(chunk, size, alignment);
+    }
+    if(offset == SIZE_MAX) {
+        if(size > SIZE_MAX - (alignment - 1)) {
+            return NULL;
+        }
+        const size_t needed = size + (alignment - 1);
+        struct ctk_arena_chunk * const new = ctk_arena_chunk_create(
+            needed > arena->chunk_size ? needed : arena->chunk_size
+        );
+        if(new == NULL) {
+            return NULL;
+        }
+        chunk->next = new;
+        chunk = new;
+        offset = ctk_arena_chunk_fit(chunk, size, alignment);
+    }
+    chunk->used = offset + size;
+    arena->current = chunk;
+    return chunk->data + offset;
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_calloc()
+------------------------------------------------------------------------------*/
+void * ctk_arena_calloc(
+    struct ctk_arena * const arena, const size_t num, const size_t size
+)
+{
+    CTK_ERROR_RET_NULL_IF(num == 0);
+    CTK_ERROR_RET_NULL_IF(size == 0);
+    if(num > SIZE_MAX / size) {
+        return NULL;
+    }
+    void * const mem = ctk_arena_alloc(arena, num * size);
+    if(mem == NULL) {
+        return NULL;
+    }
+    return memset(mem, 0, num * size);
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_reset()
+------------------------------------------------------------------------------*/
+void ctk_arena_reset(struct ctk_arena * const arena)
+{
+    CTK_ERROR_RET_IF(arena == NULL);
+    arena->current = arena->first;
+    arena->current->used = 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_save()
+------------------------------------------------------------------------------*/
+struct ctk_arena_marker ctk_arena_save(const struct ctk_arena * const arena)
+{
+    CTK_ERROR_RET_VAL_IF(arena == NULL, ((struct ctk_arena_marker){NULL, 0}));
+    return (struct ctk_arena_marker){arena->current, arena->current->used};
+}
+/*------------------------------------------------------------------------------
+    ctk_arena_restore()
+------------------------------------------------------------------------------*/
+void ctk_arena_restore(
+    struct ctk_arena * const arena, const struct ctk_arena_marker marker
+)
+{
+    CTK_ERROR_RET_IF(arena == NULL);
+    CTK_ERROR_RET_IF(marker.chunk == NULL);
+    arena->current = marker.chunk;
+    arena->current->used = marker.used;
+}
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_ascii.h"
+// C Standard Library
+#include <limits.h>  // CHAR_BIT, UCHAR_MAX
+#include <stdbool.h>
+#include <stddef.h>  // NULL, size_t
+// SIMD
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+// Internal
+#include "ctk_error.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Entries of the table
+#define CTK_ASCII_SP CTK_ASCII_SPACE
+#define CTK_ASCII_PU CTK_ASCII_PUNCT
+#define CTK_ASCII_DG (CTK_ASCII_DIGIT | CTK_ASCII_HEX)
+#define CTK_ASCII_UH (CTK_ASCII_ALPHA | CTK_ASCII_UPPER | CTK_ASCII_HEX)
+#define CTK_ASCII_UP (CTK_ASCII_ALPHA | CTK_ASCII_UPPER)
+#define CTK_ASCII_LH (CTK_ASCII_ALPHA | CTK_ASCII_LOWER | CTK_ASCII_HEX)
+#define CTK_ASCII_LO (CTK_ASCII_ALPHA | CTK_ASCII_LOWER)
+// Bytes compared at once by the whitespace scans
+#define CTK_ASCII_BLOCK 16
+/*==============================================================================
+    PUBLIC VARIABLE
+==============================================================================*/
+// Each initializer lists consecutive characters from the designated one, the
+// missing entries(control characters, bytes > 0x7F) are 0
+const unsigned char ctk_ascii_table[UCHAR_MAX + 1] = {
+    // '\t' '\n' '\v' '\f' '\r'
+    ['\t'] = CTK_ASCII_SP, CTK_ASCII_SP, CTK_ASCII_SP, CTK_ASCII_SP,
+    CTK_ASCII_SP,
+    [' '] = CTK_ASCII_SP,
+    // ! " # $ % & ' ( ) * + , - . /
+    ['!'] = CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+    CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+    CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+    CTK_ASCII_PU,
+    // 0-9
+    ['0'] = CTK_ASCII_DG, CTK_ASCII_DG, CTK_ASCII_DG, CTK_ASCII_DG,
+    CTK_ASCII_DG, CTK_ASCII_DG, CTK_ASCII_DG, CTK_ASCII_DG, CTK_ASCII_DG,
+    CTK_ASCII_DG,
+    // : ; < = > ? @
+    [':'] = CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+    CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+    // A-F, G-Z
+    ['A'] = CTK_ASCII_UH, CTK_ASCII_UH, CTK_ASCII_UH, CTK_ASCII_UH,
+    CTK_ASCII_UH, CTK_ASCII_UH,
+    ['G'] = CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP,
+    CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP,
+    CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP,
+    CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP, CTK_ASCII_UP,
+    CTK_ASCII_UP,
+    // [ \ ] ^ _ `
+    ['['] = CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+    CTK_ASCII_PU, CTK_ASCII_PU,
+    // a-f, g-z
+    ['a'] = CTK_ASCII_LH, CTK_ASCII_LH, CTK_ASCII_LH, CTK_ASCII_LH,
+    CTK_ASCII_LH, CTK_ASCII_LH,
+    ['g'] = CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO,
+    CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO,
+    CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO,
+    CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO, CTK_ASCII_LO,
+    CTK_ASCII_LO,
+    // { | } ~
+    ['{'] = CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU, CTK_ASCII_PU,
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+// __SSE2__ is only defined by compilers with the GCC bit scan builtins
+#if defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_ascii_other_mask()
+------------------------------------------------------------------------------*/
+// Bit `i` is set if the byte `i` of `block` isn't a whitespace. Whitespaces
+// are ' ' and the five characters from '\t' to '\r': a byte minus '\t' which
+// is unsigned-less or equal to 4.
+static unsigned int ctk_ascii_other_mask(const char * const block)
+{
+    const __m128i bytes = _mm_loadu_si128((const void *)block);
+    const __m128i control = _mm_sub_epi8(bytes, _mm_set1_epi8('\t'));
+    const __m128i is_control = _mm_cmpeq_epi8(
+        _mm_min_epu8(control, _mm_set1_epi8('\r' - '\t')), control
+    );
+    const __m128i is_space = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '));
+    return ~(unsigned int)_mm_movemask_epi8(_mm_or_si128(is_control, is_space))
+        & 0xFFFFU;
+}
+/*------------------------------------------------------------------------------
+    ctk_ascii_end()
+------------------------------------------------------------------------------*/
+// Index of the highest set bit of a non-zero mask, plus one
+static size_t ctk_ascii_end(const unsigned int mask)
+{
+    return sizeof(mask) * CHAR_BIT - (size_t)__builtin_clz(mask);
+}
+#endif
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_ascii_is()
+------------------------------------------------------------------------------*/
+bool ctk_ascii_is(const int c, const int classes)
+{
+    if(c < 0 || c > UCHAR_MAX) {
+        return false;
+    }
+    return CTK_ASCII_IS(c, classes);
+}
+/*------------------------------------------------------------------------------
+    ctk_ascii_tolower()
+------------------------------------------------------------------------------*/
+int ctk_ascii_tolower(const int c)
+{
+    if(c < 0 || c > UCHAR_MAX) {
+        return c;
+    }
+    return CTK_ASCII_TOLOWER(c);
+}
+/*------------------------------------------------------------------------------
+    ctk_ascii_toupper()
+------------------------------------------------------------------------------*/
+int ctk_ascii_toupper(const int c)
+{
+    if(c < 0 || c > UCHAR_MAX) {
+        return c;
+    }
+    return CTK_ASCII_TOUPPER(c);
+}
+/*------------------------------------------------------------------------------
+    ctk_ascii_triml()
+------------------------------------------------------------------------------*/
+size_t ctk_ascii_triml(const char * const str, const size_t length)
+{
+    CTK_ERROR_RET_0_IF(str == NULL && length != 0);
+    size_t i = 0;
+#if defined(__SSE2__)
+    if(length >= CTK_ASCII_BLOCK) {
+        for(; length - i >= CTK_ASCII_BLOCK; i += CTK_ASCII_BLOCK) {
+            const unsigned int other = ctk_ascii_other_mask(str + i);
+            if(other != 0) {
+                return i + (size_t)__builtin_ctz(other);
+            }
+        }
+        // The last block overlaps whitespaces already skipped
+        const unsigned int other =
+            ctk_ascii_other_mask(str + length - CTK_ASCII_BLOCK);
+        if(other != 0) {
+            return length - CTK_ASCII_BLOCK + (size_t)__builtin_ctz(other);
+        }
+        return length;
+    }
+#endif
+    while(i < length && CTK_ASCII_IS(str[i], CTK_ASCII_SPACE)) {
+        i++;
+    }
+    return i;
+}
+/*------------------------------------------------------------------------------
+    ctk_ascii_trimr()
+------------------------------------------------------------------------------*/
+size_t ctk_ascii_trimr(const char * const str, size_t length)
+{
+    CTK_ERROR_RET_0_IF(str == NULL && length != 0);
+#if defined(__SSE2__)
+    if(length >= CTK_ASCII_BLOCK) {
+        for(; length >= CTK_ASCII_BLOCK; length -= CTK_ASCII_BLOCK) {
+            const unsigned int other =
+                ctk_ascii_other_mask(str + length - CTK_ASCII_BLOCK);
+            if(other != 0) {
+                return length - CTK_ASCII_BLOCK + ctk_ascii_end(other);
+            }
+        }
+        // The first block overlaps whitespaces already skipped
+        const unsigned int other = ctk_ascii_other_mask(str);
+        if(other != 0) {
+            return ctk_ascii_end(other);
+        }
+        return 0;
+    }
+#endif
+    while(length > 0 && CTK_ASCII_IS(str[length - 1], CTK_ASCII_SPACE)) {
+        length--;
+    }
+    return length;
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Private access to the CPU features for the kernels of the library.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_CPU_H_20261018150212
+#define CTK_CPU_H_20261018150212
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+/*==============================================================================
+    FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_cpu_probe()
+------------------------------------------------------------------------------*/
+/**
+ * Same as ctk_cpu_detect() but hidden from other objects.
+ *
+ * - The #CTK_DISPATCH() resolvers of the library must call it instead of
+ *   ctk_cpu_detect(): a hidden function is called directly, not through the
+ *   PLT which may not be relocated yet when the resolvers run.
+ *
+ * @return The features of the CPU.
+ */
+#if defined(__GNUC__)
+__attribute__((visibility("hidden")))
+#endif
+struct ctk_cpu_features ctk_cpu_probe(void);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_CPU_H_20261018150212
@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_error.h"
+// C Standard Library
+#include <errno.h>     // errno, EINTR
+#include <inttypes.h>  // PRIu64
+#include <stdatomic.h> // atomic_signal_fence()
+#include <stddef.h>    // NULL, size_t
+#include <stdint.h>    // int64_t, uint64_t
+#include <stdio.h>     // FILE, fprintf()
+#include <string.h>    // strlen()
+#if defined(CTK_POSIX)
+    #include <unistd.h> // ssize_t, write()
+#endif
+// Internal
+#include "ctk_time.h"
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+#if defined(CTK_ERROR_RING)
+// Last failures of a thread: `events[head % CTK_ERROR_RING_CAPACITY]` is the
+// next slot written and `events[tail % CTK_ERROR_RING_CAPACITY]` the oldest
+// event not drained yet
+struct ctk_error_ring {
+    struct ctk_error_event events[CTK_ERROR_RING_CAPACITY];
+    uint64_t head; // Number of events pushed
+    uint64_t tail; // Number of events drained or overwritten
+    uint64_t lost; // Number of events overwritten before being drained
+};
+#endif
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+#if defined(CTK_ERROR_SITES)
+// Bounds of the `ctk_error_site_table` section, provided by the linker. They
+// are weak since the section doesn't exist if no check is compiled, and hidden
+// so they always refer to the section of the library.
+extern struct ctk_error_site * __start_ctk_error_site_table[]
+    __attribute__((weak, visibility("hidden")));
+extern struct ctk_error_site * __stop_ctk_error_site_table[]
+    __attribute__((weak, visibility("hidden")));
+#endif
+#if defined(CTK_ERROR_RING)
+static _Thread_local struct ctk_error_ring ctk_error_ring;
+#endif
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+#if defined(CTK_ERROR_RING) && defined(CTK_POSIX)
+/*------------------------------------------------------------------------------
+    ctk_error_write()
+------------------------------------------------------------------------------*/
+// Writes `len` bytes of `buf` to `fd`, retrying on partial writes and signals.
+// Returns `0` on success, `-1` otherwise.
+static int ctk_error_write(const int fd, const char * buf, size_t len)
+{
+    while(len > 0) {
+        const ssize_t written = write(fd, buf, len);
+        if(written < 0 && errno == EINTR) {
+            continue;
+        }
+        if(written <= 0) {
+            return -1;
+        }
+        buf += written;
+        len -= (size_t)written;
+    }
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_error_write_str()
+------------------------------------------------------------------------------*/
+static int ctk_error_write_str(const int fd, const char * const str)
+{
+    return ctk_error_write(fd, str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_error_write_int()
+------------------------------------------------------------------------------*/
+// Writes `value` in decimal to `fd` without using `printf()`, which isn't
+// async-signal-safe.
+static int ctk_error_write_int(const int fd, const int64_t value)
+{
+    char digits[sizeof("-9223372036854775808")];
+    size_t start = sizeof(digits);
+    // Negating INT64_MIN overflows, so work on the unsigned magnitude
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    do {
+        digits[--start] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while(magnitude > 0);
+    if(value < 0) {
+        digits[--start] = '-';
+    }
+    return ctk_error_write(fd, digits + start, sizeof(digits) - start);
+}
+#endif
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_error_sites()
+------------------------------------------------------------------------------*/
+struct ctk_error_site * const * ctk_error_sites(size_t * const count)
+{
+    CTK_ERROR_RET_NULL_IF(count == NULL);
+#if defined(CTK_ERROR_SITES)
+    *count = (size_t)(
+        __stop_ctk_error_site_table - __start_ctk_error_site_table
+    );
+    return *count > 0 ? __start_ctk_error_site_table : NULL;
+#else
+    *count = 0;
+    return NULL;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_error_sites_dump()
+------------------------------------------------------------------------------*/
+int ctk_error_sites_dump(FILE * const stream)
+{
+    CTK_ERROR_RET_NEG_1_IF(stream == NULL);
+    size_t count = 0;
+    struct ctk_error_site * const * const sites = ctk_error_sites(&count);
+    int printed = 0;
+    for(size_t i = 0; i < count; i++) {
+        const uint64_t hits = sites[i]->hits;
+        if(hits == 0) {
+            continue;
+        }
+        if(fprintf(stream, "%s:%d: %s(): %s: %" PRIu64 "\n", sites[i]->file,
+            sites[i]->line, sites[i]->function, sites[i]->cond, hits) < 0) {
+            return -1;
+        }
+        printed++;
+    }
+    return printed;
+}
+/*------------------------------------------------------------------------------
+    ctk_error_sites_reset()
+------------------------------------------------------------------------------*/
+void ctk_error_sites_reset(void)
+{
+    size_t count = 0;
+    struct ctk_error_site * const * const sites = ctk_error_sites(&count);
+    for(size_t i = 0; i < count; i++) {
+        sites[i]->hits = 0;
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_error_ring_push()
+------------------------------------------------------------------------------*/
+void ctk_error_ring_push(const struct ctk_error_site * const site)
+{
+#if defined(CTK_ERROR_RING)
+    // Reading the clock may clobber errno, which the caller may still need
+    const int errnum = errno;
+    const int64_t time_ns = ctk_time_realtime_ns();
+    struct ctk_error_ring * const ring = &ctk_error_ring;
+    // When full, the oldest event leaves the ring before its slot is reused:
+    // a signal handler dumping the ring never reads a slot being written
+    if(ring->head - ring->tail == CTK_ERROR_RING_CAPACITY) {
+        ring->tail++;
+        ring->lost++;
+    }
+    atomic_signal_fence(memory_order_release);
+    struct ctk_error_event * const event =
+        &ring->events[ring->head % CTK_ERROR_RING_CAPACITY];
+    event->site = site;
+    event->time_ns = time_ns;
+    event->errnum = errnum;
+    // Nor the new head before the event is complete
+    atomic_signal_fence(memory_order_release);
+    ring->head++;
+    errno = errnum;
+#else
+    (void)site;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_error_ring_drain()
+------------------------------------------------------------------------------*/
+size_t ctk_error_ring_drain(
+    struct ctk_error_event * const events, const size_t capacity
+)
+{
+    CTK_ERROR_RET_0_IF(events == NULL && capacity > 0);
+#if defined(CTK_ERROR_RING)
+    struct ctk_error_ring * const ring = &ctk_error_ring;
+    const uint64_t available = ring->head - ring->tail;
+    const size_t count = available < capacity ? (size_t)available : capacity;
+    for(size_t i = 0; i < count; i++) {
+        events[i] = ring->events[(ring->tail + i) % CTK_ERROR_RING_CAPACITY];
+    }
+    ring->tail += count;
+    return count;
+#else
+    return 0;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_error_ring_dump()
+------------------------------------------------------------------------------*/
+int ctk_error_ring_dump(const int fd)
+{
+    CTK_ERROR_RET_NEG_1_IF(fd < 0);
+#if defined(CTK_ERROR_RING) && defined(CTK_POSIX)
+    const struct ctk_error_ring * const ring = &ctk_error_ring;
+    const uint64_t head = ring->head;
+    atomic_signal_fence(memory_order_acquire);
+    const uint64_t tail = ring->tail;
+    const uint64_t count = head - tail;
+    if(ctk_error_write_str(fd, "ctk_error_ring: ") != 0
+        || ctk_error_write_int(fd, (int64_t)count) != 0
+        || ctk_error_write_str(fd, " events, ") != 0
+        || ctk_error_write_int(fd, (int64_t)ring->lost) != 0
+        || ctk_error_write_str(fd, " lost\n") != 0) {
+        return -1;
+    }
+    for(uint64_t i = tail; i < head; i++) {
+        const struct ctk_error_event * const event =
+            &ring->events[i % CTK_ERROR_RING_CAPACITY];
+        const struct ctk_error_site * const site = event->site;
+        if(ctk_error_write_int(fd, event->time_ns) != 0
+            || ctk_error_write_str(fd, " ") != 0
+            || ctk_error_write_str(fd, site->file) != 0
+            || ctk_error_write_str(fd, ":") != 0
+            || ctk_error_write_int(fd, site->line) != 0
+            || ctk_error_write_str(fd, ": ") != 0
+            || ctk_error_write_str(fd, site->function) != 0
+            || ctk_error_write_str(fd, "(): ") != 0
+            || ctk_error_write_str(fd, site->cond) != 0
+            || ctk_error_write_str(fd, ": errno ") != 0
+            || ctk_error_write_int(fd, event->errnum) != 0
+            || ctk_error_write_str(fd, "\n") != 0) {
+            return -1;
+        }
+    }
+    return (int)count;
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,702 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_hashmap.h"
+// C Standard Library
+#include <stdalign.h> // alignof
+#include <stddef.h>   // max_align_t, NULL, size_t
+#include <stdint.h>   // SIZE_MAX, UINT64_C, uint64_t
+#include <string.h>   // memcmp(), memcpy(), memset(), strcmp()
+// SIMD
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_error.h"
+#include "ctk_string.h"
+#include "ctk_string_hash.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Control byte of an empty slot, full slots hold the 7 high bits of the hash
+// of their key and never have the high bit set
+#define CTK_HASHMAP_EMPTY 0x80
+// Maximum number of keys per group before the map grows, i.e. a load factor
+// of 7/8
+#define CTK_HASHMAP_GROUP_LOAD 14
+// Inline the whole lookup in the public functions: a call per step would
+// limit how many lookups the CPU overlaps
+#if defined(__GNUC__)
+    #define CTK_HASHMAP_FLATTEN __attribute__((flatten))
+#else
+    #define CTK_HASHMAP_FLATTEN
+#endif
+// Overflow counters stick to this value, the keys which overflowed can then
+// only be forgotten by a rehash
+#define CTK_HASHMAP_OVERFLOW_MAX 255
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct ctk_hashmap {
+    unsigned char * ctrl;     // Control byte of each slot
+    unsigned char * overflow; // Number of keys which probed past each group
+    unsigned char * slots;    // Keys and values
+    size_t groups;            // Number of groups, a power of two or 0
+    size_t size;              // Number of keys
+    size_t key_size;          // Bytes copied for a key
+    size_t value_offset;      // Offset of the value in a slot
+    size_t value_size;
+    size_t stride;            // Distance between two slots
+    size_t word;              // Size of keys compared as integers, or 0
+    enum ctk_hashmap_keys keys;
+    ctk_hashmap_hash_fn * hash; // NULL for the built-in hash
+    ctk_hashmap_eq_fn * eq;     // NULL for the built-in comparison
+    void * ctx;
+    ctk_hashmap_alloc_fn * alloc;
+    ctk_hashmap_free_fn * free;
+    void * alloc_ctx;
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hashmap_malloc()
+------------------------------------------------------------------------------*/
+// Default allocation functions
+static void * ctk_hashmap_malloc(const size_t size, void * const ctx)
+{
+    (void)ctx;
+    return ctk_malloc(size);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_mfree()
+------------------------------------------------------------------------------*/
+static void ctk_hashmap_mfree(void * ptr, void * const ctx)
+{
+    (void)ctx;
+    ctk_free(&ptr);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_align()
+------------------------------------------------------------------------------*/
+// Alignment of the types of `size` bytes: the largest power of two dividing
+// it, up to the alignment of max_align_t
+static size_t ctk_hashmap_align(const size_t size)
+{
+    const size_t low = size & (~size + 1);
+    if(low == 0 || low > alignof(max_align_t)) {
+        return alignof(max_align_t);
+    }
+    return low;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_hash()
+------------------------------------------------------------------------------*/
+static uint64_t ctk_hashmap_hash(
+    const struct ctk_hashmap * const map, const void * const key
+)
+{
+    // Same value as ctk_hash_n() without the call. Tested first like in
+    // ctk_hashmap_find(): the compiler merges both tests.
+    if(map->word == sizeof(uint64_t)) {
+        return ctk_hash_word(key, sizeof(uint64_t));
+    }
+    if(map->word == sizeof(uint32_t)) {
+        return ctk_hash_word(key, sizeof(uint32_t));
+    }
+    if(map->hash != NULL) {
+        return map->hash(key, map->ctx);
+    }
+    if(map->keys == CTK_HASHMAP_KEYS_STRING) {
+        return ctk_hash(key);
+    }
+    return ctk_hash_n(key, map->key_size);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_eq()
+------------------------------------------------------------------------------*/
+// Compares `key` with the key stored in `slot`
+static bool ctk_hashmap_eq(
+    const struct ctk_hashmap * const map, const void * const key,
+    const unsigned char * const slot
+)
+{
+    if(map->keys == CTK_HASHMAP_KEYS_STRING) {
+        const char * stored;
+        memcpy(&stored, slot, sizeof(stored));
+        if(map->eq != NULL) {
+            return map->eq(key, stored, map->ctx);
+        }
+        return strcmp(key, stored) == 0;
+    }
+    if(map->eq != NULL) {
+        return map->eq(key, slot, map->ctx);
+    }
+    // Sizes known at compile time let memcmp() be inlined
+    if(map->key_size == sizeof(uint64_t)) {
+        return memcmp(key, slot, sizeof(uint64_t)) == 0;
+    }
+    if(map->key_size == sizeof(uint32_t)) {
+        return memcmp(key, slot, sizeof(uint32_t)) == 0;
+    }
+    return memcmp(key, slot, map->key_size) == 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_ctz()
+------------------------------------------------------------------------------*/
+// Index of the lowest set bit of a non-zero mask
+static unsigned int ctk_hashmap_ctz(unsigned int mask)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(mask);
+#else
+    unsigned int index = 0;
+    for(; (mask & 1) == 0; mask >>= 1) {
+        ++index;
+    }
+    return index;
+#endif
+}
+#if !defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_hashmap_load64()
+------------------------------------------------------------------------------*/
+// Little-endian load: bit `i` of a match is the slot `i` on every target
+static uint64_t ctk_hashmap_load64(const unsigned char * const bytes)
+{
+    uint64_t word = 0;
+    for(size_t i = 0; i < 8; ++i) {
+        word |= (uint64_t)bytes[i] << (8 * i);
+    }
+    return word;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_pack()
+------------------------------------------------------------------------------*/
+// Gathers the high bit of each byte of `word` in bit `i` for byte `i`.
+// The multiplication moves the bit of byte `i` to bit `56 + i` without
+// carries.
+static unsigned int ctk_hashmap_pack(const uint64_t word)
+{
+    const uint64_t bits = (word >> 7) & UINT64_C(0x0101010101010101);
+    return (unsigned int)((bits * UINT64_C(0x0102040810204080)) >> 56);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_match_word()
+------------------------------------------------------------------------------*/
+// Bytes of `word` equal to `byte`, as ctk_hashmap_pack(). The zero byte
+// detection is exact: no borrow crosses from one byte to the next.
+static unsigned int ctk_hashmap_match_word(
+    const uint64_t word, const unsigned char byte
+)
+{
+    const uint64_t low7 = UINT64_C(0x7F7F7F7F7F7F7F7F);
+    const uint64_t diff = word ^ (UINT64_C(0x0101010101010101) * byte);
+    return ctk_hashmap_pack(~(((diff & low7) + low7) | diff | low7));
+}
+#endif
+/*------------------------------------------------------------------------------
+    ctk_hashmap_match()
+------------------------------------------------------------------------------*/
+// Bit `i` is set if the control byte `i` of the group is `byte`
+static unsigned int ctk_hashmap_match(
+    const unsigned char * const group, const unsigned char byte
+)
+{
+#if defined(__SSE2__)
+    const __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    const __m128i eq = _mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)byte));
+    return (unsigned int)_mm_movemask_epi8(eq);
+#else
+    return ctk_hashmap_match_word(ctk_hashmap_load64(group), byte)
+        | ctk_hashmap_match_word(ctk_hashmap_load64(group + 8), byte) << 8;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_match_empty()
+------------------------------------------------------------------------------*/
+// Bit `i` is set if the slot `i` of the group is empty, i.e. its control
+// byte has the high bit set
+static unsigned int ctk_hashmap_match_empty(const unsigned char * const group)
+{
+#if defined(__SSE2__)
+    return (unsigned int)_mm_movemask_epi8(
+        _mm_loadu_si128((const __m128i *)group)
+    );
+#else
+    return ctk_hashmap_pack(ctk_hashmap_load64(group))
+        | ctk_hashmap_pack(ctk_hashmap_load64(group + 8)) << 8;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_h2()
+------------------------------------------------------------------------------*/
+// Control byte of a hash, the group comes from its low bits
+static unsigned char ctk_hashmap_h2(const uint64_t hash)
+{
+    return (unsigned char)(hash >> 57);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_slot()
+------------------------------------------------------------------------------*/
+static unsigned char * ctk_hashmap_slot(
+    const struct ctk_hashmap * const map, const size_t index
+)
+{
+    return map->slots + index * map->stride;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_entry()
+------------------------------------------------------------------------------*/
+// What ctk_hashmap_get() returns for a slot: its value, or its key for a set
+static void * ctk_hashmap_entry(
+    const struct ctk_hashmap * const map, const size_t index
+)
+{
+    unsigned char * const slot = ctk_hashmap_slot(map, index);
+    return map->value_size != 0 ? slot + map->value_offset : slot;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_find_bytes()
+------------------------------------------------------------------------------*/
+// Index of the slot of `key`, SIZE_MAX if it isn't in the map. Groups are
+// probed with triangular steps, which visit every group of a power of two
+// count.
+static size_t ctk_hashmap_find_bytes(
+    const struct ctk_hashmap * const map, const void * const key,
+    const uint64_t hash
+)
+{
+    const size_t mask = map->groups - 1;
+    const unsigned char h2 = ctk_hashmap_h2(hash);
+    size_t group = (size_t)hash & mask;
+    for(size_t step = 1; step <= map->groups; ++step) {
+        const size_t base = group * CTK_HASHMAP_GROUP_SIZE;
+        unsigned int match = ctk_hashmap_match(map->ctrl + base, h2);
+        while(match != 0) {
+            const size_t index = base + ctk_hashmap_ctz(match);
+            if(ctk_hashmap_eq(map, key, ctk_hashmap_slot(map, index))) {
+                return index;
+            }
+            match &= match - 1;
+        }
+        if(map->overflow[group] == 0) {
+            break;
+        }
+        group = (group + step) & mask;
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_find_word()
+------------------------------------------------------------------------------*/
+// Same as ctk_hashmap_find_bytes() for keys of `size` bytes compared as
+// integers. The key is loaded once and each candidate costs a load and a
+// compare: a short lookup lets the CPU overlap the misses of several ones.
+static size_t ctk_hashmap_find_word(
+    const struct ctk_hashmap * const map, const void * const key,
+    const uint64_t hash, const size_t size
+)
+{
+    uint64_t word = 0;
+    memcpy(&word, key, size);
+    const size_t mask = map->groups - 1;
+    const unsigned char h2 = ctk_hashmap_h2(hash);
+    size_t group = (size_t)hash & mask;
+    for(size_t step = 1; step <= map->groups; ++step) {
+        const size_t base = group * CTK_HASHMAP_GROUP_SIZE;
+        unsigned int match = ctk_hashmap_match(map->ctrl + base, h2);
+        while(match != 0) {
+            const size_t index = base + ctk_hashmap_ctz(match);
+            uint64_t stored = 0;
+            memcpy(&stored, ctk_hashmap_slot(map, index), size);
+            if(stored == word) {
+                return index;
+            }
+            match &= match - 1;
+        }
+        if(map->overflow[group] == 0) {
+            break;
+        }
+        group = (group + step) & mask;
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_find()
+------------------------------------------------------------------------------*/
+// Index of the slot of `key`, SIZE_MAX if it isn't in the map
+static size_t ctk_hashmap_find(
+    const struct ctk_hashmap * const map, const void * const key,
+    const uint64_t hash
+)
+{
+    if(map->word == sizeof(uint64_t)) {
+        return ctk_hashmap_find_word(map, key, hash, sizeof(uint64_t));
+    }
+    if(map->word == sizeof(uint32_t)) {
+        return ctk_hashmap_find_word(map, key, hash, sizeof(uint32_t));
+    }
+    return ctk_hashmap_find_bytes(map, key, hash);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_claim()
+------------------------------------------------------------------------------*/
+// Takes the first empty slot on the probe sequence of `hash` and returns
+// its index. The overflow counter of each full group passed is incremented.
+static size_t ctk_hashmap_claim(
+    struct ctk_hashmap * const map, const uint64_t hash
+)
+{
+    const size_t mask = map->groups - 1;
+    size_t group = (size_t)hash & mask;
+    for(size_t step = 1;; ++step) {
+        const size_t base = group * CTK_HASHMAP_GROUP_SIZE;
+        const unsigned int empty = ctk_hashmap_match_empty(map->ctrl + base);
+        if(empty != 0) {
+            const size_t index = base + ctk_hashmap_ctz(empty);
+            map->ctrl[index] = ctk_hashmap_h2(hash);
+            return index;
+        }
+        if(map->overflow[group] < CTK_HASHMAP_OVERFLOW_MAX) {
+            ++map->overflow[group];
+        }
+        group = (group + step) & mask;
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_groups()
+------------------------------------------------------------------------------*/
+// Smallest number of groups holding `count` keys, 0 on overflow
+static size_t ctk_hashmap_groups(const size_t count)
+{
+    size_t groups = 1;
+    while(groups * CTK_HASHMAP_GROUP_LOAD < count) {
+        if(groups > SIZE_MAX / CTK_HASHMAP_GROUP_SIZE / 2) {
+            return 0;
+        }
+        groups *= 2;
+    }
+    return groups;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_resize()
+------------------------------------------------------------------------------*/
+// Moves all the keys to a new table of `groups` groups(0 frees the table).
+// The control bytes, the overflow counters and the slots share a single
+// allocation.
+static int ctk_hashmap_resize(
+    struct ctk_hashmap * const map, const size_t groups
+)
+{
+    unsigned char * memory = NULL;
+    unsigned char * overflow = NULL;
+    unsigned char * slots = NULL;
+    if(groups != 0) {
+        const size_t count = groups * CTK_HASHMAP_GROUP_SIZE;
+        const size_t align = ctk_hashmap_align(map->stride);
+        const size_t offset = CTK_ALIGN_UP(count + groups, align);
+        if(count > (SIZE_MAX - offset) / map->stride) {
+            return -1;
+        }
+        memory = map->alloc(offset + count * map->stride, map->alloc_ctx);
+        if(memory == NULL) {
+            return -1;
+        }
+        memset(memory, CTK_HASHMAP_EMPTY, count);
+        overflow = memory + count;
+        memset(overflow, 0, groups);
+        slots = memory + offset;
+    }
+    struct ctk_hashmap old = *map;
+    map->ctrl = memory;
+    map->overflow = overflow;
+    map->slots = slots;
+    map->groups = groups;
+    for(size_t i = 0; i < old.groups * CTK_HASHMAP_GROUP_SIZE; ++i) {
+        if(old.ctrl[i] & CTK_HASHMAP_EMPTY) {
+            continue;
+        }
+        const unsigned char * const slot = ctk_hashmap_slot(&old, i);
+        const void * key = slot;
+        if(map->keys == CTK_HASHMAP_KEYS_STRING) {
+            memcpy(&key, slot, sizeof(key));
+        }
+        const size_t index = ctk_hashmap_claim(map, ctk_hashmap_hash(map, key));
+        memcpy(ctk_hashmap_slot(map, index), slot, map->stride);
+    }
+    if(old.ctrl != NULL) {
+        map->free(old.ctrl, map->alloc_ctx);
+    }
+    return 0;
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hashmap_create()
+------------------------------------------------------------------------------*/
+struct ctk_hashmap * ctk_hashmap_create(
+    const struct ctk_hashmap_config * const config
+)
+{
+    CTK_ERROR_RET_NULL_IF(config == NULL);
+    CTK_ERROR_RET_NULL_IF(
+        config->keys != CTK_HASHMAP_KEYS_BYTES
+        && config->keys != CTK_HASHMAP_KEYS_STRING
+    );
+    CTK_ERROR_RET_NULL_IF(
+        config->keys == CTK_HASHMAP_KEYS_BYTES && config->key_size == 0
+    );
+    CTK_ERROR_RET_NULL_IF((config->hash == NULL) != (config->eq == NULL));
+    CTK_ERROR_RET_NULL_IF((config->alloc == NULL) != (config->free == NULL));
+    const size_t key_size = config->keys == CTK_HASHMAP_KEYS_STRING
+        ? sizeof(const char *) : config->key_size;
+    const size_t value_align = config->value_size == 0
+        ? 1 : ctk_hashmap_align(config->value_size);
+    const size_t key_align = ctk_hashmap_align(key_size);
+    const size_t align = key_align > value_align ? key_align : value_align;
+    if(key_size > SIZE_MAX / 2 || config->value_size > SIZE_MAX / 4) {
+        return NULL;
+    }
+    const size_t value_offset = CTK_ALIGN_UP(key_size, value_align);
+    ctk_hashmap_alloc_fn * const alloc = config->alloc != NULL
+        ? config->alloc : ctk_hashmap_malloc;
+    struct ctk_hashmap * const map = alloc(sizeof(*map), config->alloc_ctx);
+    if(map == NULL) {
+        return NULL;
+    }
+    *map = (struct ctk_hashmap){
+        .key_size = key_size,
+        .value_offset = value_offset,
+        .value_size = config->value_size,
+        .stride = CTK_ALIGN_UP(value_offset + config->value_size, align),
+        .word = config->keys == CTK_HASHMAP_KEYS_BYTES && config->eq == NULL
+            && (key_size == sizeof(uint64_t) || key_size == sizeof(uint32_t))
+            ? key_size : 0,
+        .keys = config->keys,
+        .hash = config->hash,
+        .eq = config->eq,
+        .ctx = config->ctx,
+        .alloc = alloc,
+        .free = config->free != NULL ? config->free : ctk_hashmap_mfree,
+        .alloc_ctx = config->alloc_ctx,
+    };
+    return map;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_destroy()
+------------------------------------------------------------------------------*/
+void ctk_hashmap_destroy(struct ctk_hashmap ** const map)
+{
+    CTK_ERROR_RET_IF(map == NULL);
+    if(*map == NULL) {
+        return;
+    }
+    if((*map)->ctrl != NULL) {
+        (*map)->free((*map)->ctrl, (*map)->alloc_ctx);
+    }
+    (*map)->free(*map, (*map)->alloc_ctx);
+    *map = NULL;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_size()
+------------------------------------------------------------------------------*/
+size_t ctk_hashmap_size(const struct ctk_hashmap * const map)
+{
+    CTK_ERROR_RET_0_IF(map == NULL);
+    return map->size;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_capacity()
+------------------------------------------------------------------------------*/
+size_t ctk_hashmap_capacity(const struct ctk_hashmap * const map)
+{
+    CTK_ERROR_RET_0_IF(map == NULL);
+    return map->groups * CTK_HASHMAP_GROUP_LOAD;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_get()
+------------------------------------------------------------------------------*/
+CTK_HASHMAP_FLATTEN void * ctk_hashmap_get(
+    const struct ctk_hashmap * const map, const void * const key
+)
+{
+    CTK_ERROR_RET_NULL_IF(map == NULL);
+    CTK_ERROR_RET_NULL_IF(key == NULL);
+    if(map->size == 0) {
+        return NULL;
+    }
+    const size_t index = ctk_hashmap_find(map, key, ctk_hashmap_hash(map, key));
+    if(index == SIZE_MAX) {
+        return NULL;
+    }
+    return ctk_hashmap_entry(map, index);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_insert()
+------------------------------------------------------------------------------*/
+CTK_HASHMAP_FLATTEN void * ctk_hashmap_insert(
+    struct ctk_hashmap * const map, const void * const key,
+    const void * const value
+)
+{
+    CTK_ERROR_RET_NULL_IF(map == NULL);
+    CTK_ERROR_RET_NULL_IF(key == NULL);
+    const uint64_t hash = ctk_hashmap_hash(map, key);
+    size_t index = map->size == 0 ? SIZE_MAX : ctk_hashmap_find(map, key, hash);
+    if(index == SIZE_MAX) {
+        if(map->size == map->groups * CTK_HASHMAP_GROUP_LOAD
+            && ctk_hashmap_resize(map, map->groups == 0 ? 1 : map->groups * 2)
+                != 0) {
+            return NULL;
+        }
+        index = ctk_hashmap_claim(map, hash);
+        unsigned char * const slot = ctk_hashmap_slot(map, index);
+        if(map->keys == CTK_HASHMAP_KEYS_STRING) {
+            memcpy(slot, &key, sizeof(key));
+        }
+        if(map->keys == CTK_HASHMAP_KEYS_BYTES) {
+            memcpy(slot, key, map->key_size);
+        }
+        memset(slot + map->value_offset, 0, map->value_size);
+        ++map->size;
+    }
+    void * const entry = ctk_hashmap_entry(map, index);
+    if(value != NULL && map->value_size != 0) {
+        memcpy(entry, value, map->value_size);
+    }
+    return entry;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_remove()
+------------------------------------------------------------------------------*/
+CTK_HASHMAP_FLATTEN bool ctk_hashmap_remove(
+    struct ctk_hashmap * const map, const void * const key
+)
+{
+    CTK_ERROR_RET_FALSE_IF(map == NULL);
+    CTK_ERROR_RET_FALSE_IF(key == NULL);
+    if(map->size == 0) {
+        return false;
+    }
+    const uint64_t hash = ctk_hashmap_hash(map, key);
+    const size_t index = ctk_hashmap_find(map, key, hash);
+    if(index == SIZE_MAX) {
+        return false;
+    }
+    // The key was claimed in the first group with an empty slot: it passed
+    // every group from its first one to its own
+    const size_t mask = map->groups - 1;
+    size_t group = (size_t)hash & mask;
+    for(size_t step = 1; group != index / CTK_HASHMAP_GROUP_SIZE; ++step) {
+        if(map->overflow[group] < CTK_HASHMAP_OVERFLOW_MAX) {
+            --map->overflow[group];
+        }
+        group = (group + step) & mask;
+    }
+    map->ctrl[index] = CTK_HASHMAP_EMPTY;
+    --map->size;
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_clear()
+------------------------------------------------------------------------------*/
+void ctk_hashmap_clear(struct ctk_hashmap * const map)
+{
+    CTK_ERROR_RET_IF(map == NULL);
+    if(map->ctrl != NULL) {
+        memset(
+            map->ctrl, CTK_HASHMAP_EMPTY,
+            map->groups * CTK_HASHMAP_GROUP_SIZE
+        );
+        memset(map->overflow, 0, map->groups);
+    }
+    map->size = 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_reserve()
+------------------------------------------------------------------------------*/
+int ctk_hashmap_reserve(struct ctk_hashmap * const map, const size_t count)
+{
+    CTK_ERROR_RET_NEG_1_IF(map == NULL);
+    if(count <= map->groups * CTK_HASHMAP_GROUP_LOAD) {
+        return 0;
+    }
+    const size_t groups = ctk_hashmap_groups(count);
+    if(groups == 0) {
+        return -1;
+    }
+    return ctk_hashmap_resize(map, groups);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_rehash()
+------------------------------------------------------------------------------*/
+int ctk_hashmap_rehash(struct ctk_hashmap * const map, size_t count)
+{
+    CTK_ERROR_RET_NEG_1_IF(map == NULL);
+    if(count < map->size) {
+        count = map->size;
+    }
+    const size_t groups = count == 0 ? 0 : ctk_hashmap_groups(count);
+    if(count != 0 && groups == 0) {
+        return -1;
+    }
+    return ctk_hashmap_resize(map, groups);
+}
+/*------------------------------------------------------------------------------
+    ctk_hashmap_next()
+------------------------------------------------------------------------------*/
+bool ctk_hashmap_next(
+    const struct ctk_hashmap * const map, size_t * const iter,
+    const void ** const key, void ** const value
+)
+{
+    CTK_ERROR_RET_FALSE_IF(map == NULL);
+    CTK_ERROR_RET_FALSE_IF(iter == NULL);
+    const size_t count = map->groups * CTK_HASHMAP_GROUP_SIZE;
+    for(size_t i = *iter; i < count; ++i) {
+        if(map->ctrl[i] & CTK_HASHMAP_EMPTY) {
+            continue;
+        }
+        unsigned char * const slot = ctk_hashmap_slot(map, i);
+        if(key != NULL) {
+            *key = slot;
+            if(map->keys == CTK_HASHMAP_KEYS_STRING) {
+                memcpy(key, slot, sizeof(*key));
+            }
+        }
+        if(value != NULL) {
+            *value = ctk_hashmap_entry(map, i);
+        }
+        *iter = i + 1;
+        return true;
+    }
+    *iter = count;
+    return false;
+}
@@ -0,0 +1,609 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_log.h"
+// C Standard Library
+#include <stdarg.h>    // va_end(), va_list, va_start()
+#include <stdatomic.h> // atomic_*, memory_order_*
+#include <stdbool.h>
+#include <stddef.h>    // NULL, size_t
+#include <stdint.h>    // SIZE_MAX, uint64_t
+#include <stdio.h>     // vsnprintf()
+#include <string.h>    // memcpy(), strlen()
+#if defined(CTK_POSIX)
+    #include <errno.h>     // errno, EINTR
+    #include <pthread.h>
+    #include <sched.h>     // sched_yield()
+    #include <sys/uio.h>   // struct iovec, writev()
+    #include <time.h>      // CLOCK_MONOTONIC, struct timespec
+#endif
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_error.h"
+#include "ctk_time.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Longest time the writer sleeps, which bounds the latency of records too few
+// to wake it up
+#define CTK_LOG_IDLE_NS CTK_TIME_NS_PER_MS
+// Length of the timestamp of a record, without the null character
+#define CTK_LOG_TIME_LENGTH (CTK_TIME_ISO8601_US_STR_LENGTH - 1)
+#if defined(CTK_POSIX)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct ctk_log_record {
+    size_t length; // Number of bytes of `text` to write
+    char text[CTK_LOG_RECORD_SIZE - sizeof(size_t)];
+};
+// Single-producer single-consumer ring of records. `head` and `tail` only
+// grow: `records[index & mask]` is the slot of `index`.
+struct ctk_log_queue {
+    // Producer
+    CTK_CACHE_ALIGNED _Atomic size_t head; // Records published
+    size_t tail_cache; // Last `tail` read, to avoid sharing its cache line
+    // Writer
+    CTK_CACHE_ALIGNED _Atomic size_t tail; // Records written
+    CTK_CACHE_ALIGNED _Atomic uint64_t dropped;
+    atomic_bool in_use;          // A live thread owns the queue
+    struct ctk_log_queue * next; // Never changes once the queue is published
+    struct ctk_log_record records[];
+};
+struct ctk_log {
+    struct ctk_log_queue * _Atomic queues; // Most recently created queue
+    size_t mask;                           // `queue_capacity - 1`
+    // Records in a queue from which its producer wakes the writer
+    size_t wake_fill;
+    enum ctk_log_overflow overflow;
+    enum ctk_log_level level;
+    int fd;
+    pthread_key_t key; // Queue of the calling thread
+    pthread_t writer;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    atomic_bool sleeping; // The writer waits on `wake`
+    atomic_bool stop;
+    // Written by the writer only
+    _Atomic uint64_t records;
+    _Atomic uint64_t bytes;
+    _Atomic uint64_t writes;
+    _Atomic uint64_t errors;
+};
+// Records taken from a queue by the batch being written
+struct ctk_log_span {
+    struct ctk_log_queue * queue;
+    size_t end; // New tail of `queue` once the batch is written
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+// Indexed by `enum ctk_log_level`
+static const char * const ctk_log_levels[] = {
+    " DEBUG ", " INFO ", " WARNING ", " ERROR "
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_log_queue_release()
+------------------------------------------------------------------------------*/
+// Called when a thread exits: its queue is reused by the next new thread, the
+// writer still drains the records left in it
+static void ctk_log_queue_release(void * const queue)
+{
+    atomic_store_explicit(
+        &((struct ctk_log_queue *)queue)->in_use, false, memory_order_release
+    );
+}
+/*------------------------------------------------------------------------------
+    ctk_log_queue_self()
+------------------------------------------------------------------------------*/
+// Returns the queue of the calling thread, claiming a released one or creating
+// one on first use
+static struct ctk_log_queue * ctk_log_queue_self(struct ctk_log * const log)
+{
+    struct ctk_log_queue * queue = pthread_getspecific(log->key);
+    if(queue != NULL) {
+        return queue;
+    }
+    queue = atomic_load_explicit(&log->queues, memory_order_acquire);
+    for(; queue != NULL; queue = queue->next) {
+        bool expected = false;
+        if(!atomic_load_explicit(&queue->in_use, memory_order_relaxed)
+            && atomic_compare_exchange_strong_explicit(&queue->in_use,
+                &expected, true, memory_order_acquire, memory_order_relaxed)) {
+            break;
+        }
+    }
+    if(queue == NULL) {
+        const size_t capacity = log->mask + 1;
+        if(capacity > (SIZE_MAX - sizeof(*queue))
+            / sizeof(struct ctk_log_record)) {
+            return NULL;
+        }
+        queue = ctk_aligned_alloc(CTK_CACHE_LINE_SIZE,
+            sizeof(*queue) + capacity * sizeof(struct ctk_log_record)
+        );
+        if(queue == NULL) {
+            return NULL;
+        }
+        atomic_init(&queue->head, 0);
+        queue->tail_cache = 0;
+        atomic_init(&queue->tail, 0);
+        atomic_init(&queue->dropped, 0);
+        atomic_init(&queue->in_use, true);
+        queue->next = atomic_load_explicit(&log->queues, memory_order_relaxed);
+        while(!atomic_compare_exchange_weak_explicit(&log->queues,
+            &queue->next, queue, memory_order_release, memory_order_relaxed)) {
+            continue;
+        }
+    }
+    if(pthread_setspecific(log->key, queue) != 0) {
+        ctk_log_queue_release(queue);
+        return NULL;
+    }
+    return queue;
+}
+/*------------------------------------------------------------------------------
+    ctk_log_wake()
+------------------------------------------------------------------------------*/
+// Wakes the writer if it is waiting for records
+static void ctk_log_wake(struct ctk_log * const log)
+{
+    if(!atomic_load_explicit(&log->sleeping, memory_order_relaxed)) {
+        return;
+    }
+    pthread_mutex_lock(&log->lock);
+    pthread_cond_signal(&log->wake);
+    pthread_mutex_unlock(&log->lock);
+}
+/*------------------------------------------------------------------------------
+    ctk_log_pending()
+------------------------------------------------------------------------------*/
+static bool ctk_log_pending(struct ctk_log * const log)
+{
+    struct ctk_log_queue * queue =
+        atomic_load_explicit(&log->queues, memory_order_acquire);
+    for(; queue != NULL; queue = queue->next) {
+        if(atomic_load(&queue->head) != atomic_load(&queue->tail)) {
+            return true;
+        }
+    }
+    return false;
+}
+/*------------------------------------------------------------------------------
+    ctk_log_writev()
+------------------------------------------------------------------------------*/
+// Writes `count` buffers, retrying on partial writes and signals
+static int ctk_log_writev(const int fd, struct iovec * iov, int count)
+{
+    while(count > 0) {
+        const ssize_t written = writev(fd, iov, count);
+        if(written < 0 && errno == EINTR) {
+            continue;
+        }
+        if(written <= 0) {
+            return -1;
+        }
+        size_t left = (size_t)written;
+        while(count > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if(count > 0) {
+            iov->iov_base = (char *)iov->iov_base + left;
+            iov->iov_len -= left;
+        }
+    }
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_log_commit()
+------------------------------------------------------------------------------*/
+// Writes a batch and gives its records back to their producers. Records are
+// released even if the write failed so that producers can't block forever.
+static void ctk_log_commit(
+    struct ctk_log * const log, struct iovec * const iov, const size_t count,
+    const struct ctk_log_span * const spans, const size_t span_count
+)
+{
+    size_t bytes = 0;
+    for(size_t i = 0; i < count; i++) {
+        bytes += iov[i].iov_len;
+    }
+    const int status = ctk_log_writev(log->fd, iov, (int)count);
+    for(size_t i = 0; i < span_count; i++) {
+        atomic_store_explicit(
+            &spans[i].queue->tail, spans[i].end, memory_order_release
+        );
+    }
+    atomic_fetch_add_explicit(&log->writes, 1, memory_order_relaxed);
+    if(status != 0) {
+        atomic_fetch_add_explicit(&log->errors, 1, memory_order_relaxed);
+        return;
+    }
+    atomic_fetch_add_explicit(&log->records, count, memory_order_relaxed);
+    atomic_fetch_add_explicit(&log->bytes, bytes, memory_order_relaxed);
+}
+/*------------------------------------------------------------------------------
+    ctk_log_drain()
+------------------------------------------------------------------------------*/
+// Writes the records published in all queues, gathering up to CTK_LOG_BATCH
+// records of any queues per batch. Returns the number of records taken.
+static size_t ctk_log_drain(struct ctk_log * const log)
+{
+    struct iovec iov[CTK_LOG_BATCH];
+    struct ctk_log_span spans[CTK_LOG_BATCH];
+    size_t count = 0;
+    size_t span_count = 0;
+    size_t total = 0;
+    struct ctk_log_queue * queue =
+        atomic_load_explicit(&log->queues, memory_order_acquire);
+    for(; queue != NULL; queue = queue->next) {
+        const size_t head =
+            atomic_load_explicit(&queue->head, memory_order_acquire);
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        while(tail != head) {
+            struct ctk_log_record * const record =
+                &queue->records[tail & log->mask];
+            iov[count].iov_base = record->text;
+            iov[count].iov_len = record->length;
+            count++;
+            tail++;
+            if(span_count == 0 || spans[span_count - 1].queue != queue) {
+                spans[span_count].queue = queue;
+                span_count++;
+            }
+            spans[span_count - 1].end = tail;
+            if(count == CTK_LOG_BATCH) {
+                ctk_log_commit(log, iov, count, spans, span_count);
+                total += count;
+                count = 0;
+                span_count = 0;
+            }
+        }
+    }
+    if(count > 0) {
+        ctk_log_commit(log, iov, count, spans, span_count);
+        total += count;
+    }
+    return total;
+}
+/*------------------------------------------------------------------------------
+    ctk_log_sleep()
+------------------------------------------------------------------------------*/
+// Waits for a producer, ctk_log_flush(), ctk_log_destroy() or at most
+// CTK_LOG_IDLE_NS. A producer which misses `sleeping` only delays its records
+// by as much.
+static void ctk_log_sleep(struct ctk_log * const log)
+{
+    pthread_mutex_lock(&log->lock);
+    atomic_store(&log->sleeping, true);
+    if(!ctk_log_pending(log) && !atomic_load(&log->stop)) {
+        const struct timespec deadline =
+            ctk_time_to_timespec(ctk_time_monotonic_ns() + CTK_LOG_IDLE_NS);
+        pthread_cond_timedwait(&log->wake, &log->lock, &deadline);
+    }
+    atomic_store(&log->sleeping, false);
+    pthread_mutex_unlock(&log->lock);
+}
+/*------------------------------------------------------------------------------
+    ctk_log_writer()
+------------------------------------------------------------------------------*/
+static void * ctk_log_writer(void * const arg)
+{
+    struct ctk_log * const log = arg;
+    for(;;) {
+        // Read before draining so that records queued before ctk_log_destroy()
+        // are written
+        const bool stop = atomic_load(&log->stop);
+        if(ctk_log_drain(log) > 0) {
+            continue;
+        }
+        if(stop) {
+            return NULL;
+        }
+        ctk_log_sleep(log);
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_log_sync_init()
+------------------------------------------------------------------------------*/
+// Initializes the synchronization objects of `log`, leaving nothing to
+// destroy on failure
+static int ctk_log_sync_init(struct ctk_log * const log)
+{
+    pthread_condattr_t attr;
+    if(pthread_condattr_init(&attr) != 0) {
+        return -1;
+    }
+    // The writer sleeps with ctk_time_monotonic_ns() deadlines
+    const int clock = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    const int cond = clock == 0 ? pthread_cond_init(&log->wake, &attr) : -1;
+    pthread_condattr_destroy(&attr);
+    if(cond != 0) {
+        return -1;
+    }
+    if(pthread_mutex_init(&log->lock, NULL) != 0) {
+        pthread_cond_destroy(&log->wake);
+        return -1;
+    }
+    if(pthread_key_create(&log->key, ctk_log_queue_release) != 0) {
+        pthread_mutex_destroy(&log->lock);
+        pthread_cond_destroy(&log->wake);
+        return -1;
+    }
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_log_sync_destroy()
+------------------------------------------------------------------------------*/
+static void ctk_log_sync_destroy(struct ctk_log * const log)
+{
+    pthread_key_delete(log->key);
+    pthread_mutex_destroy(&log->lock);
+    pthread_cond_destroy(&log->wake);
+}
+/*------------------------------------------------------------------------------
+    ctk_log_reserve()
+------------------------------------------------------------------------------*/
+// Returns the next free record of `queue`, applying the overflow policy of
+// `log` if the queue is full
+static struct ctk_log_record * ctk_log_reserve(
+    struct ctk_log * const log, struct ctk_log_queue * const queue
+)
+{
+    const size_t head =
+        atomic_load_explicit(&queue->head, memory_order_relaxed);
+    while(head - queue->tail_cache > log->mask) {
+        queue->tail_cache =
+            atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if(head - queue->tail_cache <= log->mask) {
+            break;
+        }
+        if(log->overflow == CTK_LOG_OVERFLOW_DROP) {
+            atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+            return NULL;
+        }
+        ctk_log_wake(log);
+        sched_yield();
+    }
+    return &queue->records[head & log->mask];
+}
+#endif
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_log_create()
+------------------------------------------------------------------------------*/
+struct ctk_log * ctk_log_create(const struct ctk_log_config * const config)
+{
+    CTK_ERROR_RET_NULL_IF(config == NULL);
+    CTK_ERROR_RET_NULL_IF(config->fd < 0);
+    CTK_ERROR_RET_NULL_IF(config->queue_capacity == 0);
+    CTK_ERROR_RET_NULL_IF(
+        (config->queue_capacity & (config->queue_capacity - 1)) != 0
+    );
+    CTK_ERROR_RET_NULL_IF((unsigned)config->overflow > CTK_LOG_OVERFLOW_BLOCK);
+    CTK_ERROR_RET_NULL_IF((unsigned)config->level > CTK_LOG_ERROR);
+#if defined(CTK_POSIX)
+    struct ctk_log * log = ctk_malloc(sizeof(*log));
+    if(log == NULL) {
+        return NULL;
+    }
+    atomic_init(&log->queues, NULL);
+    log->mask = config->queue_capacity - 1;
+    // A full batch, or half a queue too small for one
+    log->wake_fill = config->queue_capacity / 2 < CTK_LOG_BATCH
+        ? config->queue_capacity / 2 + 1 : CTK_LOG_BATCH;
+    log->overflow = config->overflow;
+    log->level = config->level;
+    log->fd = config->fd;
+    atomic_init(&log->sleeping, false);
+    atomic_init(&log->stop, false);
+    atomic_init(&log->records, 0);
+    atomic_init(&log->bytes, 0);
+    atomic_init(&log->writes, 0);
+    atomic_init(&log->errors, 0);
+    if(ctk_log_sync_init(log) != 0) {
+        ctk_free(&log);
+        return NULL;
+    }
+    if(pthread_create(&log->writer, NULL, ctk_log_writer, log) != 0) {
+        ctk_log_sync_destroy(log);
+        ctk_free(&log);
+        return NULL;
+    }
+    return log;
+//! @todo Support non-POSIX platforms
+#else
+    return NULL;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_log_destroy()
+------------------------------------------------------------------------------*/
+void ctk_log_destroy(struct ctk_log ** const log)
+{
+    CTK_ERROR_RET_IF(log == NULL);
+    if(*log == NULL) {
+        return;
+    }
+#if defined(CTK_POSIX)
+    atomic_store(&(*log)->stop, true);
+    // Taking the lock orders the signal after a concurrent check of `stop`
+    pthread_mutex_lock(&(*log)->lock);
+    pthread_cond_signal(&(*log)->wake);
+    pthread_mutex_unlock(&(*log)->lock);
+    pthread_join((*log)->writer, NULL);
+    ctk_log_sync_destroy(*log);
+    struct ctk_log_queue * queue =
+        atomic_load_explicit(&(*log)->queues, memory_order_relaxed);
+    while(queue != NULL) {
+        struct ctk_log_queue * next = queue->next;
+        ctk_free(&queue);
+        queue = next;
+    }
+#endif
+    ctk_free(log);
+}
+/*------------------------------------------------------------------------------
+    ctk_log_write()
+------------------------------------------------------------------------------*/
+int ctk_log_write(
+    struct ctk_log * const log, const enum ctk_log_level level,
+    const char * const format, ...
+)
+{
+    va_list args;
+    va_start(args, format);
+    const int ret = ctk_log_vwrite(log, level, format, args);
+    va_end(args);
+    return ret;
+}
+/*------------------------------------------------------------------------------
+    ctk_log_vwrite()
+------------------------------------------------------------------------------*/
+int ctk_log_vwrite(
+    struct ctk_log * const log, const enum ctk_log_level level,
+    const char * const format, va_list args
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(log == NULL);
+    CTK_ERROR_RET_NEG_1_IF((unsigned)level > CTK_LOG_ERROR);
+    CTK_ERROR_RET_NEG_1_IF(format == NULL);
+#if defined(CTK_POSIX)
+    if(level < log->level) {
+        return 0;
+    }
+    struct ctk_log_queue * const queue = ctk_log_queue_self(log);
+    if(queue == NULL) {
+        return -1;
+    }
+    struct ctk_log_record * const record = ctk_log_reserve(log, queue);
+    if(record == NULL) {
+        return -1;
+    }
+    // Formatted in place: the slot isn't visible to the writer until `head`
+    // is published
+    char * const text = record->text;
+    if(ctk_iso8601_time_us(ctk_time_realtime_ns(), text, sizeof(record->text))
+        == NULL) {
+        return -1;
+    }
+    const char * const name = ctk_log_levels[level];
+    const size_t name_length = strlen(name);
+    memcpy(text + CTK_LOG_TIME_LENGTH, name, name_length);
+    const size_t prefix = CTK_LOG_TIME_LENGTH + name_length;
+    const size_t room = sizeof(record->text) - prefix;
+    const int length = vsnprintf(text + prefix, room, format, args);
+    if(length < 0) {
+        return -1;
+    }
+    // The null character of a message filling `room` becomes the newline
+    const size_t message = (size_t)length < room ? (size_t)length : room - 1;
+    text[prefix + message] = '\n';
+    record->length = prefix + message + 1;
+    const size_t head =
+        atomic_load_explicit(&queue->head, memory_order_relaxed);
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    // Waking the writer for each record would cost a context switch per
+    // record whenever the writer keeps up: producers let records accumulate
+    // into a batch, the timeout of the writer bounds the latency meanwhile.
+    // `tail_cache` is only refreshed when the queue looks full: read the live
+    // `tail` before deciding, or every record past the first batch would wake
+    // the writer. Acquire, as ctk_log_reserve() reuses slots on this value.
+    if(head + 1 - queue->tail_cache >= log->wake_fill) {
+        queue->tail_cache =
+            atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if(head + 1 - queue->tail_cache >= log->wake_fill) {
+            ctk_log_wake(log);
+        }
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_log_flush()
+------------------------------------------------------------------------------*/
+int ctk_log_flush(struct ctk_log * const log)
+{
+    CTK_ERROR_RET_NEG_1_IF(log == NULL);
+#if defined(CTK_POSIX)
+    struct ctk_log_queue * queue =
+        atomic_load_explicit(&log->queues, memory_order_acquire);
+    for(; queue != NULL; queue = queue->next) {
+        const size_t head =
+            atomic_load_explicit(&queue->head, memory_order_acquire);
+        for(;;) {
+            // Once the writer passes `head`, the difference wraps around
+            // above the capacity
+            const size_t tail =
+                atomic_load_explicit(&queue->tail, memory_order_acquire);
+            if(head - tail - 1 > log->mask) {
+                break;
+            }
+            ctk_log_wake(log);
+            sched_yield();
+        }
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_log_stats_snapshot()
+------------------------------------------------------------------------------*/
+int ctk_log_stats_snapshot(
+    const struct ctk_log * const log, struct ctk_log_stats * const stats
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(log == NULL);
+    CTK_ERROR_RET_NEG_1_IF(stats == NULL);
+#if defined(CTK_POSIX)
+    stats->records = atomic_load_explicit(&log->records, memory_order_relaxed);
+    stats->bytes = atomic_load_explicit(&log->bytes, memory_order_relaxed);
+    stats->writes = atomic_load_explicit(&log->writes, memory_order_relaxed);
+    stats->errors = atomic_load_explicit(&log->errors, memory_order_relaxed);
+    stats->dropped = 0;
+    const struct ctk_log_queue * queue =
+        atomic_load_explicit(&log->queues, memory_order_acquire);
+    for(; queue != NULL; queue = queue->next) {
+        stats->dropped +=
+            atomic_load_explicit(&queue->dropped, memory_order_relaxed);
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
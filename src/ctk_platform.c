@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// C Standard Library
+#include <stdatomic.h> // atomic_load_explicit(), atomic_store_explicit()
+#include <stdbool.h>   // bool
+#include <stddef.h>    // size_t
+#include <stdint.h>    // UINT32_C, uint32_t
+#include <stdio.h>     // FILE, fclose(), fgets(), fopen(), fscanf(), sscanf()
+#if defined(CTK_X86) && defined(__GNUC__)
+    #include <cpuid.h> // __get_cpuid(), __get_cpuid_count()
+#elif defined(CTK_ARM64) && defined(__linux__)
+    #include <sys/auxv.h> // AT_HWCAP, getauxval(), HWCAP_*
+#endif
+// Internal
+#include "ctk_cpu.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Set in the cached mask once the CPU has been probed
+#define CTK_CPU_PROBED (UINT32_C(1) << 31)
+// Registers the OS must save for the AVX and AVX-512 registers to be usable:
+// XMM and YMM state, plus opmask, ZMM_Hi256 and Hi16_ZMM state
+#define CTK_CPU_XCR0_AVX    UINT32_C(0x06)
+#define CTK_CPU_XCR0_AVX512 UINT32_C(0xE6)
+// Set in the cached memory sizes once queried. Sizes are powers of two > 1,
+// whose bit 0 is free.
+#define CTK_MEM_QUERIED ((size_t)1)
+// Line of `/proc/meminfo` giving the default huge page size in KiB
+#define CTK_MEM_MEMINFO_HUGE "Hugepagesize: %lu kB"
+/*==============================================================================
+    ENUM
+==============================================================================*/
+// Bits of the cached mask
+enum ctk_cpu_bit {
+    CTK_CPU_SSE2,
+    CTK_CPU_SSE3,
+    CTK_CPU_SSSE3,
+    CTK_CPU_SSE41,
+    CTK_CPU_SSE42,
+    CTK_CPU_POPCNT,
+    CTK_CPU_AVX,
+    CTK_CPU_AVX2,
+    CTK_CPU_BMI1,
+    CTK_CPU_BMI2,
+    CTK_CPU_AVX512F,
+    CTK_CPU_AVX512BW,
+    CTK_CPU_NEON,
+    CTK_CPU_CRC32,
+    CTK_CPU_SVE
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+// Features as a mask of `1 << enum ctk_cpu_bit`, 0 until probed
+static _Atomic uint32_t ctk_cpu_mask;
+// Sizes in bytes, `| CTK_MEM_QUERIED` once queried, 0 until then
+static _Atomic size_t ctk_mem_cache_line;
+static _Atomic size_t ctk_mem_page;
+static _Atomic size_t ctk_mem_huge_page;
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_cpu_flag()
+------------------------------------------------------------------------------*/
+// Returns the bit of `feature` if `supported`, 0 otherwise
+static uint32_t ctk_cpu_flag(
+    const enum ctk_cpu_bit feature, const bool supported
+)
+{
+    return supported ? UINT32_C(1) << feature : 0;
+}
+#if defined(CTK_X86) && defined(__GNUC__)
+/*------------------------------------------------------------------------------
+    ctk_cpu_xcr0()
+------------------------------------------------------------------------------*/
+// Registers saved by the OS, only valid if the OSXSAVE bit of cpuid is set
+static uint32_t ctk_cpu_xcr0(void)
+{
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    (void)edx;
+    return eax;
+}
+/*------------------------------------------------------------------------------
+    ctk_cpu_probe_x86()
+------------------------------------------------------------------------------*/
+static uint32_t ctk_cpu_probe_x86(void)
+{
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return 0;
+    }
+    const unsigned int ecx1 = ecx;
+    const bool osxsave = (ecx1 & bit_OSXSAVE) != 0;
+    const uint32_t xcr0 = osxsave ? ctk_cpu_xcr0() : 0;
+    const bool avx_os = (xcr0 & CTK_CPU_XCR0_AVX) == CTK_CPU_XCR0_AVX;
+    const bool avx512_os = (xcr0 & CTK_CPU_XCR0_AVX512) == CTK_CPU_XCR0_AVX512;
+    uint32_t mask = ctk_cpu_flag(CTK_CPU_SSE2, (edx & bit_SSE2) != 0)
+        | ctk_cpu_flag(CTK_CPU_SSE3, (ecx1 & bit_SSE3) != 0)
+        | ctk_cpu_flag(CTK_CPU_SSSE3, (ecx1 & bit_SSSE3) != 0)
+        | ctk_cpu_flag(CTK_CPU_SSE41, (ecx1 & bit_SSE4_1) != 0)
+        | ctk_cpu_flag(CTK_CPU_SSE42, (ecx1 & bit_SSE4_2) != 0)
+        | ctk_cpu_flag(CTK_CPU_POPCNT, (ecx1 & bit_POPCNT) != 0)
+        | ctk_cpu_flag(CTK_CPU_AVX, avx_os && (ecx1 & bit_AVX) != 0);
+    if(__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return mask;
+    }
+    const unsigned int ebx7 = ebx;
+    mask |= ctk_cpu_flag(CTK_CPU_AVX2, avx_os && (ebx7 & bit_AVX2) != 0)
+        | ctk_cpu_flag(CTK_CPU_BMI1, (ebx7 & bit_BMI) != 0)
+        | ctk_cpu_flag(CTK_CPU_BMI2, (ebx7 & bit_BMI2) != 0)
+        | ctk_cpu_flag(CTK_CPU_AVX512F, avx512_os && (ebx7 & bit_AVX512F) != 0)
+        | ctk_cpu_flag(CTK_CPU_AVX512BW,
+            avx512_os && (ebx7 & bit_AVX512BW) != 0);
+    return mask;
+}
+#endif
+#if defined(CTK_ARM64) && defined(__linux__)
+/*------------------------------------------------------------------------------
+    ctk_cpu_probe_arm64()
+------------------------------------------------------------------------------*/
+static uint32_t ctk_cpu_probe_arm64(void)
+{
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    uint32_t mask = 0;
+    #if defined(HWCAP_ASIMD)
+    mask |= ctk_cpu_flag(CTK_CPU_NEON, (hwcap & HWCAP_ASIMD) != 0);
+    #endif
+    #if defined(HWCAP_CRC32)
+    mask |= ctk_cpu_flag(CTK_CPU_CRC32, (hwcap & HWCAP_CRC32) != 0);
+    #endif
+    #if defined(HWCAP_SVE)
+    mask |= ctk_cpu_flag(CTK_CPU_SVE, (hwcap & HWCAP_SVE) != 0);
+    #endif
+    (void)hwcap;
+    return mask;
+}
+#endif
+/*------------------------------------------------------------------------------
+    ctk_cpu_has()
+------------------------------------------------------------------------------*/
+static bool ctk_cpu_has(const uint32_t mask, const enum ctk_cpu_bit feature)
+{
+    return (mask & (UINT32_C(1) << feature)) != 0;
+}
+#if defined(__linux__)
+/*------------------------------------------------------------------------------
+    ctk_mem_read()
+------------------------------------------------------------------------------*/
+// Number at the start of the file `path`, 0 if it can't be read
+static size_t ctk_mem_read(const char * const path)
+{
+    FILE * const file = fopen(path, "r");
+    if(file == NULL) {
+        return 0;
+    }
+    unsigned long value = 0;
+    if(fscanf(file, "%lu", &value) != 1) {
+        value = 0;
+    }
+    fclose(file);
+    return (size_t)value;
+}
+/*------------------------------------------------------------------------------
+    ctk_mem_meminfo_huge()
+------------------------------------------------------------------------------*/
+// Default huge page size from `/proc/meminfo`, 0 if it can't be read
+static size_t ctk_mem_meminfo_huge(void)
+{
+    FILE * const file = fopen("/proc/meminfo", "r");
+    if(file == NULL) {
+        return 0;
+    }
+    char line[128];
+    unsigned long kib = 0;
+    while(kib == 0 && fgets(line, sizeof(line), file) != NULL) {
+        if(sscanf(line, CTK_MEM_MEMINFO_HUGE, &kib) != 1) {
+            kib = 0;
+        }
+    }
+    fclose(file);
+    return (size_t)kib * 1024;
+}
+#endif
+/*------------------------------------------------------------------------------
+    ctk_mem_query_cache_line()
+------------------------------------------------------------------------------*/
+static size_t ctk_mem_query_cache_line(void)
+{
+    size_t size = 0;
+#if defined(CTK_POSIX) && defined(_SC_LEVEL1_DCACHE_LINESIZE)
+    const long conf = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    size = conf > 0 ? (size_t)conf : 0;
+#endif
+#if defined(__linux__)
+    if(size == 0) {
+        size = ctk_mem_read(
+            "/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size"
+        );
+    }
+#endif
+    return size != 0 ? size : CTK_CACHE_LINE_SIZE;
+}
+/*------------------------------------------------------------------------------
+    ctk_mem_query_page()
+------------------------------------------------------------------------------*/
+static size_t ctk_mem_query_page(void)
+{
+#if defined(CTK_POSIX)
+    const long conf = sysconf(_SC_PAGESIZE);
+    if(conf > 0) {
+        return (size_t)conf;
+    }
+#endif
+    return CTK_PAGE_SIZE;
+}
+/*------------------------------------------------------------------------------
+    ctk_mem_query_huge_page()
+------------------------------------------------------------------------------*/
+static size_t ctk_mem_query_huge_page(void)
+{
+    size_t size = 0;
+#if defined(__linux__)
+    // Size of the transparent huge pages, then of the hugetlbfs ones
+    size = ctk_mem_read("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+    if(size == 0) {
+        size = ctk_mem_meminfo_huge();
+    }
+#endif
+    return size;
+}
+/*------------------------------------------------------------------------------
+    ctk_mem_cached()
+------------------------------------------------------------------------------*/
+// Returns the size cached in `cache`, calling `query` to fill it on first use
+static size_t ctk_mem_cached(
+    _Atomic size_t * const cache, size_t (* const query)(void)
+)
+{
+    size_t size = atomic_load_explicit(cache, memory_order_relaxed);
+    if(size == 0) {
+        size = query() | CTK_MEM_QUERIED;
+        // Every thread stores the same value: relaxed ordering is enough
+        atomic_store_explicit(cache, size, memory_order_relaxed);
+    }
+    return size & ~CTK_MEM_QUERIED;
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_cpu_probe()
+------------------------------------------------------------------------------*/
+struct ctk_cpu_features ctk_cpu_probe(void)
+{
+    uint32_t mask = atomic_load_explicit(&ctk_cpu_mask, memory_order_relaxed);
+    if(mask == 0) {
+        mask = CTK_CPU_PROBED;
+#if defined(CTK_X86) && defined(__GNUC__)
+        mask |= ctk_cpu_probe_x86();
+#elif defined(CTK_ARM64) && defined(__linux__)
+        mask |= ctk_cpu_probe_arm64();
+#endif
+        // Every thread stores the same value: relaxed ordering is enough
+        atomic_store_explicit(&ctk_cpu_mask, mask, memory_order_relaxed);
+    }
+    return (struct ctk_cpu_features){
+        .sse2     = ctk_cpu_has(mask, CTK_CPU_SSE2),
+        .sse3     = ctk_cpu_has(mask, CTK_CPU_SSE3),
+        .ssse3    = ctk_cpu_has(mask, CTK_CPU_SSSE3),
+        .sse41    = ctk_cpu_has(mask, CTK_CPU_SSE41),
+        .sse42    = ctk_cpu_has(mask, CTK_CPU_SSE42),
+        .popcnt   = ctk_cpu_has(mask, CTK_CPU_POPCNT),
+        .avx      = ctk_cpu_has(mask, CTK_CPU_AVX),
+        .avx2     = ctk_cpu_has(mask, CTK_CPU_AVX2),
+        .bmi1     = ctk_cpu_has(mask, CTK_CPU_BMI1),
+        .bmi2     = ctk_cpu_has(mask, CTK_CPU_BMI2),
+        .avx512f  = ctk_cpu_has(mask, CTK_CPU_AVX512F),
+        .avx512bw = ctk_cpu_has(mask, CTK_CPU_AVX512BW),
+        .neon     = ctk_cpu_has(mask, CTK_CPU_NEON),
+        .crc32    = ctk_cpu_has(mask, CTK_CPU_CRC32),
+        .sve      = ctk_cpu_has(mask, CTK_CPU_SVE)
+    };
+}
+/*------------------------------------------------------------------------------
+    ctk_cpu_detect()
+------------------------------------------------------------------------------*/
+struct ctk_cpu_features ctk_cpu_detect(void)
+{
+    return ctk_cpu_probe();
+}
+/*------------------------------------------------------------------------------
+    ctk_cache_line_size()
+------------------------------------------------------------------------------*/
+size_t ctk_cache_line_size(void)
+{
+    return ctk_mem_cached(&ctk_mem_cache_line, ctk_mem_query_cache_line);
+}
+/*------------------------------------------------------------------------------
+    ctk_page_size()
+------------------------------------------------------------------------------*/
+size_t ctk_page_size(void)
+{
+    return ctk_mem_cached(&ctk_mem_page, ctk_mem_query_page);
+}
+/*------------------------------------------------------------------------------
+    ctk_huge_page_size()
+------------------------------------------------------------------------------*/
+size_t ctk_huge_page_size(void)
+{
+    return ctk_mem_cached(&ctk_mem_huge_page, ctk_mem_query_huge_page);
+}
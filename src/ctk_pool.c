@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "ctk_pool.h"
+// C Standard Library
+#include <stdalign.h> // alignas, alignof
+#include <stddef.h>   // max_align_t, NULL, size_t
+#include <stdint.h>   // SIZE_MAX
+#include <string.h>   // memset()
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_error.h"
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+// Free object, the link is stored in the object itself
+struct ctk_pool_node {
+    struct ctk_pool_node * next;
+};
+struct ctk_pool_slab {
+    struct ctk_pool_slab * next; // Previously allocated slab
+    alignas(max_align_t) unsigned char data[];
+};
+struct ctk_pool {
+    struct ctk_pool_node * free;  // Most recently freed object
+    struct ctk_pool_slab * slabs; // Most recently allocated slab
+    unsigned char * bump;         // Next never used object of `slabs`
+    unsigned char * bump_end;     // End of `slabs`
+    size_t stride;                // Distance between two objects
+    size_t slab_capacity;         // Number of objects per slab
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_pool_stride()
+------------------------------------------------------------------------------*/
+// Smallest distance between objects which can hold a free list link. The
+// alignment of a type is a power of two dividing its size: objects of at least
+// the link size keep their size, smaller ones are padded to the link alignment,
+// which keeps every object aligned.
+static size_t ctk_pool_stride(const size_t object_size)
+{
+    const size_t link = sizeof(struct ctk_pool_node);
+    const size_t size = object_size > link ? object_size : link;
+    if(size > SIZE_MAX - (alignof(struct ctk_pool_node) - 1)) {
+        return 0;
+    }
+    return (size + alignof(struct ctk_pool_node) - 1)
+        / alignof(struct ctk_pool_node) * alignof(struct ctk_pool_node);
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_pool_create()
+------------------------------------------------------------------------------*/
+struct ctk_pool * ctk_pool_create(
+    const size_t object_size, const size_t slab_capacity
+)
+{
+    CTK_ERROR_RET_NULL_IF(object_size == 0);
+    CTK_ERROR_RET_NULL_IF(slab_capacity == 0);
+    const size_t stride = ctk_pool_stride(object_size);
+    if(stride == 0
+        || slab_capacity > (SIZE_MAX - sizeof(struct ctk_pool_slab)) / stride) {
+        return NULL;
+    }
+    struct ctk_pool * const pool = ctk_malloc(sizeof(*pool));
+    if(pool == NULL) {
+        return NULL;
+    }
+    pool->free = NULL;
+    pool->slabs = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->stride = stride;
+    pool->slab_capacity = slab_capacity;
+    return pool;
+}
+/*------------------------------------------------------------------------------
+    ctk_pool_destroy()
+------------------------------------------------------------------------------*/
+void ctk_pool_destroy(struct ctk_pool ** const pool)
+{
+    CTK_ERROR_RET_IF(pool == NULL);
+    if(*pool == NULL) {
+        return;
+    }
+    struct ctk_pool_slab * slab = (*pool)->slabs;
+    while(slab != NULL) {
+        struct ctk_pool_slab * next = slab->next;
+        ctk_free(&slab);
+        slab = next;
+    }
+    ctk_free(pool);
+}
+/*------------------------------------------------------------------------------
+    ctk_pool_alloc()
+------------------------------------------------------------------------------*/
+void * ctk_pool_alloc(struct ctk_pool * const pool)
+{
+    CTK_ERROR_RET_NULL_IF(pool == NULL);
+    if(pool->free != NULL) {
+        struct ctk_pool_node * const node = pool->free;
+        pool->free = node->next;
+        return node;
+    }
+    // Objects of the newest slab are handed out lazily so that a slab is only
+    // touched as it gets used
+    if(pool->bump == pool->bump_end) {
+        const size_t size = pool->slab_capacity * pool->stride;
+        struct ctk_pool_slab * const slab = ctk_malloc(sizeof(*slab) + size);
+        if(slab == NULL) {
+            return NULL;
+        }
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->bump = slab->data;
+        pool->bump_end = slab->data + size;
+    }
+    void * const obj = pool->bump;
+    pool->bump += pool->stride;
+    return obj;
+}
+/*------------------------------------------------------------------------------
+    ctk_pool_calloc()
+------------------------------------------------------------------------------*/
+void * ctk_pool_calloc(struct ctk_pool * const pool)
+{
+    void * const obj = ctk_pool_alloc(pool);
+    if(obj == NULL) {
+        return NULL;
+    }
+    return memset(obj, 0, pool->stride);
+}
+/*------------------------------------------------------------------------------
+    ctk_pool_free()
+------------------------------------------------------------------------------*/
+void (ctk_pool_free)(struct ctk_pool * const pool, void ** const ptr)
+{
+    CTK_ERROR_RET_IF(pool == NULL);
+    CTK_ERROR_RET_IF(ptr == NULL);
+    if(*ptr == NULL) {
+        return;
+    }
+    struct ctk_pool_node * const node = *ptr;
+    node->next = pool->free;
+    pool->free = node;
+    *ptr = NULL;
+}
@@ -0,0 +1,420 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_searcher.h"
+// C Standard Library
+#include <stdatomic.h> // CTK_DISPATCH() without CTK_IFUNC
+#include <stdbool.h>
+#include <stddef.h>    // NULL, ptrdiff_t, size_t
+#include <stdint.h>    // SIZE_MAX
+#include <string.h>    // memchr(), memcmp(), memcpy(), strlen()
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_ascii.h"
+#include "ctk_error.h"
+#include "ctk_string_search.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Bytes ranked below by ctk_searcher_rank() are searched with memchr() first
+#define CTK_SEARCHER_SPARSE_RANK 150
+// The pair filter takes over from memchr() after this many windows matching
+// the rarest byte but not the needle, if they are on average less than
+// CTK_SEARCHER_MISS_DISTANCE bytes apart
+#define CTK_SEARCHER_MISSES 8
+#define CTK_SEARCHER_MISS_DISTANCE 64
+// Inline the memchr() path in the public functions: short haystacks are
+// searched in a few cycles, calls would be a large part of them
+#if defined(__GNUC__)
+    #define CTK_SEARCHER_FLATTEN __attribute__((flatten))
+#else
+    #define CTK_SEARCHER_FLATTEN
+#endif
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct ctk_searcher {
+    struct ctk_search_plan * plans; // Forward then backward, long needles only
+    size_t length;
+    struct ctk_search_pair pair; // The two rarest bytes, compared first
+    ctk_search_pair_fn * fwd;    // Kernels of the pair filter
+    ctk_search_pair_fn * rev;
+    bool sparse; // Whether the first rare byte is likely rare in the text
+    unsigned char needle[];
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_searcher_rank()
+------------------------------------------------------------------------------*/
+// Estimated frequency of a byte in text: the rarer the bytes compared first,
+// the fewer windows are compared with the whole needle
+static unsigned ctk_searcher_rank(const unsigned char c)
+{
+    // Lowercase letters by decreasing frequency in English text
+    static const char letters[] = "etaoinsrhldcumfpgwybvkxjqz";
+    if(c == ' ') {
+        return 255;
+    }
+    if(CTK_ASCII_IS(c, CTK_ASCII_LOWER)) {
+        const char * const letter = memchr(letters, c, sizeof(letters) - 1);
+        return 254 - 4 * (unsigned)(letter - letters);
+    }
+    if(CTK_ASCII_IS(c, CTK_ASCII_ALNUM | CTK_ASCII_SPACE)) {
+        return 100;
+    }
+    if(CTK_ASCII_IS(c, CTK_ASCII_PUNCT)) {
+        return 50;
+    }
+    // Control characters and bytes above 127
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_pick()
+------------------------------------------------------------------------------*/
+// Picks the two rarest bytes of the needle, at two different positions if the
+// needle is longer than a byte
+static void ctk_searcher_pick(struct ctk_searcher * const searcher)
+{
+    const unsigned char * const needle = searcher->needle;
+    size_t first = 0;
+    for(size_t i = 1; i < searcher->length; i++) {
+        if(ctk_searcher_rank(needle[i]) < ctk_searcher_rank(needle[first])) {
+            first = i;
+        }
+    }
+    size_t second = first == 0 && searcher->length > 1 ? 1 : 0;
+    for(size_t i = second + 1; i < searcher->length; i++) {
+        if(
+            i != first
+            && ctk_searcher_rank(needle[i]) < ctk_searcher_rank(needle[second])
+        ) {
+            second = i;
+        }
+    }
+    searcher->pair.needle = needle;
+    searcher->pair.length = searcher->length;
+    searcher->pair.offset[0] = first;
+    searcher->pair.offset[1] = second;
+    ctk_search_pair_kernels(&searcher->fwd, &searcher->rev);
+    searcher->sparse =
+        ctk_searcher_rank(needle[first]) < CTK_SEARCHER_SPARSE_RANK;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_fwd_memchr()
+------------------------------------------------------------------------------*/
+// Jumps between the occurrences of the rarest byte with memchr() from window
+// `*pos`, which beats the pair filter as long as the byte is rare. Gives up
+// when the byte occurs too often, `*pos` being then the first window left to
+// check.
+static size_t ctk_searcher_fwd_memchr(
+    const struct ctk_searcher * const searcher,
+    const unsigned char * const hay, const size_t windows, size_t * const pos
+)
+{
+    const size_t rare = searcher->pair.offset[0];
+    const size_t start = *pos;
+    size_t misses = 0;
+    while(*pos < windows) {
+        const unsigned char * const it = memchr(
+            hay + rare + *pos, searcher->needle[rare], windows - *pos
+        );
+        if(it == NULL) {
+            *pos = windows;
+            return SIZE_MAX;
+        }
+        const size_t found = (size_t)(it - hay) - rare;
+        if(memcmp(hay + found, searcher->needle, searcher->length) == 0) {
+            return found;
+        }
+        *pos = found + 1;
+        if(
+            ++misses > CTK_SEARCHER_MISSES
+            && *pos - start < misses * CTK_SEARCHER_MISS_DISTANCE
+        ) {
+            break;
+        }
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_rev_memchr()
+------------------------------------------------------------------------------*/
+// Same as ctk_searcher_fwd_memchr() backward, `*pos` being the end of the
+// windows left to check
+static size_t ctk_searcher_rev_memchr(
+    const struct ctk_searcher * const searcher,
+    const unsigned char * const hay, size_t * const pos
+)
+{
+    const size_t rare = searcher->pair.offset[0];
+    const size_t start = *pos;
+    size_t misses = 0;
+    while(*pos > 0) {
+        const unsigned char * const it = ctk_search_memrchr(
+            hay + rare, searcher->needle[rare], *pos
+        );
+        if(it == NULL) {
+            *pos = 0;
+            return SIZE_MAX;
+        }
+        const size_t found = (size_t)(it - hay) - rare;
+        if(memcmp(hay + found, searcher->needle, searcher->length) == 0) {
+            return found;
+        }
+        *pos = found;
+        if(
+            ++misses > CTK_SEARCHER_MISSES
+            && start - *pos < misses * CTK_SEARCHER_MISS_DISTANCE
+        ) {
+            break;
+        }
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_find()
+------------------------------------------------------------------------------*/
+// Position of the first occurrence of the needle in `hay`, SIZE_MAX if none
+static size_t ctk_searcher_find(
+    const struct ctk_searcher * const searcher,
+    const unsigned char * const hay, const size_t hay_len
+)
+{
+    if(hay_len < searcher->length) {
+        return SIZE_MAX;
+    }
+    const size_t windows = hay_len - searcher->length + 1;
+    size_t pos = 0;
+    if(searcher->sparse) {
+        const size_t found =
+            ctk_searcher_fwd_memchr(searcher, hay, windows, &pos);
+        if(found != SIZE_MAX || pos == windows) {
+            return found;
+        }
+    }
+    const size_t found = searcher->fwd(&searcher->pair, hay, windows, &pos);
+    if(found != SIZE_MAX || pos == windows) {
+        return found;
+    }
+    // Too many windows match both bytes but not the needle
+    const size_t two_way = searcher->plans != NULL
+        ? ctk_search_two_way_prepared(
+            hay + pos, hay_len - pos, searcher->needle, searcher->length, 1,
+            &searcher->plans[0]
+        )
+        : ctk_search_two_way(
+            hay + pos, hay_len - pos, searcher->needle, searcher->length, 1,
+            false
+        );
+    return two_way == SIZE_MAX ? SIZE_MAX : pos + two_way;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_rfind()
+------------------------------------------------------------------------------*/
+// Position of the last occurrence of the needle in `hay`, SIZE_MAX if none
+static size_t ctk_searcher_rfind(
+    const struct ctk_searcher * const searcher,
+    const unsigned char * const hay, const size_t hay_len
+)
+{
+    if(hay_len < searcher->length) {
+        return SIZE_MAX;
+    }
+    const size_t windows = hay_len - searcher->length + 1;
+    size_t end = windows;
+    if(searcher->sparse) {
+        const size_t found = ctk_searcher_rev_memchr(searcher, hay, &end);
+        if(found != SIZE_MAX || end == 0) {
+            return found;
+        }
+    }
+    const size_t found = searcher->rev(&searcher->pair, hay, windows, &end);
+    if(found != SIZE_MAX || end == 0) {
+        return found;
+    }
+    // Too many windows match both bytes but not the needle, Two-Way searches
+    // the `len` bytes of the windows left from their last byte
+    const size_t len = end + searcher->length - 1;
+    const unsigned char * const last = searcher->needle + searcher->length - 1;
+    const size_t two_way = searcher->plans != NULL
+        ? ctk_search_two_way_prepared(
+            hay + len - 1, len, last, searcher->length, -1, &searcher->plans[1]
+        )
+        : ctk_search_two_way(
+            hay + len - 1, len, last, searcher->length, -1, false
+        );
+    return two_way == SIZE_MAX ? SIZE_MAX : len - two_way - searcher->length;
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_searcher_create()
+------------------------------------------------------------------------------*/
+struct ctk_searcher * ctk_searcher_create(const char * const needle)
+{
+    CTK_ERROR_RET_NULL_IF(needle == NULL);
+    return ctk_searcher_create_n(needle, strlen(needle));
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_create_n()
+------------------------------------------------------------------------------*/
+struct ctk_searcher * ctk_searcher_create_n(
+    const char * const needle, const size_t length
+)
+{
+    CTK_ERROR_RET_NULL_IF(needle == NULL);
+    CTK_ERROR_RET_NULL_IF(length == 0);
+    if(length > SIZE_MAX - sizeof(struct ctk_searcher)) {
+        return NULL;
+    }
+    struct ctk_searcher * searcher =
+        ctk_malloc(sizeof(struct ctk_searcher) + length);
+    if(searcher == NULL) {
+        return NULL;
+    }
+    searcher->plans = NULL;
+    searcher->length = length;
+    memcpy(searcher->needle, needle, length);
+    ctk_searcher_pick(searcher);
+    // Two-Way takes over when the filter gives up: long needles keep its
+    // preprocessing, short ones are cheap to prepare again
+    if(length >= CTK_SEARCH_LONG_NEEDLE) {
+        searcher->plans = ctk_malloc(sizeof(struct ctk_search_plan) * 2);
+        if(searcher->plans == NULL) {
+            ctk_searcher_destroy(&searcher);
+            return NULL;
+        }
+        ctk_search_prepare(
+            &searcher->plans[0], searcher->needle, length, 1, false
+        );
+        ctk_search_prepare(
+            &searcher->plans[1], searcher->needle + length - 1, length, -1,
+            false
+        );
+    }
+    return searcher;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_destroy()
+------------------------------------------------------------------------------*/
+void ctk_searcher_destroy(struct ctk_searcher ** const searcher)
+{
+    CTK_ERROR_RET_IF(searcher == NULL);
+    if(*searcher == NULL) {
+        return;
+    }
+    ctk_free(&(*searcher)->plans);
+    ctk_free(searcher);
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_count()
+------------------------------------------------------------------------------*/
+size_t ctk_searcher_count(
+    const struct ctk_searcher * const searcher, const char * const str
+)
+{
+    CTK_ERROR_RET_0_IF(searcher == NULL);
+    CTK_ERROR_RET_0_IF(str == NULL);
+    return ctk_searcher_count_n(searcher, str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_count_n()
+------------------------------------------------------------------------------*/
+CTK_SEARCHER_FLATTEN size_t ctk_searcher_count_n(
+    const struct ctk_searcher * const searcher, const char * const str,
+    const size_t length
+)
+{
+    CTK_ERROR_RET_0_IF(searcher == NULL);
+    CTK_ERROR_RET_0_IF(str == NULL && length != 0);
+    const unsigned char * const hay = (const unsigned char *)str;
+    size_t count = 0;
+    size_t start = 0;
+    while(length - start >= searcher->length) {
+        const size_t pos =
+            ctk_searcher_find(searcher, hay + start, length - start);
+        if(pos == SIZE_MAX) {
+            break;
+        }
+        count++;
+        start += pos + searcher->length;
+    }
+    return count;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_pos()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_searcher_pos(
+    const struct ctk_searcher * const searcher, const char * const str
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(searcher == NULL);
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    return ctk_searcher_pos_n(searcher, str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_pos_n()
+------------------------------------------------------------------------------*/
+CTK_SEARCHER_FLATTEN ptrdiff_t ctk_searcher_pos_n(
+    const struct ctk_searcher * const searcher, const char * const str,
+    const size_t length
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(searcher == NULL);
+    CTK_ERROR_RET_NEG_1_IF(str == NULL && length != 0);
+    const size_t pos =
+        ctk_searcher_find(searcher, (const unsigned char *)str, length);
+    return pos == SIZE_MAX ? -1 : (ptrdiff_t)pos;
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_rpos()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_searcher_rpos(
+    const struct ctk_searcher * const searcher, const char * const str
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(searcher == NULL);
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    return ctk_searcher_rpos_n(searcher, str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_searcher_rpos_n()
+------------------------------------------------------------------------------*/
+CTK_SEARCHER_FLATTEN ptrdiff_t ctk_searcher_rpos_n(
+    const struct ctk_searcher * const searcher, const char * const str,
+    const size_t length
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(searcher == NULL);
+    CTK_ERROR_RET_NEG_1_IF(str == NULL && length != 0);
+    const size_t pos =
+        ctk_searcher_rfind(searcher, (const unsigned char *)str, length);
+    return pos == SIZE_MAX ? -1 : (ptrdiff_t)pos;
+}
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "ctk_strbuf.h"
+// C Standard Library
+#include <limits.h>  // CHAR_BIT
+#include <stdbool.h>
+#include <stddef.h>  // NULL, size_t
+#include <stdint.h>  // intmax_t, SIZE_MAX, uintmax_t
+#include <string.h>  // memcpy(), strlen()
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_error.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Smallest capacity allocated when a buffer grows
+#define CTK_STRBUF_MIN_CAPACITY 16
+// Enough characters for any uintmax_t in base 10(log10(2) < 0.302)
+#define CTK_STRBUF_UINT_DIGITS (sizeof(uintmax_t) * CHAR_BIT * 302 / 1000 + 1)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct ctk_strbuf {
+    char * data;     // Content, NULL until something is reserved
+    size_t length;   // Number of characters of the content
+    size_t capacity; // Number of characters `data` can hold besides the null
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strbuf_resize()
+------------------------------------------------------------------------------*/
+// Reallocates the content to hold exactly `capacity` characters
+static int ctk_strbuf_resize(
+    struct ctk_strbuf * const buf, const size_t capacity
+)
+{
+    char * const data = ctk_realloc(&buf->data, capacity + 1);
+    if(data == NULL) {
+        return -1;
+    }
+    buf->data = data;
+    buf->capacity = capacity;
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_digits()
+------------------------------------------------------------------------------*/
+// Appends the digits of `value`, preceded by a minus sign if `negative`
+static int ctk_strbuf_append_digits(
+    struct ctk_strbuf * const buf, uintmax_t value, const bool negative
+)
+{
+    char digits[CTK_STRBUF_UINT_DIGITS + 1];
+    char * it = digits + sizeof(digits);
+    do {
+        *--it = (char)('0' + value % 10);
+        value /= 10;
+    } while(value != 0);
+    if(negative) {
+        *--it = '-';
+    }
+    const char * const end = digits + sizeof(digits);
+    return ctk_strbuf_append_n(buf, it, (size_t)(end - it));
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strbuf_create()
+------------------------------------------------------------------------------*/
+struct ctk_strbuf * ctk_strbuf_create(const size_t capacity)
+{
+    if(capacity == SIZE_MAX) {
+        return NULL;
+    }
+    struct ctk_strbuf * buf = ctk_malloc(sizeof(*buf));
+    if(buf == NULL) {
+        return NULL;
+    }
+    buf->data = NULL;
+    buf->length = 0;
+    buf->capacity = 0;
+    if(capacity > 0) {
+        if(ctk_strbuf_resize(buf, capacity) != 0) {
+            ctk_free(&buf);
+            return NULL;
+        }
+        buf->data[0] = '\0';
+    }
+    return buf;
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_destroy()
+------------------------------------------------------------------------------*/
+void ctk_strbuf_destroy(struct ctk_strbuf ** const buf)
+{
+    CTK_ERROR_RET_IF(buf == NULL);
+    if(*buf == NULL) {
+        return;
+    }
+    ctk_free(&(*buf)->data);
+    ctk_free(buf);
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_data()
+------------------------------------------------------------------------------*/
+const char * ctk_strbuf_data(const struct ctk_strbuf * const buf)
+{
+    CTK_ERROR_RET_NULL_IF(buf == NULL);
+    return buf->data != NULL ? buf->data : "";
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_length()
+------------------------------------------------------------------------------*/
+size_t ctk_strbuf_length(const struct ctk_strbuf * const buf)
+{
+    CTK_ERROR_RET_0_IF(buf == NULL);
+    return buf->length;
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_capacity()
+------------------------------------------------------------------------------*/
+size_t ctk_strbuf_capacity(const struct ctk_strbuf * const buf)
+{
+    CTK_ERROR_RET_0_IF(buf == NULL);
+    return buf->capacity;
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_reserve()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_reserve(struct ctk_strbuf * const buf, const size_t additional)
+{
+    CTK_ERROR_RET_NEG_1_IF(buf == NULL);
+    if(additional <= buf->capacity - buf->length) {
+        return 0;
+    }
+    // One more character is always allocated for the terminating null
+    if(additional >= SIZE_MAX - buf->length) {
+        return -1;
+    }
+    const size_t needed = buf->length + additional;
+    size_t capacity = buf->capacity <= (SIZE_MAX - 1) / 2
+        ? buf->capacity * 2 : SIZE_MAX - 1;
+    if(capacity < CTK_STRBUF_MIN_CAPACITY) {
+        capacity = CTK_STRBUF_MIN_CAPACITY;
+    }
+    if(capacity < needed) {
+        capacity = needed;
+    }
+    return ctk_strbuf_resize(buf, capacity);
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_shrink()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_shrink(struct ctk_strbuf * const buf)
+{
+    CTK_ERROR_RET_NEG_1_IF(buf == NULL);
+    if(buf->data == NULL || buf->capacity == buf->length) {
+        return 0;
+    }
+    return ctk_strbuf_resize(buf, buf->length);
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_clear()
+------------------------------------------------------------------------------*/
+void ctk_strbuf_clear(struct ctk_strbuf * const buf)
+{
+    CTK_ERROR_RET_IF(buf == NULL);
+    buf->length = 0;
+    if(buf->data != NULL) {
+        buf->data[0] = '\0';
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_append(struct ctk_strbuf * const buf, const char * const str)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    return ctk_strbuf_append_n(buf, str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_n()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_append_n(
+    struct ctk_strbuf * const buf, const char * const bytes, const size_t length
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(buf == NULL);
+    CTK_ERROR_RET_NEG_1_IF(bytes == NULL && length != 0);
+    if(length == 0) {
+        return 0;
+    }
+    if(ctk_strbuf_reserve(buf, length) != 0) {
+        return -1;
+    }
+    memcpy(buf->data + buf->length, bytes, length);
+    buf->length += length;
+    buf->data[buf->length] = '\0';
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_char()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_append_char(struct ctk_strbuf * const buf, const char c)
+{
+    CTK_ERROR_RET_NEG_1_IF(buf == NULL);
+    if(ctk_strbuf_reserve(buf, 1) != 0) {
+        return -1;
+    }
+    buf->data[buf->length++] = c;
+    buf->data[buf->length] = '\0';
+    return 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_int()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_append_int(struct ctk_strbuf * const buf, const intmax_t value)
+{
+    // Negating in uintmax_t is well-defined even for INTMAX_MIN
+    const uintmax_t magnitude = value < 0
+        ? 0 - (uintmax_t)value : (uintmax_t)value;
+    return ctk_strbuf_append_digits(buf, magnitude, value < 0);
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_append_uint()
+------------------------------------------------------------------------------*/
+int ctk_strbuf_append_uint(struct ctk_strbuf * const buf, const uintmax_t value)
+{
+    return ctk_strbuf_append_digits(buf, value, false);
+}
+/*------------------------------------------------------------------------------
+    ctk_strbuf_steal()
+------------------------------------------------------------------------------*/
+char * ctk_strbuf_steal(struct ctk_strbuf * const buf, size_t * const length)
+{
+    CTK_ERROR_RET_NULL_IF(buf == NULL);
+    // Callers always get memory they can free, even for an empty content
+    if(buf->data == NULL && ctk_strbuf_resize(buf, 0) != 0) {
+        return NULL;
+    }
+    char * const data = buf->data;
+    data[buf->length] = '\0';
+    if(length != NULL) {
+        *length = buf->length;
+    }
+    buf->data = NULL;
+    buf->length = 0;
+    buf->capacity = 0;
+    return data;
+}
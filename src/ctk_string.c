@@ -31,14 +31,18 @@
 // Own header
 #include "ctk_string.h"
 // C Standard Library
-#include <ctype.h>  // isspace(), tolower(), toupper()
+#include <ctype.h>  // tolower(), toupper()
 #include <errno.h>
-#include <limits.h> // UCHAR_MAX
+#include <stdbool.h>
 #include <stddef.h> // NULL, ptrdiff_t, size_t
-#include <stdio.h>  // EOF, fputs()
-#include <string.h> // strerror_r(), strstr()
+#include <stdint.h> // uintptr_t
+#include <stdio.h>  // fputs()
+#include <string.h> // strerror_r(), strlen(), strstr()
 // Internal
+#include "ctk_ascii.h"
 #include "ctk_error.h"
+#include "ctk_string_case.h"
+#include "ctk_string_search.h"
 /*==============================================================================
     PUBLIC FUNCTION
 ==============================================================================*/
@@ -70,6 +74,113 @@ char * ctk_stpncpy(char * restrict const dest, const char * restrict const src,
     return NULL;
 #endif
 }
+/*------------------------------------------------------------------------------
+    ctk_strcaseeq()
+------------------------------------------------------------------------------*/
+bool ctk_strcaseeq(const char * const lhs, const char * const rhs)
+{
+    CTK_ERROR_RET_FALSE_IF(lhs == NULL);
+    CTK_ERROR_RET_FALSE_IF(rhs == NULL);
+    size_t i = 0;
+    while(CTK_ASCII_TOLOWER(lhs[i]) == CTK_ASCII_TOLOWER(rhs[i])) {
+        if(lhs[i] == '\0') {
+            return true;
+        }
+        i++;
+    }
+    return false;
+}
+/*------------------------------------------------------------------------------
+    ctk_strcaseeq_n()
+------------------------------------------------------------------------------*/
+bool ctk_strcaseeq_n(
+    const char * const lhs, const size_t lhs_len,
+    const char * const rhs, const size_t rhs_len
+)
+{
+    CTK_ERROR_RET_FALSE_IF(lhs == NULL);
+    CTK_ERROR_RET_FALSE_IF(rhs == NULL);
+    return lhs_len == rhs_len && ctk_case_equal(lhs, rhs, lhs_len);
+}
+/*------------------------------------------------------------------------------
+    ctk_strcasepos()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strcasepos(const char * const str, const char * const substr)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    CTK_ERROR_RET_NEG_1_IF(substr == NULL);
+    return ctk_strcasepos_n(str, strlen(str), substr, strlen(substr));
+}
+/*------------------------------------------------------------------------------
+    ctk_strcasepos_n()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strcasepos_n(
+    const char * const str, const size_t length,
+    const char * const substr, const size_t substr_len
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    CTK_ERROR_RET_NEG_1_IF(substr == NULL);
+    const char * const pos =
+        ctk_case_search_fwd(str, length, substr, substr_len);
+    if(pos == NULL) {
+        return -1;
+    }
+    return pos - str;
+}
+/*------------------------------------------------------------------------------
+    ctk_strcaseprefix()
+------------------------------------------------------------------------------*/
+bool ctk_strcaseprefix(const char * const str, const char * const prefix)
+{
+    CTK_ERROR_RET_FALSE_IF(str == NULL);
+    CTK_ERROR_RET_FALSE_IF(prefix == NULL);
+    // The terminating null character of a shorter `str` mismatches
+    for(size_t i = 0; prefix[i] != '\0'; i++) {
+        if(CTK_ASCII_TOLOWER(str[i]) != CTK_ASCII_TOLOWER(prefix[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_strcaseprefix_n()
+------------------------------------------------------------------------------*/
+bool ctk_strcaseprefix_n(
+    const char * const str, const size_t length,
+    const char * const prefix, const size_t prefix_len
+)
+{
+    CTK_ERROR_RET_FALSE_IF(str == NULL);
+    CTK_ERROR_RET_FALSE_IF(prefix == NULL);
+    return prefix_len <= length && ctk_case_equal(str, prefix, prefix_len);
+}
+/*------------------------------------------------------------------------------
+    ctk_strcaserpos()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strcaserpos(const char * const str, const char * const substr)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    CTK_ERROR_RET_NEG_1_IF(substr == NULL);
+    return ctk_strcaserpos_n(str, strlen(str), substr, strlen(substr));
+}
+/*------------------------------------------------------------------------------
+    ctk_strcaserpos_n()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strcaserpos_n(
+    const char * const str, const size_t length,
+    const char * const substr, const size_t substr_len
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    CTK_ERROR_RET_NEG_1_IF(substr == NULL);
+    const char * const pos =
+        ctk_case_search_rev(str, length, substr, substr_len);
+    if(pos == NULL) {
+        return -1;
+    }
+    return pos - str;
+}
 /*------------------------------------------------------------------------------
     ctk_strerror_r()
 ------------------------------------------------------------------------------*/
@@ -105,6 +216,22 @@ ptrdiff_t ctk_strpos(const char * const str, const char * const substr)
     }
     return pos - str;
 }
+/*------------------------------------------------------------------------------
+    ctk_strpos_n()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strpos_n(
+    const char * const str, const size_t length,
+    const char * const substr, const size_t substr_len
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    CTK_ERROR_RET_NEG_1_IF(substr == NULL);
+    const char * const pos = ctk_search_fwd(str, length, substr, substr_len);
+    if(pos == NULL) {
+        return -1;
+    }
+    return pos - str;
+}
 /*------------------------------------------------------------------------------
     ctk_strrpos()
 ------------------------------------------------------------------------------*/
@@ -118,6 +245,22 @@ ptrdiff_t ctk_strrpos(const char * const str, const char * const substr)
     }
     return pos - str;
 }
+/*------------------------------------------------------------------------------
+    ctk_strrpos_n()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strrpos_n(
+    const char * const str, const size_t length,
+    const char * const substr, const size_t substr_len
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(str == NULL);
+    CTK_ERROR_RET_NEG_1_IF(substr == NULL);
+    const char * const pos = ctk_search_rev(str, length, substr, substr_len);
+    if(pos == NULL) {
+        return -1;
+    }
+    return pos - str;
+}
 /*------------------------------------------------------------------------------
     ctk_strrstr()
 ------------------------------------------------------------------------------*/
@@ -129,45 +272,127 @@ char * ctk_strrstr(const char * const str, const char * const  substr)
 {
     CTK_ERROR_RET_NULL_IF(str == NULL);
     CTK_ERROR_RET_NULL_IF(substr == NULL);
-    if(substr[0] == '\0') {
-        return (char *)str;
-    }
-    const char * found = NULL;
-    const char * it = str;
-    while((it = strstr(it, substr))) {
-        found = it++;
-    }
-    return (char *)found;
+    // Restarting strstr() after each match is quadratic on inputs with many
+    // overlapping matches: measure both strings once and scan backward instead.
+    return ctk_strrstr_n(str, strlen(str), substr, strlen(substr));
+}
+/*------------------------------------------------------------------------------
+    ctk_strrstr_n()
+------------------------------------------------------------------------------*/
+/*! @cast Dropping the `const` qualifier when returning the result is necessary
+* to have a single function that can be used with both constant and non-constant
+* strings. The pointer goes through `uintptr_t` so that `-Wcast-qual` isn't
+* raised for this intended conversion.
+*/
+char * ctk_strrstr_n(
+    const char * const str, const size_t length,
+    const char * const substr, const size_t substr_len
+)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    CTK_ERROR_RET_NULL_IF(substr == NULL);
+    const char * const pos = ctk_search_rev(str, length, substr, substr_len);
+    return (char *)(uintptr_t)pos;
 }
 /*------------------------------------------------------------------------------
     ctk_strtolower()
 ------------------------------------------------------------------------------*/
 char * ctk_strtolower(char * const str)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    ctk_case_ascii(str, str, strlen(str), 'A');
+    return str;
+}
+/*------------------------------------------------------------------------------
+    ctk_strtolower_locale()
+------------------------------------------------------------------------------*/
+char * ctk_strtolower_locale(char * const str)
 {
     CTK_ERROR_RET_NULL_IF(str == NULL);
     for(char * it = str; *it; it++) {
-        *it = (char)ctk_tolower(*it);
+        *it = (char)tolower((unsigned char)*it);
     }
     return str;
 }
+/*------------------------------------------------------------------------------
+    ctk_strtolower_locale_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtolower_locale_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    for(size_t i = 0; i < length; i++) {
+        str[i] = (char)tolower((unsigned char)str[i]);
+    }
+    return str;
+}
+/*------------------------------------------------------------------------------
+    ctk_strtolower_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtolower_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    ctk_case_ascii(str, str, length, 'A');
+    return str;
+}
 /*------------------------------------------------------------------------------
     ctk_strtoupper()
 ------------------------------------------------------------------------------*/
 char * ctk_strtoupper(char * const str)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    ctk_case_ascii(str, str, strlen(str), 'a');
+    return str;
+}
+/*------------------------------------------------------------------------------
+    ctk_strtoupper_locale()
+------------------------------------------------------------------------------*/
+char * ctk_strtoupper_locale(char * const str)
 {
     CTK_ERROR_RET_NULL_IF(str == NULL);
     for(char * it = str; *it; it++) {
-        *it = (char)ctk_toupper(*it);
+        *it = (char)toupper((unsigned char)*it);
     }
     return str;
 }
+/*------------------------------------------------------------------------------
+    ctk_strtoupper_locale_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtoupper_locale_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    for(size_t i = 0; i < length; i++) {
+        str[i] = (char)toupper((unsigned char)str[i]);
+    }
+    return str;
+}
+/*------------------------------------------------------------------------------
+    ctk_strtoupper_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtoupper_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    ctk_case_ascii(str, str, length, 'a');
+    return str;
+}
 /*------------------------------------------------------------------------------
     ctk_strtrim()
 ------------------------------------------------------------------------------*/
 char * ctk_strtrim(char * const str)
 {
     CTK_ERROR_RET_NULL_IF(str == NULL);
-    return ctk_strtriml(ctk_strtrimr(str));
+    return ctk_strtrim_n(str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_strtrim_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtrim_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    const size_t len = ctk_ascii_trimr(str, length);
+    if(len < length) {
+        str[len] = '\0';
+    }
+    return ctk_strtriml_n(str, len);
 }
 /*------------------------------------------------------------------------------
     ctk_strtriml()
@@ -176,18 +401,37 @@ char * ctk_strtriml(char * const str)
 {
     CTK_ERROR_RET_NULL_IF(str == NULL);
     char * it = str;
-    while(isspace(*it) && it++){}
+    while(CTK_ASCII_IS(*it, CTK_ASCII_SPACE)) {
+        it++;
+    }
     return it;
 }
+/*------------------------------------------------------------------------------
+    ctk_strtriml_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtriml_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    return str + ctk_ascii_triml(str, length);
+}
 /*------------------------------------------------------------------------------
     ctk_strtrimr()
 ------------------------------------------------------------------------------*/
 char * ctk_strtrimr(char * const str)
 {
     CTK_ERROR_RET_NULL_IF(str == NULL);
-    char * it = str + strlen(str);
-    while((it-- > str) && isspace(*it)){}
-    *++it = '\0';
+    return ctk_strtrimr_n(str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_strtrimr_n()
+------------------------------------------------------------------------------*/
+char * ctk_strtrimr_n(char * const str, const size_t length)
+{
+    CTK_ERROR_RET_NULL_IF(str == NULL);
+    const size_t len = ctk_ascii_trimr(str, length);
+    if(len < length) {
+        str[len] = '\0';
+    }
     return str;
 }
 /*------------------------------------------------------------------------------
@@ -195,18 +439,12 @@ char * ctk_strtrimr(char * const str)
 ------------------------------------------------------------------------------*/
 int ctk_tolower(const int c)
 {
-    if((c < 0 || c > UCHAR_MAX) && c != EOF) {
-        return c;
-    }
-    return tolower(c);
+    return ctk_ascii_tolower(c);
 }
 /*------------------------------------------------------------------------------
     ctk_toupper()
 ------------------------------------------------------------------------------*/
 int ctk_toupper(const int c)
 {
-    if((c < 0 || c > UCHAR_MAX) && c != EOF) {
-        return c;
-    }
-    return toupper(c);
+    return ctk_ascii_toupper(c);
 }
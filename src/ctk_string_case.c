@@ -0,0 +1,447 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_string_case.h"
+// C Standard Library
+#include <limits.h>    // CHAR_BIT
+#include <stdatomic.h> // CTK_DISPATCH() without CTK_IFUNC
+#include <stdbool.h>
+#include <stddef.h>    // NULL, size_t
+#include <stdint.h>    // SIZE_MAX, UINT64_C, uint64_t
+#include <string.h>    // memcpy()
+// SIMD
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #if defined(__GNUC__)
+        // AVX2 kernel is compiled with a target attribute and selected at
+        // runtime, SSE2 is part of the x86-64 baseline
+        #define CTK_CASE_AVX2 1
+    #endif
+#endif
+// Internal
+#include "ctk_ascii.h"
+#include "ctk_cpu.h"
+#include "ctk_string_search.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Number of letters in the ASCII alphabet
+#define CTK_CASE_LETTERS 26
+// Difference between a lower case and an upper case ASCII letter
+#define CTK_CASE_BIT 0x20
+// Arrays shorter than this are converted by the baseline kernel, without going
+// through the runtime dispatch
+#define CTK_CASE_DISPATCH_MIN 32
+// Bytes a search may compare in vain per window scanned, plus a constant
+// allowance, before it switches to Two-Way: keeps the worst case linear when
+// the first and last bytes of the needle are everywhere in the haystack
+#define CTK_CASE_WORK_PER_WINDOW 4
+#define CTK_CASE_WORK_MIN 256
+/*==============================================================================
+    TYPE
+==============================================================================*/
+// Signature shared by all kernels, which return `dest`
+typedef char * ctk_case_fn(
+    char * dest, const char * src, size_t length, unsigned char first
+);
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_case_swar()
+------------------------------------------------------------------------------*/
+// 8 bytes per iteration in a uint64_t, then byte by byte
+static char * ctk_case_swar(
+    char * const dest, const char * const src, const size_t length,
+    const unsigned char first
+)
+{
+    const uint64_t ones  = UINT64_C(0x0101010101010101);
+    const uint64_t highs = UINT64_C(0x8080808080808080);
+    // Adding those to the low 7 bits of a byte sets its high bit when the byte
+    // is >= `first`, respectively > the last letter of the range
+    const uint64_t ge_first = ones * (uint64_t)(0x80 - first);
+    const uint64_t gt_last  = ones * (uint64_t)(0x80 - first - CTK_CASE_LETTERS);
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+        const uint64_t low7 = word & ~highs;
+        // High bit set for ASCII bytes within [first, first + 26)
+        const uint64_t in_range =
+            ((low7 + ge_first) ^ (low7 + gt_last)) & ~word & highs;
+        word ^= in_range >> 2;
+        memcpy(dest + i, &word, sizeof(word));
+    }
+    for(; i < length; i++) {
+        const unsigned char c = (unsigned char)src[i];
+        const unsigned int flip =
+            (unsigned int)(c - first) < CTK_CASE_LETTERS ? CTK_CASE_BIT : 0;
+        dest[i] = (char)(c ^ flip);
+    }
+    return dest;
+}
+#if defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_case_sse2()
+------------------------------------------------------------------------------*/
+// 16 bytes per iteration, remaining bytes handled by ctk_case_swar()
+static char * ctk_case_sse2(
+    char * const dest, const char * const src, const size_t length,
+    const unsigned char first
+)
+{
+    // Bytes are biased so that the letter range starts at SCHAR_MIN, which
+    // turns the range check into a single signed comparison
+    const __m128i bias  = _mm_set1_epi8((char)(0x80 - first));
+    const __m128i limit = _mm_set1_epi8((char)(-0x80 + CTK_CASE_LETTERS));
+    const __m128i flip  = _mm_set1_epi8(CTK_CASE_BIT);
+    size_t i = 0;
+    for(; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+        const __m128i bytes = _mm_loadu_si128((const void *)(src + i));
+        const __m128i biased = _mm_add_epi8(bytes, bias);
+        const __m128i in_range = _mm_cmplt_epi8(biased, limit);
+        _mm_storeu_si128(
+            (void *)(dest + i),
+            _mm_xor_si128(bytes, _mm_and_si128(in_range, flip))
+        );
+    }
+    ctk_case_swar(dest + i, src + i, length - i, first);
+    return dest;
+}
+#endif
+#if defined(CTK_CASE_AVX2)
+/*------------------------------------------------------------------------------
+    ctk_case_avx2()
+------------------------------------------------------------------------------*/
+// 32 bytes per iteration, remaining bytes handled by ctk_case_sse2()
+__attribute__((target("avx2")))
+static char * ctk_case_avx2(
+    char * const dest, const char * const src, const size_t length,
+    const unsigned char first
+)
+{
+    const __m256i bias  = _mm256_set1_epi8((char)(0x80 - first));
+    const __m256i limit = _mm256_set1_epi8((char)(-0x80 + CTK_CASE_LETTERS));
+    const __m256i flip  = _mm256_set1_epi8(CTK_CASE_BIT);
+    size_t i = 0;
+    for(; i + sizeof(__m256i) <= length; i += sizeof(__m256i)) {
+        const __m256i bytes = _mm256_loadu_si256((const void *)(src + i));
+        const __m256i biased = _mm256_add_epi8(bytes, bias);
+        // No signed "less than" in AVX2: swap the operands of "greater than"
+        const __m256i in_range = _mm256_cmpgt_epi8(limit, biased);
+        _mm256_storeu_si256(
+            (void *)(dest + i),
+            _mm256_xor_si256(bytes, _mm256_and_si256(in_range, flip))
+        );
+    }
+    // GCC doesn't clear the upper halves before a tail call: avoid the AVX to
+    // SSE transition penalty in ctk_case_sse2()
+    _mm256_zeroupper();
+    ctk_case_sse2(dest + i, src + i, length - i, first);
+    return dest;
+}
+#endif
+// Best kernel available without runtime detection
+#if defined(__SSE2__)
+    #define ctk_case_baseline ctk_case_sse2
+#else
+    #define ctk_case_baseline ctk_case_swar
+#endif
+/*------------------------------------------------------------------------------
+    ctk_case_select()
+------------------------------------------------------------------------------*/
+// Selects the best kernel for the running CPU
+static ctk_case_fn * ctk_case_select(void)
+{
+#if defined(CTK_CASE_AVX2)
+    if(ctk_cpu_probe().avx2) {
+        return ctk_case_avx2;
+    }
+#endif
+    return ctk_case_baseline;
+}
+/*------------------------------------------------------------------------------
+    ctk_case_dispatch()
+------------------------------------------------------------------------------*/
+// Kernel used for arrays of at least CTK_CASE_DISPATCH_MIN bytes
+CTK_DISPATCH(char *, ctk_case_dispatch,
+    (char * dest, const char * src, size_t length, unsigned char first),
+    (dest, src, length, first),
+    ctk_case_select
+)
+/*------------------------------------------------------------------------------
+    ctk_case_lower_swar()
+------------------------------------------------------------------------------*/
+// The 8 bytes of `word` with the ASCII uppercase letters in lowercase
+static uint64_t ctk_case_lower_swar(const uint64_t word)
+{
+    const uint64_t ones  = UINT64_C(0x0101010101010101);
+    const uint64_t highs = UINT64_C(0x8080808080808080);
+    const uint64_t ge_first = ones * (uint64_t)(0x80 - 'A');
+    const uint64_t gt_last  = ones * (uint64_t)(0x80 - 'A' - CTK_CASE_LETTERS);
+    const uint64_t low7 = word & ~highs;
+    const uint64_t in_range =
+        ((low7 + ge_first) ^ (low7 + gt_last)) & ~word & highs;
+    return word | in_range >> 2;
+}
+#if defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_case_lower_sse2()
+------------------------------------------------------------------------------*/
+// The 16 bytes at `src` with the ASCII uppercase letters in lowercase
+static __m128i ctk_case_lower_sse2(const char * const src)
+{
+    const __m128i bias  = _mm_set1_epi8((char)(0x80 - 'A'));
+    const __m128i limit = _mm_set1_epi8((char)(-0x80 + CTK_CASE_LETTERS));
+    const __m128i flip  = _mm_set1_epi8(CTK_CASE_BIT);
+    const __m128i bytes = _mm_loadu_si128((const void *)src);
+    const __m128i in_range = _mm_cmplt_epi8(_mm_add_epi8(bytes, bias), limit);
+    return _mm_or_si128(bytes, _mm_and_si128(in_range, flip));
+}
+/*------------------------------------------------------------------------------
+    ctk_case_windows_sse2()
+------------------------------------------------------------------------------*/
+// Bit `i` is set if the window starting at `hay + i` begins with `first` and
+// ends with `last`, ignoring the case, for the 16 windows starting at `hay`
+static unsigned int ctk_case_windows_sse2(
+    const char * const hay, const size_t needle_len,
+    const __m128i first, const __m128i last
+)
+{
+    const __m128i heads = ctk_case_lower_sse2(hay);
+    const __m128i tails = ctk_case_lower_sse2(hay + needle_len - 1);
+    return (unsigned int)_mm_movemask_epi8(_mm_and_si128(
+        _mm_cmpeq_epi8(heads, first), _mm_cmpeq_epi8(tails, last)
+    ));
+}
+#endif
+/*------------------------------------------------------------------------------
+    ctk_case_fwd_two_way()
+------------------------------------------------------------------------------*/
+// Finds the first occurrence of the needle starting at or after window `pos`
+static const char * ctk_case_fwd_two_way(
+    const char * const hay, const size_t hay_len,
+    const char * const needle, const size_t needle_len, const size_t pos
+)
+{
+    const size_t found = ctk_search_two_way(
+        (const unsigned char *)hay + pos, hay_len - pos,
+        (const unsigned char *)needle, needle_len, 1, true
+    );
+    if(found == SIZE_MAX) {
+        return NULL;
+    }
+    return hay + pos + found;
+}
+/*------------------------------------------------------------------------------
+    ctk_case_rev_two_way()
+------------------------------------------------------------------------------*/
+// Finds the last occurrence of the needle starting at or before window `pos`
+static const char * ctk_case_rev_two_way(
+    const char * const hay, const char * const needle, const size_t needle_len,
+    const size_t pos
+)
+{
+    const size_t found = ctk_search_two_way(
+        (const unsigned char *)hay + pos + needle_len - 1, pos + needle_len,
+        (const unsigned char *)needle + needle_len - 1, needle_len, -1, true
+    );
+    if(found == SIZE_MAX) {
+        return NULL;
+    }
+    return hay + pos - found;
+}
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_case_ascii()
+------------------------------------------------------------------------------*/
+void ctk_case_ascii(
+    char * const dest, const char * const src, const size_t length,
+    const unsigned char first
+)
+{
+    if(length < CTK_CASE_DISPATCH_MIN) {
+        ctk_case_baseline(dest, src, length, first);
+        return;
+    }
+    ctk_case_dispatch(dest, src, length, first);
+}
+/*------------------------------------------------------------------------------
+    ctk_case_equal()
+------------------------------------------------------------------------------*/
+bool ctk_case_equal(
+    const char * const lhs, const char * const rhs, const size_t length
+)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    for(; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+        const __m128i equal = _mm_cmpeq_epi8(
+            ctk_case_lower_sse2(lhs + i), ctk_case_lower_sse2(rhs + i)
+        );
+        if(_mm_movemask_epi8(equal) != 0xFFFF) {
+            return false;
+        }
+    }
+#endif
+    for(; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t lhs_word;
+        uint64_t rhs_word;
+        memcpy(&lhs_word, lhs + i, sizeof(lhs_word));
+        memcpy(&rhs_word, rhs + i, sizeof(rhs_word));
+        if(ctk_case_lower_swar(lhs_word) != ctk_case_lower_swar(rhs_word)) {
+            return false;
+        }
+    }
+    for(; i < length; i++) {
+        if(CTK_ASCII_TOLOWER(lhs[i]) != CTK_ASCII_TOLOWER(rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_case_search_fwd()
+------------------------------------------------------------------------------*/
+const char * ctk_case_search_fwd(
+    const char * const hay, const size_t hay_len,
+    const char * const needle, const size_t needle_len
+)
+{
+    if(needle_len == 0) {
+        return hay;
+    }
+    if(needle_len > hay_len) {
+        return NULL;
+    }
+    const size_t windows = hay_len - needle_len + 1;
+    const int first = CTK_ASCII_TOLOWER(needle[0]);
+    const int last = CTK_ASCII_TOLOWER(needle[needle_len - 1]);
+    // Bytes left to compare once the first and the last ones match
+    const size_t inner = needle_len > 2 ? needle_len - 2 : 0;
+    size_t work = 0;
+    size_t pos = 0;
+#if defined(__SSE2__)
+    const __m128i first_v = _mm_set1_epi8((char)first);
+    const __m128i last_v = _mm_set1_epi8((char)last);
+    for(; pos + sizeof(__m128i) <= windows; pos += sizeof(__m128i)) {
+        unsigned int mask =
+            ctk_case_windows_sse2(hay + pos, needle_len, first_v, last_v);
+        while(mask != 0) {
+            const size_t at = pos + (size_t)__builtin_ctz(mask);
+            if(ctk_case_equal(hay + at + 1, needle + 1, inner)) {
+                return hay + at;
+            }
+            work += inner;
+            if(work > CTK_CASE_WORK_PER_WINDOW * at + CTK_CASE_WORK_MIN) {
+                return ctk_case_fwd_two_way(
+                    hay, hay_len, needle, needle_len, at
+                );
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for(; pos < windows; pos++) {
+        if(CTK_ASCII_TOLOWER(hay[pos]) != first
+        || CTK_ASCII_TOLOWER(hay[pos + needle_len - 1]) != last) {
+            continue;
+        }
+        if(ctk_case_equal(hay + pos + 1, needle + 1, inner)) {
+            return hay + pos;
+        }
+        work += inner;
+        if(work > CTK_CASE_WORK_PER_WINDOW * pos + CTK_CASE_WORK_MIN) {
+            return ctk_case_fwd_two_way(hay, hay_len, needle, needle_len, pos);
+        }
+    }
+    return NULL;
+}
+/*------------------------------------------------------------------------------
+    ctk_case_search_rev()
+------------------------------------------------------------------------------*/
+const char * ctk_case_search_rev(
+    const char * const hay, const size_t hay_len,
+    const char * const needle, const size_t needle_len
+)
+{
+    if(needle_len == 0) {
+        return hay;
+    }
+    if(needle_len > hay_len) {
+        return NULL;
+    }
+    const size_t windows = hay_len - needle_len + 1;
+    const int first = CTK_ASCII_TOLOWER(needle[0]);
+    const int last = CTK_ASCII_TOLOWER(needle[needle_len - 1]);
+    const size_t inner = needle_len > 2 ? needle_len - 2 : 0;
+    size_t work = 0;
+    // Windows `[0, end)` are left to check
+    size_t end = windows;
+#if defined(__SSE2__)
+    const __m128i first_v = _mm_set1_epi8((char)first);
+    const __m128i last_v = _mm_set1_epi8((char)last);
+    for(; end >= sizeof(__m128i); end -= sizeof(__m128i)) {
+        const size_t base = end - sizeof(__m128i);
+        unsigned int mask =
+            ctk_case_windows_sse2(hay + base, needle_len, first_v, last_v);
+        while(mask != 0) {
+            const size_t top =
+                sizeof(mask) * CHAR_BIT - 1 - (size_t)__builtin_clz(mask);
+            const size_t at = base + top;
+            if(ctk_case_equal(hay + at + 1, needle + 1, inner)) {
+                return hay + at;
+            }
+            work += inner;
+            if(work > CTK_CASE_WORK_PER_WINDOW * (windows - at)
+                + CTK_CASE_WORK_MIN) {
+                return ctk_case_rev_two_way(hay, needle, needle_len, at);
+            }
+            mask ^= 1U << top;
+        }
+    }
+#endif
+    while(end > 0) {
+        end--;
+        if(CTK_ASCII_TOLOWER(hay[end]) != first
+        || CTK_ASCII_TOLOWER(hay[end + needle_len - 1]) != last) {
+            continue;
+        }
+        if(ctk_case_equal(hay + end + 1, needle + 1, inner)) {
+            return hay + end;
+        }
+        work += inner;
+        if(work > CTK_CASE_WORK_PER_WINDOW * (windows - end)
+            + CTK_CASE_WORK_MIN) {
+            return ctk_case_rev_two_way(hay, needle, needle_len, end);
+        }
+    }
+    return NULL;
+}
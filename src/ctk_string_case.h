@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Private ASCII case conversion kernels shared by the string functions.
+ *
+ * @details
+ * - Only the 26 ASCII letters are converted, all other bytes(including the
+ *   ones >= `0x80`) are copied as is, whatever the current locale.
+ * - Arrays are processed 32 bytes per iteration with AVX2, 16 with SSE2 and 8
+ *   with a portable SWAR(SIMD within a register) fallback. The best kernel
+ *   supported by the CPU is selected once with #CTK_DISPATCH().
+ * - The case-insensitive comparisons and searches fold both sides to lower
+ *   case in registers, 16 bytes at a time with SSE2: nothing is copied.
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_STRING_CASE_H_20261018120417
+#define CTK_STRING_CASE_H_20261018120417
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stdbool.h>
+#include <stddef.h> // size_t
+/*==============================================================================
+    FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_case_ascii()
+------------------------------------------------------------------------------*/
+/**
+ * Copies \p{length} bytes from \p{src} to \p{dest} while flipping the case of
+ * the 26 ASCII letters starting at \p{first}.
+ *
+ * - \p{first} is `'A'` to convert to lower case and `'a'` to convert to upper
+ *   case.
+ * - \p{dest} may be equal to \p{src} to convert in-place.
+ *
+ * @param[out] dest   : The array where to write the converted bytes.
+ * @param[in]  src    : The array to convert.
+ * @param[in]  length : Number of bytes to convert.
+ * @param[in]  first  : First letter of the range to convert.
+ *
+ * @warning
+ * - \b [UB] \p{dest} and \p{src} must either be equal or not overlap.
+ */
+void ctk_case_ascii(
+    char * dest, const char * src, size_t length, unsigned char first
+);
+/*------------------------------------------------------------------------------
+    ctk_case_equal()
+------------------------------------------------------------------------------*/
+/**
+ * Compares \p{length} bytes of two arrays, ignoring the case of the 26 ASCII
+ * letters.
+ *
+ * @param[in] lhs    : The first array to compare.
+ * @param[in] rhs    : The second array to compare.
+ * @param[in] length : Number of bytes to compare.
+ *
+ * @return `true` if the arrays are equal, `false` otherwise.
+ */
+bool ctk_case_equal(const char * lhs, const char * rhs, size_t length);
+/*------------------------------------------------------------------------------
+    ctk_case_search_fwd()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first occurrence of a needle in a haystack, ignoring the case of
+ * the 26 ASCII letters.
+ *
+ * - Same as ctk_search_fwd() otherwise.
+ *
+ * @param[in] hay        : The array to search in.
+ * @param[in] hay_len    : Length of \p{hay}.
+ * @param[in] needle     : The array to search for.
+ * @param[in] needle_len : Length of \p{needle}.
+ *
+ * @return
+ * - @success:
+ *   - A pointer to the first byte of the first occurrence of \p{needle}.
+ *   - \p{hay} if \p{needle_len} is `0`.
+ * - @failure: `NULL`.
+ */
+const char * ctk_case_search_fwd(
+    const char * hay, size_t hay_len, const char * needle, size_t needle_len
+);
+/*------------------------------------------------------------------------------
+    ctk_case_search_rev()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last occurrence of a needle in a haystack, ignoring the case of
+ * the 26 ASCII letters.
+ *
+ * - Same as ctk_search_rev() otherwise.
+ *
+ * @param[in] hay        : The array to search in.
+ * @param[in] hay_len    : Length of \p{hay}.
+ * @param[in] needle     : The array to search for.
+ * @param[in] needle_len : Length of \p{needle}.
+ *
+ * @return
+ * - @success:
+ *   - A pointer to the first byte of the last occurrence of \p{needle}.
+ *   - \p{hay} if \p{needle_len} is `0`.
+ * - @failure: `NULL`.
+ */
+const char * ctk_case_search_rev(
+    const char * hay, size_t hay_len, const char * needle, size_t needle_len
+);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_STRING_CASE_H_20261018120417
@@ -0,0 +1,608 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * 64-bit non-cryptographic hash of ctk_string.h.
+ *
+ * @details
+ * - Up to 16 bytes: the bytes are packed in two words which are multiplied
+ *   once(128-bit product) as in wyhash.
+ * - Up to 128 bytes: pairs of words read from both ends are mixed with the
+ *   secret and multiplied independently, the products are summed.
+ * - Longer inputs are cut into 32-byte stripes accumulated in four 64-bit
+ *   lanes as in XXH3: each lane adds its data word to its neighbour and the
+ *   product of the two halves of the data word XOR a secret word. Stripes use
+ *   secret words at different offsets and the lanes are scrambled every 16
+ *   stripes. The last 32 bytes are always accumulated as a final stripe.
+ * - The stripe loop only uses 32x32->64 multiplications, which SSE2 and AVX2
+ *   provide: the vector kernels compute exactly the same value as the scalar
+ *   one and are selected at runtime with CTK_DISPATCH().
+ * - Words are read in little-endian order so that hashes are the same on
+ *   every platform.
+ *
+ * @see
+ * - Wang Yi, "wyhash", https://github.com/wangyi-fudan/wyhash
+ * - Collet Y., "XXH3", https://github.com/Cyan4973/xxHash
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_string.h"
+// C Standard Library
+#include <stdatomic.h> // CTK_DISPATCH() without CTK_IFUNC
+#include <stddef.h>    // size_t
+#include <stdint.h>    // UINT32_C, UINT64_C, uint32_t, uint64_t
+#include <string.h>    // memcpy(), strlen()
+// SIMD
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #include <immintrin.h>
+    // AVX2 kernel is compiled with a target attribute and selected at runtime
+    #define CTK_HASH_AVX2 1
+#endif
+// Internal
+#include "ctk_cpu.h"
+#include "ctk_error.h"
+#include "ctk_string_hash.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// Longest inputs hashed without the stripe loop
+#define CTK_HASH_SHORT 16
+#define CTK_HASH_MEDIUM 128
+// Bytes accumulated per stripe and stripes per block, lanes are scrambled at
+// the end of each block
+#define CTK_HASH_STRIPE 32
+#define CTK_HASH_BLOCK_STRIPES 16
+#define CTK_HASH_LANES 4
+// Offsets in the secret of the words used by the scrambling, the last stripe
+// and the merge of the lanes
+#define CTK_HASH_SECRET_SIZE 192
+#define CTK_HASH_SCRAMBLE (CTK_HASH_SECRET_SIZE - CTK_HASH_STRIPE)
+#define CTK_HASH_LAST (CTK_HASH_SECRET_SIZE - CTK_HASH_STRIPE - 7)
+#define CTK_HASH_MERGE 11
+// Odd constants of XXH64
+#define CTK_HASH_PRIME32_1 UINT32_C(0x9E3779B1)
+#define CTK_HASH_PRIME32_3 UINT32_C(0xC2B2AE3D)
+#define CTK_HASH_PRIME64_1 UINT64_C(0x9E3779B185EBCA87)
+#define CTK_HASH_PRIME64_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define CTK_HASH_PRIME64_3 UINT64_C(0x165667B19E3779F9)
+/*==============================================================================
+    TYPE
+==============================================================================*/
+// Signature shared by the stripe kernels: accumulates `count` stripes, the
+// first one being the stripe `index` of its block, and returns the index of
+// the next stripe
+typedef size_t ctk_hash_stripes_fn(
+    uint64_t * acc, const unsigned char * data, size_t count, size_t index,
+    uint64_t seed
+);
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+// Random bytes(splitmix64 output) mixed with the input. The first 16 are
+// CTK_HASH_SECRET_0 and CTK_HASH_SECRET_8 of ctk_string_hash.h.
+static const unsigned char ctk_hash_secret[CTK_HASH_SECRET_SIZE] = {
+    0xF5, 0xD0, 0x41, 0x74, 0xE2, 0xCE, 0xB1, 0x04,
+    0x16, 0x53, 0x8C, 0x53, 0x74, 0xFF, 0xF7, 0x17,
+    0xF4, 0x26, 0x92, 0xA5, 0x2E, 0xC7, 0x16, 0x15,
+    0x10, 0xD3, 0x09, 0x8A, 0x75, 0xC3, 0xF0, 0xA9,
+    0x3B, 0x8C, 0xA1, 0x25, 0x99, 0x52, 0x3D, 0xB1,
+    0x5D, 0xD4, 0x70, 0xC6, 0xEF, 0xCE, 0xCC, 0x48,
+    0xF3, 0xA2, 0xFB, 0x89, 0xD5, 0xFA, 0x20, 0xED,
+    0x75, 0x5E, 0x80, 0x56, 0x87, 0x9C, 0x4E, 0x2D,
+    0xEA, 0xED, 0x79, 0xA5, 0x22, 0x8B, 0xEF, 0x0F,
+    0x73, 0x91, 0xE5, 0x05, 0xCE, 0x65, 0x7A, 0x37,
+    0xC1, 0x84, 0xFA, 0xB9, 0x2F, 0x64, 0xA1, 0x9E,
+    0x48, 0xC5, 0x5F, 0xDF, 0x1C, 0x0B, 0xCC, 0xAB,
+    0xF8, 0xB8, 0xC2, 0x4D, 0x7E, 0xBE, 0x91, 0x78,
+    0xFA, 0x45, 0x7C, 0x18, 0x3E, 0x76, 0x11, 0xAB,
+    0xE1, 0xB2, 0x3E, 0xE2, 0x8B, 0xFD, 0x29, 0x0B,
+    0x4F, 0xFE, 0x17, 0x27, 0x2C, 0x3A, 0x90, 0xAA,
+    0xC2, 0x8C, 0xA0, 0x52, 0x77, 0x95, 0x07, 0x36,
+    0x92, 0x55, 0x6E, 0x29, 0x25, 0x26, 0x6A, 0x97,
+    0xB0, 0xBE, 0x77, 0x7B, 0xA6, 0xBA, 0x32, 0x90,
+    0x1F, 0xF6, 0x24, 0x59, 0x88, 0xB5, 0x89, 0xDF,
+    0xFD, 0xC3, 0xF1, 0x7D, 0x2B, 0xF8, 0x32, 0x51,
+    0xD5, 0xA6, 0x72, 0xF2, 0x98, 0x71, 0x7B, 0x5E,
+    0xB4, 0xA6, 0x17, 0x46, 0xA6, 0xFB, 0x87, 0x0F,
+    0x7E, 0xEA, 0x90, 0xEA, 0x26, 0x06, 0xBE, 0x6F,
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hash_read64()
+------------------------------------------------------------------------------*/
+// Little-endian loads
+static uint64_t ctk_hash_read64(const unsigned char * const bytes)
+{
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_read32()
+------------------------------------------------------------------------------*/
+static uint64_t ctk_hash_read32(const unsigned char * const bytes)
+{
+    uint32_t word;
+    memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap32(word);
+#endif
+    return word;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_secret64()
+------------------------------------------------------------------------------*/
+static uint64_t ctk_hash_secret64(const size_t offset)
+{
+    return ctk_hash_read64(ctk_hash_secret + offset);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_avalanche()
+------------------------------------------------------------------------------*/
+static uint64_t ctk_hash_avalanche(uint64_t hash)
+{
+    hash ^= hash >> 37;
+    hash *= CTK_HASH_PRIME64_3;
+    return hash ^ (hash >> 32);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_short()
+------------------------------------------------------------------------------*/
+// 0 to CTK_HASH_SHORT bytes: two words read from overlapping positions
+static uint64_t ctk_hash_short(
+    const unsigned char * const data, const size_t length, uint64_t seed
+)
+{
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if(length >= 4) {
+        // From 4 to 16 bytes with four, possibly overlapping, 32-bit reads
+        const size_t shift = (length >> 3) << 2;
+        a = ctk_hash_read32(data) << 32 | ctk_hash_read32(data + shift);
+        b = ctk_hash_read32(data + length - 4) << 32
+            | ctk_hash_read32(data + length - 4 - shift);
+    }
+    if(length > 0 && length < 4) {
+        a = (uint64_t)data[0] << 16 | (uint64_t)data[length >> 1] << 8
+            | data[length - 1];
+    }
+    return ctk_hash_pair(a, b, length, seed);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_mix16()
+------------------------------------------------------------------------------*/
+static uint64_t ctk_hash_mix16(
+    const unsigned char * const data, const size_t offset, const uint64_t seed
+)
+{
+    return ctk_hash_mix(
+        ctk_hash_read64(data) ^ (ctk_hash_secret64(offset) + seed),
+        ctk_hash_read64(data + 8) ^ (ctk_hash_secret64(offset + 8) - seed)
+    );
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_medium()
+------------------------------------------------------------------------------*/
+// CTK_HASH_SHORT + 1 to CTK_HASH_MEDIUM bytes: 16-byte pairs read from both
+// ends, the products don't depend on each other
+static uint64_t ctk_hash_medium(
+    const unsigned char * const data, const size_t length, const uint64_t seed
+)
+{
+    uint64_t hash = length * CTK_HASH_PRIME64_1;
+    for(size_t i = 0; i < (length - 1) / 32 + 1; i++) {
+        hash += ctk_hash_mix16(data + 16 * i, 32 * i, seed);
+        hash += ctk_hash_mix16(data + length - 16 * (i + 1), 32 * i + 16, seed);
+    }
+    return ctk_hash_avalanche(hash);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_key()
+------------------------------------------------------------------------------*/
+// Secret word of a lane, the seed is added to even lanes and subtracted from
+// odd ones
+static uint64_t ctk_hash_key(
+    const size_t offset, const size_t lane, const uint64_t seed
+)
+{
+    const uint64_t word = ctk_hash_secret64(offset + 8 * lane);
+    return lane % 2 == 0 ? word + seed : word - seed;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_accumulate()
+------------------------------------------------------------------------------*/
+static void ctk_hash_accumulate(
+    uint64_t * const acc, const unsigned char * const stripe,
+    const size_t offset, const uint64_t seed
+)
+{
+    for(size_t lane = 0; lane < CTK_HASH_LANES; lane++) {
+        const uint64_t word = ctk_hash_read64(stripe + 8 * lane);
+        const uint64_t key = word ^ ctk_hash_key(offset, lane, seed);
+        acc[lane ^ 1] += word;
+        acc[lane] += (key & UINT64_C(0xFFFFFFFF)) * (key >> 32);
+    }
+}
+#if !defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_hash_scramble()
+------------------------------------------------------------------------------*/
+static void ctk_hash_scramble(uint64_t * const acc, const uint64_t seed)
+{
+    for(size_t lane = 0; lane < CTK_HASH_LANES; lane++) {
+        acc[lane] ^= acc[lane] >> 47;
+        acc[lane] ^= ctk_hash_key(CTK_HASH_SCRAMBLE, lane, seed);
+        acc[lane] *= CTK_HASH_PRIME32_1;
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_stripes_scalar()
+------------------------------------------------------------------------------*/
+static size_t ctk_hash_stripes_scalar(
+    uint64_t * const acc, const unsigned char * const data, const size_t count,
+    size_t index, const uint64_t seed
+)
+{
+    for(size_t i = 0; i < count; i++) {
+        ctk_hash_accumulate(acc, data + CTK_HASH_STRIPE * i, 8 * index, seed);
+        if(++index == CTK_HASH_BLOCK_STRIPES) {
+            ctk_hash_scramble(acc, seed);
+            index = 0;
+        }
+    }
+    return index;
+}
+#endif
+#if defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_hash_stripes_sse2()
+------------------------------------------------------------------------------*/
+// Lanes 0-1 and 2-3 in two registers
+static size_t ctk_hash_stripes_sse2(
+    uint64_t * const acc, const unsigned char * const data, const size_t count,
+    size_t index, const uint64_t seed
+)
+{
+    const __m128i seeds =
+        _mm_set_epi64x((long long)(0 - seed), (long long)seed);
+    const __m128i prime = _mm_set1_epi32((int)CTK_HASH_PRIME32_1);
+    __m128i acc_lo = _mm_loadu_si128((const void *)acc);
+    __m128i acc_hi = _mm_loadu_si128((const void *)(acc + 2));
+    for(size_t i = 0; i < count; i++) {
+        const unsigned char * const stripe = data + CTK_HASH_STRIPE * i;
+        const unsigned char * const secret = ctk_hash_secret + 8 * index;
+        __m128i words[2];
+        __m128i * const accs[2] = {&acc_lo, &acc_hi};
+        for(size_t half = 0; half < 2; half++) {
+            words[half] = _mm_loadu_si128((const void *)(stripe + 16 * half));
+            const __m128i key = _mm_xor_si128(words[half], _mm_add_epi64(
+                _mm_loadu_si128((const void *)(secret + 16 * half)), seeds
+            ));
+            // Low half times high half of each 64-bit lane
+            const __m128i product = _mm_mul_epu32(
+                key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1))
+            );
+            // Data word added to the other lane of the pair
+            const __m128i swapped =
+                _mm_shuffle_epi32(words[half], _MM_SHUFFLE(1, 0, 3, 2));
+            *accs[half] = _mm_add_epi64(
+                *accs[half], _mm_add_epi64(product, swapped)
+            );
+        }
+        if(++index == CTK_HASH_BLOCK_STRIPES) {
+            const unsigned char * const scramble =
+                ctk_hash_secret + CTK_HASH_SCRAMBLE;
+            for(size_t half = 0; half < 2; half++) {
+                __m128i value = *accs[half];
+                value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+                value = _mm_xor_si128(value, _mm_add_epi64(
+                    _mm_loadu_si128((const void *)(scramble + 16 * half)),
+                    seeds
+                ));
+                // 64x32-bit multiplication from two 32x32->64 ones
+                const __m128i low = _mm_mul_epu32(value, prime);
+                const __m128i high =
+                    _mm_mul_epu32(_mm_srli_epi64(value, 32), prime);
+                *accs[half] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+            }
+            index = 0;
+        }
+    }
+    _mm_storeu_si128((void *)acc, acc_lo);
+    _mm_storeu_si128((void *)(acc + 2), acc_hi);
+    return index;
+}
+#endif
+#if defined(CTK_HASH_AVX2)
+/*------------------------------------------------------------------------------
+    ctk_hash_stripes_avx2()
+------------------------------------------------------------------------------*/
+// The four lanes in one register
+__attribute__((target("avx2")))
+static size_t ctk_hash_stripes_avx2(
+    uint64_t * const acc, const unsigned char * const data, const size_t count,
+    size_t index, const uint64_t seed
+)
+{
+    const __m256i seeds = _mm256_set_epi64x(
+        (long long)(0 - seed), (long long)seed,
+        (long long)(0 - seed), (long long)seed
+    );
+    const __m256i prime = _mm256_set1_epi32((int)CTK_HASH_PRIME32_1);
+    __m256i lanes = _mm256_loadu_si256((const void *)acc);
+    for(size_t i = 0; i < count; i++) {
+        const __m256i words = _mm256_loadu_si256(
+            (const void *)(data + CTK_HASH_STRIPE * i)
+        );
+        const __m256i key = _mm256_xor_si256(words, _mm256_add_epi64(
+            _mm256_loadu_si256((const void *)(ctk_hash_secret + 8 * index)),
+            seeds
+        ));
+        const __m256i product = _mm256_mul_epu32(
+            key, _mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1))
+        );
+        const __m256i swapped =
+            _mm256_shuffle_epi32(words, _MM_SHUFFLE(1, 0, 3, 2));
+        lanes = _mm256_add_epi64(lanes, _mm256_add_epi64(product, swapped));
+        if(++index == CTK_HASH_BLOCK_STRIPES) {
+            lanes = _mm256_xor_si256(lanes, _mm256_srli_epi64(lanes, 47));
+            lanes = _mm256_xor_si256(lanes, _mm256_add_epi64(
+                _mm256_loadu_si256(
+                    (const void *)(ctk_hash_secret + CTK_HASH_SCRAMBLE)
+                ),
+                seeds
+            ));
+            const __m256i low = _mm256_mul_epu32(lanes, prime);
+            const __m256i high =
+                _mm256_mul_epu32(_mm256_srli_epi64(lanes, 32), prime);
+            lanes = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+            index = 0;
+        }
+    }
+    _mm256_storeu_si256((void *)acc, lanes);
+    // Avoid the AVX to SSE transition penalty in the caller
+    _mm256_zeroupper();
+    return index;
+}
+#endif
+// Best kernel available without runtime detection
+#if defined(__SSE2__)
+    #define ctk_hash_stripes_baseline ctk_hash_stripes_sse2
+#else
+    #define ctk_hash_stripes_baseline ctk_hash_stripes_scalar
+#endif
+/*------------------------------------------------------------------------------
+    ctk_hash_stripes_select()
+------------------------------------------------------------------------------*/
+// Selects the best kernel for the running CPU
+static ctk_hash_stripes_fn * ctk_hash_stripes_select(void)
+{
+#if defined(CTK_HASH_AVX2)
+    if(ctk_cpu_probe().avx2) {
+        return ctk_hash_stripes_avx2;
+    }
+#endif
+    return ctk_hash_stripes_baseline;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_stripes()
+------------------------------------------------------------------------------*/
+CTK_DISPATCH(size_t, ctk_hash_stripes,
+    (uint64_t * acc, const unsigned char * data, size_t count, size_t index,
+        uint64_t seed),
+    (acc, data, count, index, seed),
+    ctk_hash_stripes_select
+)
+/*------------------------------------------------------------------------------
+    ctk_hash_acc_init()
+------------------------------------------------------------------------------*/
+static void ctk_hash_acc_init(uint64_t * const acc)
+{
+    acc[0] = CTK_HASH_PRIME32_3;
+    acc[1] = CTK_HASH_PRIME64_1;
+    acc[2] = CTK_HASH_PRIME64_2;
+    acc[3] = CTK_HASH_PRIME64_3;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_merge()
+------------------------------------------------------------------------------*/
+// Accumulates the last stripe and folds the lanes into the hash
+static uint64_t ctk_hash_merge(
+    uint64_t * const acc, const unsigned char * const last,
+    const uint64_t length, const uint64_t seed
+)
+{
+    ctk_hash_accumulate(acc, last, CTK_HASH_LAST, seed);
+    uint64_t hash = length * CTK_HASH_PRIME64_1;
+    hash += ctk_hash_mix(
+        acc[0] ^ ctk_hash_secret64(CTK_HASH_MERGE),
+        acc[1] ^ ctk_hash_secret64(CTK_HASH_MERGE + 8)
+    );
+    hash += ctk_hash_mix(
+        acc[2] ^ ctk_hash_secret64(CTK_HASH_MERGE + 16),
+        acc[3] ^ ctk_hash_secret64(CTK_HASH_MERGE + 24)
+    );
+    return ctk_hash_avalanche(hash);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_long()
+------------------------------------------------------------------------------*/
+// More than CTK_HASH_MEDIUM bytes. The stripes of the loop stop before the
+// last byte, which keeps a final stripe for the streaming interface as well.
+static uint64_t ctk_hash_long(
+    const unsigned char * const data, const size_t length, const uint64_t seed
+)
+{
+    uint64_t acc[CTK_HASH_LANES];
+    ctk_hash_acc_init(acc);
+    ctk_hash_stripes(acc, data, (length - 1) / CTK_HASH_STRIPE, 0, seed);
+    return ctk_hash_merge(acc, data + length - CTK_HASH_STRIPE, length, seed);
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hash()
+------------------------------------------------------------------------------*/
+uint64_t ctk_hash(const char * const str)
+{
+    CTK_ERROR_RET_0_IF(str == NULL);
+    return ctk_hash_seeded_n(str, strlen(str), 0);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_final()
+------------------------------------------------------------------------------*/
+uint64_t ctk_hash_final(const struct ctk_hash_state * const state)
+{
+    CTK_ERROR_RET_0_IF(state == NULL);
+    // Nothing was hashed in place: the whole input is in the buffer
+    if(state->length <= CTK_HASH_MEDIUM) {
+        return ctk_hash_seeded_n(
+            state->buffer, state->buffered, state->seed
+        );
+    }
+    uint64_t acc[CTK_HASH_LANES];
+    memcpy(acc, state->acc, sizeof(acc));
+    ctk_hash_stripes(
+        acc, state->buffer, (state->buffered - 1) / CTK_HASH_STRIPE,
+        state->stripe, state->seed
+    );
+    if(state->buffered >= CTK_HASH_STRIPE) {
+        return ctk_hash_merge(
+            acc, state->buffer + state->buffered - CTK_HASH_STRIPE,
+            state->length, state->seed
+        );
+    }
+    // The last stripe starts in the bytes hashed before the buffer, which
+    // ctk_hash_update() left at the end of the buffer
+    unsigned char last[CTK_HASH_STRIPE];
+    const size_t before = CTK_HASH_STRIPE - state->buffered;
+    memcpy(last, state->buffer + CTK_HASH_BUFFER_SIZE - before, before);
+    memcpy(last + before, state->buffer, state->buffered);
+    return ctk_hash_merge(acc, last, state->length, state->seed);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_init()
+------------------------------------------------------------------------------*/
+void ctk_hash_init(struct ctk_hash_state * const state, const uint64_t seed)
+{
+    CTK_ERROR_RET_IF(state == NULL);
+    ctk_hash_acc_init(state->acc);
+    state->seed = seed;
+    state->length = 0;
+    state->stripe = 0;
+    state->buffered = 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_n()
+------------------------------------------------------------------------------*/
+uint64_t ctk_hash_n(const void * const data, const size_t length)
+{
+    return ctk_hash_seeded_n(data, length, 0);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_seeded()
+------------------------------------------------------------------------------*/
+uint64_t ctk_hash_seeded(const char * const str, const uint64_t seed)
+{
+    CTK_ERROR_RET_0_IF(str == NULL);
+    return ctk_hash_seeded_n(str, strlen(str), seed);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_seeded_n()
+------------------------------------------------------------------------------*/
+uint64_t ctk_hash_seeded_n(
+    const void * const data, const size_t length, const uint64_t seed
+)
+{
+    CTK_ERROR_RET_0_IF(data == NULL && length != 0);
+    if(length <= CTK_HASH_SHORT) {
+        return ctk_hash_short(data, length, seed);
+    }
+    if(length <= CTK_HASH_MEDIUM) {
+        return ctk_hash_medium(data, length, seed);
+    }
+    return ctk_hash_long(data, length, seed);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_update()
+------------------------------------------------------------------------------*/
+int ctk_hash_update(
+    struct ctk_hash_state * const state, const void * const data,
+    size_t length
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(state == NULL);
+    CTK_ERROR_RET_NEG_1_IF(data == NULL && length != 0);
+    // memcpy() doesn't accept NULL, even for 0 bytes
+    if(length == 0) {
+        return 0;
+    }
+    const unsigned char * bytes = data;
+    state->length += length;
+    if(length <= CTK_HASH_BUFFER_SIZE - state->buffered) {
+        memcpy(state->buffer + state->buffered, bytes, length);
+        state->buffered += length;
+        return 0;
+    }
+    // More bytes follow those of a full buffer: it never holds the last byte
+    if(state->buffered > 0) {
+        const size_t fill = CTK_HASH_BUFFER_SIZE - state->buffered;
+        memcpy(state->buffer + state->buffered, bytes, fill);
+        bytes += fill;
+        length -= fill;
+        state->stripe = ctk_hash_stripes(
+            state->acc, state->buffer,
+            CTK_HASH_BUFFER_SIZE / CTK_HASH_STRIPE, state->stripe, state->seed
+        );
+        state->buffered = 0;
+    }
+    // Stripes of a long chunk are hashed in place, up to the last byte. The
+    // stripe before the remaining bytes is kept at the end of the buffer for
+    // ctk_hash_final().
+    if(length > CTK_HASH_BUFFER_SIZE) {
+        const size_t count = (length - 1) / CTK_HASH_STRIPE;
+        state->stripe = ctk_hash_stripes(
+            state->acc, bytes, count, state->stripe, state->seed
+        );
+        bytes += count * CTK_HASH_STRIPE;
+        length -= count * CTK_HASH_STRIPE;
+        memcpy(
+            state->buffer + CTK_HASH_BUFFER_SIZE - CTK_HASH_STRIPE,
+            bytes - CTK_HASH_STRIPE, CTK_HASH_STRIPE
+        );
+    }
+    memcpy(state->buffer, bytes, length);
+    state->buffered = length;
+    return 0;
+}
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Private core of the hash of ctk_string.h for short inputs.
+ *
+ * @details
+ * - The functions are static inline: ctk_hashmap hashes its fixed-size keys
+ *   without calling ctk_hash_n(), whose call through the PLT and length
+ *   dispatch cost as much as the rest of a lookup.
+ * - They compute exactly the values of ctk_hash_n().
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_STRING_HASH_H_20261018203544
+#define CTK_STRING_HASH_H_20261018203544
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <stddef.h> // size_t
+#include <stdint.h> // UINT64_C, uint32_t, uint64_t
+#include <string.h> // memcpy()
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+// First two little-endian words of the secret, the only ones read for inputs
+// of up to 16 bytes
+#define CTK_HASH_SECRET_0 UINT64_C(0x04B1CEE27441D0F5)
+#define CTK_HASH_SECRET_8 UINT64_C(0x17F7FF74538C5316)
+// Inlined at every optimization level, `inline` alone is only a hint
+#if defined(__GNUC__)
+    #define CTK_HASH_INLINE __attribute__((always_inline)) static inline
+#else
+    #define CTK_HASH_INLINE static inline
+#endif
+/*==============================================================================
+    FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_hash_mul128()
+------------------------------------------------------------------------------*/
+// Replaces `*a` and `*b` by the low and high halves of their product
+CTK_HASH_INLINE void ctk_hash_mul128(uint64_t * const a, uint64_t * const b)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 ctk_hash_u128;
+    const ctk_hash_u128 product = (ctk_hash_u128)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#else
+    const uint64_t mask = UINT64_C(0xFFFFFFFF);
+    const uint64_t lo_lo = (*a & mask) * (*b & mask);
+    const uint64_t hi_lo = (*a >> 32) * (*b & mask);
+    const uint64_t lo_hi = (*a & mask) * (*b >> 32);
+    const uint64_t hi_hi = (*a >> 32) * (*b >> 32);
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & mask) + lo_hi;
+    *b = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    *a = (cross << 32) | (lo_lo & mask);
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_mix()
+------------------------------------------------------------------------------*/
+// Folds the 128-bit product of `a` and `b` to 64 bits
+CTK_HASH_INLINE uint64_t ctk_hash_mix(uint64_t a, uint64_t b)
+{
+    ctk_hash_mul128(&a, &b);
+    return a ^ b;
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_pair()
+------------------------------------------------------------------------------*/
+// Hash of an input of `length` bytes, at most 16, packed in the words `a`
+// and `b`. The seed is mixed first: a constant seed costs nothing.
+CTK_HASH_INLINE uint64_t ctk_hash_pair(
+    uint64_t a, uint64_t b, const size_t length, uint64_t seed
+)
+{
+    seed ^= ctk_hash_mix(seed ^ CTK_HASH_SECRET_0, CTK_HASH_SECRET_8);
+    a ^= CTK_HASH_SECRET_8;
+    b ^= seed;
+    ctk_hash_mul128(&a, &b);
+    return ctk_hash_mix(a ^ CTK_HASH_SECRET_0 ^ length, b ^ CTK_HASH_SECRET_8);
+}
+/*------------------------------------------------------------------------------
+    ctk_hash_word()
+------------------------------------------------------------------------------*/
+// ctk_hash_n() of 4 or 8 bytes, packed as the 32-bit reads of the short path
+CTK_HASH_INLINE uint64_t ctk_hash_word(
+    const void * const data, const size_t length
+)
+{
+    uint32_t lo;
+    uint32_t hi;
+    memcpy(&lo, data, sizeof(lo));
+    memcpy(&hi, (const unsigned char *)data + length - sizeof(hi), sizeof(hi));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    lo = __builtin_bswap32(lo);
+    hi = __builtin_bswap32(hi);
+#endif
+    return ctk_hash_pair(
+        (uint64_t)lo << 32 | hi, (uint64_t)hi << 32 | lo, length, 0
+    );
+}
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_STRING_HASH_H_20261018203544
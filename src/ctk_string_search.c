@@ -0,0 +1,1039 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+// Must be defined before including any header: expose GNU memrchr()
+#define _GNU_SOURCE
+#include "ctk_platform.h"
+// Own header
+#include "ctk_string_search.h"
+// C Standard Library
+#include <limits.h>    // CHAR_BIT, UCHAR_MAX
+#include <stdatomic.h> // CTK_DISPATCH() without CTK_IFUNC
+#include <stdbool.h>
+#include <stddef.h>    // NULL, ptrdiff_t, size_t
+#include <stdint.h>    // SIZE_MAX, UINT64_C, uint64_t
+#include <string.h>    // memchr(), memcmp(), memcpy(), GNU memrchr()
+// SIMD
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #include <immintrin.h>
+    // AVX2 and AVX-512 kernels are compiled with a target attribute and
+    // selected at runtime
+    #define CTK_SEARCH_AVX2 1
+    #define CTK_SEARCH_AVX512 1
+#endif
+// Internal
+#include "ctk_ascii.h"
+#include "ctk_cpu.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Element \p{i} of an array starting at \p{base} and walked with \p{step}.
+ */
+#define CTK_SEARCH_AT(base, i, step) ((base)[(ptrdiff_t)(i) * (step)])
+/**
+ * Byte \p{c} in lowercase if \p{fold} is `true`, as is otherwise.
+ */
+#define CTK_SEARCH_FOLD(c, fold) \
+    ((fold) ? (unsigned char)CTK_ASCII_TOLOWER(c) : (c))
+/**
+ * Whether bytes \p{a} and \p{b} are equal, ignoring the case of ASCII letters
+ * if \p{fold} is `true`.
+ *
+ * - The case is only looked at when the bytes differ: the exact search pays a
+ *   single predictable branch on mismatch.
+ */
+#define CTK_SEARCH_EQ(a, b, fold) \
+    ((a) == (b) \
+        || ((fold) && CTK_ASCII_TOLOWER(a) == CTK_ASCII_TOLOWER(b)))
+// The pair filters give up when more than CTK_SEARCH_MISSES windows matched
+// both bytes but not the needle and comparing them cost more than
+// CTK_SEARCH_MISS_RATIO bytes per window scanned, a window costing
+// CTK_SEARCH_MISS_COST bytes plus the length of the needle: Two-Way is then
+// faster, and keeps the search linear.
+#define CTK_SEARCH_MISSES 8
+#define CTK_SEARCH_MISS_RATIO 8
+#define CTK_SEARCH_MISS_COST 32
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_search_pair_crowded()
+------------------------------------------------------------------------------*/
+// Whether `misses` windows compared in vain with the whole needle in the
+// `scanned` windows cost more than a Two-Way scan
+static bool ctk_search_pair_crowded(
+    const struct ctk_search_pair * const pair, const size_t misses,
+    const size_t scanned
+)
+{
+    return misses > CTK_SEARCH_MISSES
+        && scanned * CTK_SEARCH_MISS_RATIO
+            < misses * (pair->length + CTK_SEARCH_MISS_COST);
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd_scalar()
+------------------------------------------------------------------------------*/
+// Jumps between the occurrences of the first byte of the pair with memchr()
+static size_t ctk_search_pair_fwd_scalar(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const start
+)
+{
+    const size_t offset = pair->offset[0];
+    const size_t begin = *start;
+    size_t misses = 0;
+    while(*start < windows) {
+        const unsigned char * const it = memchr(
+            hay + offset + *start, pair->needle[offset], windows - *start
+        );
+        if(it == NULL) {
+            *start = windows;
+            return SIZE_MAX;
+        }
+        const size_t found = (size_t)(it - hay) - offset;
+        if(memcmp(hay + found, pair->needle, pair->length) == 0) {
+            return found;
+        }
+        *start = found + 1;
+        if(ctk_search_pair_crowded(pair, ++misses, *start - begin)) {
+            break;
+        }
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev_scalar()
+------------------------------------------------------------------------------*/
+// Jumps between the occurrences of the first byte of the pair with memrchr()
+static size_t ctk_search_pair_rev_scalar(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const end
+)
+{
+    (void)windows;
+    const size_t offset = pair->offset[0];
+    const size_t start = *end;
+    size_t misses = 0;
+    while(*end > 0) {
+        const unsigned char * const it = ctk_search_memrchr(
+            hay + offset, pair->needle[offset], *end
+        );
+        if(it == NULL) {
+            *end = 0;
+            return SIZE_MAX;
+        }
+        const size_t found = (size_t)(it - hay) - offset;
+        if(memcmp(hay + found, pair->needle, pair->length) == 0) {
+            return found;
+        }
+        *end = found;
+        if(ctk_search_pair_crowded(pair, ++misses, start - found)) {
+            break;
+        }
+    }
+    return SIZE_MAX;
+}
+#if defined(__SSE2__) || defined(CTK_SEARCH_AVX2) \
+    || defined(CTK_SEARCH_AVX512)
+/*------------------------------------------------------------------------------
+    ctk_search_pair_first()
+------------------------------------------------------------------------------*/
+// Compares the needle with the windows of `mask` from the first one, bit `k`
+// standing for the window at `hay + k`, and counts those which don't match
+static size_t ctk_search_pair_first(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    unsigned long long mask, size_t * const misses
+)
+{
+    while(mask != 0) {
+        const size_t k = (size_t)__builtin_ctzll(mask);
+        if(memcmp(hay + k, pair->needle, pair->length) == 0) {
+            return k;
+        }
+        ++*misses;
+        mask &= mask - 1;
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_last()
+------------------------------------------------------------------------------*/
+// Compares the needle with the windows of `mask` from the last one, bit `k`
+// standing for the window at `hay + k`, and counts those which don't match
+static size_t ctk_search_pair_last(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    unsigned long long mask, size_t * const misses
+)
+{
+    while(mask != 0) {
+        const size_t k =
+            sizeof(mask) * CHAR_BIT - 1 - (size_t)__builtin_clzll(mask);
+        if(memcmp(hay + k, pair->needle, pair->length) == 0) {
+            return k;
+        }
+        ++*misses;
+        mask ^= 1ULL << k;
+    }
+    return SIZE_MAX;
+}
+#endif
+#if defined(__SSE2__)
+/*------------------------------------------------------------------------------
+    ctk_search_pair_mask_sse2()
+------------------------------------------------------------------------------*/
+// Windows of a block of 32 whose first byte of the pair is at `a` and second
+// byte at `b` which match both bytes
+static unsigned long long ctk_search_pair_mask_sse2(
+    const unsigned char * const a, const unsigned char * const b,
+    const __m128i first, const __m128i second
+)
+{
+    const __m128i lo = _mm_and_si128(
+        _mm_cmpeq_epi8(_mm_loadu_si128((const void *)a), first),
+        _mm_cmpeq_epi8(_mm_loadu_si128((const void *)b), second)
+    );
+    const __m128i hi = _mm_and_si128(
+        _mm_cmpeq_epi8(_mm_loadu_si128((const void *)(a + 16)), first),
+        _mm_cmpeq_epi8(_mm_loadu_si128((const void *)(b + 16)), second)
+    );
+    return (unsigned)_mm_movemask_epi8(lo)
+        | (unsigned)_mm_movemask_epi8(hi) << 16;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd_sse2()
+------------------------------------------------------------------------------*/
+// 32 windows per block, the last block overlaps the previous one
+static size_t ctk_search_pair_fwd_sse2(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const start
+)
+{
+    if(windows < 32) {
+        return ctk_search_pair_fwd_scalar(pair, hay, windows, start);
+    }
+    const unsigned char * const a = hay + pair->offset[0];
+    const unsigned char * const b = hay + pair->offset[1];
+    const __m128i first = _mm_set1_epi8((char)pair->needle[pair->offset[0]]);
+    const __m128i second = _mm_set1_epi8((char)pair->needle[pair->offset[1]]);
+    size_t pos = *start;
+    size_t misses = 0;
+    size_t found = SIZE_MAX;
+    while(pos < windows) {
+        // Windows before `pos` are already checked
+        size_t base = pos;
+        unsigned long long keep = 0xFFFFFFFFu;
+        if(windows - pos < 32) {
+            base = windows - 32;
+            keep = keep << (pos - base) & 0xFFFFFFFFu;
+        }
+        const unsigned long long mask =
+            ctk_search_pair_mask_sse2(a + base, b + base, first, second) & keep;
+        found = ctk_search_pair_first(pair, hay + base, mask, &misses);
+        pos = base + 32;
+        if(found != SIZE_MAX) {
+            found += base;
+            break;
+        }
+        if(ctk_search_pair_crowded(pair, misses, pos - *start)) {
+            break;
+        }
+    }
+    *start = pos;
+    return found;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev_sse2()
+------------------------------------------------------------------------------*/
+// 32 windows per block from the end, the first block overlaps the next one
+static size_t ctk_search_pair_rev_sse2(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const end
+)
+{
+    if(windows < 32) {
+        return ctk_search_pair_rev_scalar(pair, hay, windows, end);
+    }
+    const unsigned char * const a = hay + pair->offset[0];
+    const unsigned char * const b = hay + pair->offset[1];
+    const __m128i first = _mm_set1_epi8((char)pair->needle[pair->offset[0]]);
+    const __m128i second = _mm_set1_epi8((char)pair->needle[pair->offset[1]]);
+    size_t pos = *end;
+    size_t misses = 0;
+    size_t found = SIZE_MAX;
+    while(pos > 0) {
+        // Windows from `pos` are already checked
+        unsigned long long keep = 0xFFFFFFFFu;
+        if(pos < 32) {
+            keep = (1ULL << pos) - 1;
+            pos = 0;
+        } else {
+            pos -= 32;
+        }
+        const unsigned long long mask =
+            ctk_search_pair_mask_sse2(a + pos, b + pos, first, second) & keep;
+        found = ctk_search_pair_last(pair, hay + pos, mask, &misses);
+        if(found != SIZE_MAX) {
+            found += pos;
+            break;
+        }
+        if(ctk_search_pair_crowded(pair, misses, *end - pos)) {
+            break;
+        }
+    }
+    *end = pos;
+    return found;
+}
+#endif
+#if defined(CTK_SEARCH_AVX2)
+/*------------------------------------------------------------------------------
+    ctk_search_pair_region_avx2()
+------------------------------------------------------------------------------*/
+// Windows of the 128 from `start` which match both bytes, bit `k` of `mask`
+// standing for window `start + k`: `mask[0]` holds the first 64, `mask[1]` the
+// others. Blocks of 32 starting after `last` start at `last` instead, their
+// windows before the end of the previous block are dropped: short haystacks
+// are tested at once. Returns whether any window matches, most regions have
+// none and are skipped with a single branch.
+__attribute__((target("avx2"), always_inline))
+static inline bool ctk_search_pair_region_avx2(
+    const unsigned char * const a, const unsigned char * const b,
+    const size_t start, const size_t last,
+    const __m256i first, const __m256i second, unsigned long long mask[2]
+)
+{
+    // Windows of block `i` matching both bytes
+    #define CTK_SEARCH_PAIR_EQ(i) _mm256_and_si256( \
+        _mm256_cmpeq_epi8(_mm256_loadu_si256((const void *)(a + at##i)), \
+            first), \
+        _mm256_cmpeq_epi8(_mm256_loadu_si256((const void *)(b + at##i)), \
+            second) \
+    )
+    // Same as CTK_SEARCH_PAIR_EQ() as bits, without the windows of the block
+    // already in the previous one
+    #define CTK_SEARCH_PAIR_BITS(i) \
+        (start + 32 * (i) - at##i < 32 \
+            ? (unsigned long long)((unsigned)_mm256_movemask_epi8(eq##i) \
+                >> (start + 32 * (i) - at##i)) \
+            : 0)
+    const size_t at0 = start < last ? start : last;
+    const size_t at1 = start + 32 < last ? start + 32 : last;
+    const size_t at2 = start + 64 < last ? start + 64 : last;
+    const size_t at3 = start + 96 < last ? start + 96 : last;
+    const __m256i eq0 = CTK_SEARCH_PAIR_EQ(0);
+    const __m256i eq1 = CTK_SEARCH_PAIR_EQ(1);
+    const __m256i eq2 = CTK_SEARCH_PAIR_EQ(2);
+    const __m256i eq3 = CTK_SEARCH_PAIR_EQ(3);
+    const __m256i any = _mm256_or_si256(
+        _mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3)
+    );
+    if(_mm256_testz_si256(any, any) != 0) {
+        return false;
+    }
+    mask[0] = CTK_SEARCH_PAIR_BITS(0) | CTK_SEARCH_PAIR_BITS(1) << 32;
+    mask[1] = CTK_SEARCH_PAIR_BITS(2) | CTK_SEARCH_PAIR_BITS(3) << 32;
+    #undef CTK_SEARCH_PAIR_EQ
+    #undef CTK_SEARCH_PAIR_BITS
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd_avx2()
+------------------------------------------------------------------------------*/
+// Same as ctk_search_pair_fwd_sse2() with regions of 128 windows
+__attribute__((target("avx2")))
+static size_t ctk_search_pair_fwd_avx2(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const start
+)
+{
+    if(windows < 32) {
+        return ctk_search_pair_fwd_sse2(pair, hay, windows, start);
+    }
+    const unsigned char * const a = hay + pair->offset[0];
+    const unsigned char * const b = hay + pair->offset[1];
+    const __m256i first = _mm256_set1_epi8((char)pair->needle[pair->offset[0]]);
+    const __m256i second =
+        _mm256_set1_epi8((char)pair->needle[pair->offset[1]]);
+    const size_t last = windows - 32;
+    size_t pos = *start;
+    size_t misses = 0;
+    size_t found = SIZE_MAX;
+    while(pos < windows) {
+        unsigned long long mask[2];
+        if(ctk_search_pair_region_avx2(a, b, pos, last, first, second, mask)) {
+            found = ctk_search_pair_first(pair, hay + pos, mask[0], &misses);
+            if(found == SIZE_MAX) {
+                found = ctk_search_pair_first(
+                    pair, hay + pos + 64, mask[1], &misses
+                );
+                found = found != SIZE_MAX ? found + 64 : SIZE_MAX;
+            }
+            if(found != SIZE_MAX) {
+                found += pos;
+                break;
+            }
+        }
+        pos = windows - pos <= 128 ? windows : pos + 128;
+        if(ctk_search_pair_crowded(pair, misses, pos - *start)) {
+            break;
+        }
+    }
+    // Avoid the AVX to SSE transition penalty in the caller
+    _mm256_zeroupper();
+    *start = pos;
+    return found;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev_avx2()
+------------------------------------------------------------------------------*/
+// Same as ctk_search_pair_rev_sse2() with regions of 128 windows
+__attribute__((target("avx2")))
+static size_t ctk_search_pair_rev_avx2(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const end
+)
+{
+    if(windows < 32) {
+        return ctk_search_pair_rev_sse2(pair, hay, windows, end);
+    }
+    const unsigned char * const a = hay + pair->offset[0];
+    const unsigned char * const b = hay + pair->offset[1];
+    const __m256i first = _mm256_set1_epi8((char)pair->needle[pair->offset[0]]);
+    const __m256i second =
+        _mm256_set1_epi8((char)pair->needle[pair->offset[1]]);
+    const size_t last = windows - 32;
+    size_t pos = *end;
+    size_t misses = 0;
+    size_t found = SIZE_MAX;
+    while(pos > 0) {
+        const size_t start = pos > 128 ? pos - 128 : 0;
+        unsigned long long mask[2];
+        if(
+            ctk_search_pair_region_avx2(a, b, start, last, first, second, mask)
+        ) {
+            // Windows from `pos` are already checked
+            const size_t left = pos - start;
+            if(left <= 64) {
+                mask[0] &= ~0ULL >> (64 - left);
+                mask[1] = 0;
+            } else {
+                mask[1] &= ~0ULL >> (128 - left);
+            }
+            found = ctk_search_pair_last(
+                pair, hay + start + 64, mask[1], &misses
+            );
+            if(found != SIZE_MAX) {
+                found += 64;
+            } else {
+                found =
+                    ctk_search_pair_last(pair, hay + start, mask[0], &misses);
+            }
+            if(found != SIZE_MAX) {
+                found += start;
+                break;
+            }
+        }
+        pos = start;
+        if(ctk_search_pair_crowded(pair, misses, *end - pos)) {
+            break;
+        }
+    }
+    // Avoid the AVX to SSE transition penalty in the caller
+    _mm256_zeroupper();
+    *end = pos;
+    return found;
+}
+#endif
+#if defined(CTK_SEARCH_AVX512)
+/*------------------------------------------------------------------------------
+    ctk_search_pair_mask_avx512()
+------------------------------------------------------------------------------*/
+// Windows of the first `count` of a block of 64 whose first byte of the pair is
+// at `a` and second byte at `b` which match both bytes: the bytes of the other
+// windows are not loaded
+__attribute__((target("avx512f,avx512bw")))
+static inline unsigned long long ctk_search_pair_mask_avx512(
+    const unsigned char * const a, const unsigned char * const b,
+    const __m512i first, const __m512i second, const size_t count
+)
+{
+    const __mmask64 keep =
+        _cvtu64_mask64(count < 64 ? (1ULL << count) - 1 : ~0ULL);
+    const __mmask64 eq = _mm512_mask_cmpeq_epi8_mask(
+        keep, _mm512_maskz_loadu_epi8(keep, a), first
+    );
+    return _cvtmask64_u64(_mm512_mask_cmpeq_epi8_mask(
+        eq, _mm512_maskz_loadu_epi8(eq, b), second
+    ));
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd_avx512()
+------------------------------------------------------------------------------*/
+// Same as ctk_search_pair_fwd_sse2() with regions of 128 windows, most of them
+// match neither byte and are skipped with a single branch. The last region
+// loads only the windows left.
+__attribute__((target("avx512f,avx512bw")))
+static size_t ctk_search_pair_fwd_avx512(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const start
+)
+{
+    const unsigned char * const a = hay + pair->offset[0];
+    const unsigned char * const b = hay + pair->offset[1];
+    const __m512i first = _mm512_set1_epi8((char)pair->needle[pair->offset[0]]);
+    const __m512i second =
+        _mm512_set1_epi8((char)pair->needle[pair->offset[1]]);
+    size_t pos = *start;
+    size_t misses = 0;
+    size_t found = SIZE_MAX;
+    while(pos < windows) {
+        const size_t left = windows - pos;
+        unsigned long long mask =
+            ctk_search_pair_mask_avx512(a + pos, b + pos, first, second, left);
+        if(mask == 0 && left > 64) {
+            // Most blocks match neither byte, the next one is tested at once
+            pos += 64;
+            mask = ctk_search_pair_mask_avx512(
+                a + pos, b + pos, first, second, left - 64
+            );
+            if(mask == 0) {
+                pos = left <= 128 ? windows : pos + 64;
+                continue;
+            }
+        }
+        if(mask != 0) {
+            found = ctk_search_pair_first(pair, hay + pos, mask, &misses);
+            if(found != SIZE_MAX) {
+                found += pos;
+                break;
+            }
+        }
+        pos = windows - pos <= 64 ? windows : pos + 64;
+        if(ctk_search_pair_crowded(pair, misses, pos - *start)) {
+            break;
+        }
+    }
+    // Avoid the AVX to SSE transition penalty in the caller
+    _mm256_zeroupper();
+    *start = pos;
+    return found;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev_avx512()
+------------------------------------------------------------------------------*/
+// Same as ctk_search_pair_rev_sse2() with regions of 128 windows, most of them
+// match neither byte and are skipped with a single branch. The first region
+// loads only the windows left.
+__attribute__((target("avx512f,avx512bw")))
+static size_t ctk_search_pair_rev_avx512(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const end
+)
+{
+    (void)windows;
+    const unsigned char * const a = hay + pair->offset[0];
+    const unsigned char * const b = hay + pair->offset[1];
+    const __m512i first = _mm512_set1_epi8((char)pair->needle[pair->offset[0]]);
+    const __m512i second =
+        _mm512_set1_epi8((char)pair->needle[pair->offset[1]]);
+    size_t pos = *end;
+    size_t misses = 0;
+    size_t found = SIZE_MAX;
+    while(pos > 0) {
+        // Windows from `pos` are already checked
+        const size_t start = pos > 128 ? pos - 128 : 0;
+        const size_t left = pos - start;
+        const unsigned long long lo = ctk_search_pair_mask_avx512(
+            a + start, b + start, first, second, left
+        );
+        const unsigned long long hi = ctk_search_pair_mask_avx512(
+            a + start + 64, b + start + 64, first, second,
+            left > 64 ? left - 64 : 0
+        );
+        if((lo | hi) != 0) {
+            found = ctk_search_pair_last(pair, hay + start + 64, hi, &misses);
+            if(found != SIZE_MAX) {
+                found += 64;
+            } else {
+                found = ctk_search_pair_last(pair, hay + start, lo, &misses);
+            }
+            if(found != SIZE_MAX) {
+                found += start;
+                break;
+            }
+        }
+        pos = start;
+        if(ctk_search_pair_crowded(pair, misses, *end - pos)) {
+            break;
+        }
+    }
+    // Avoid the AVX to SSE transition penalty in the caller
+    _mm256_zeroupper();
+    *end = pos;
+    return found;
+}
+#endif
+// Best kernels available without runtime detection
+#if defined(__SSE2__)
+    #define ctk_search_pair_fwd_baseline ctk_search_pair_fwd_sse2
+    #define ctk_search_pair_rev_baseline ctk_search_pair_rev_sse2
+#else
+    #define ctk_search_pair_fwd_baseline ctk_search_pair_fwd_scalar
+    #define ctk_search_pair_rev_baseline ctk_search_pair_rev_scalar
+#endif
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd_select()
+------------------------------------------------------------------------------*/
+// Selects the best kernel for the running CPU
+static ctk_search_pair_fn * ctk_search_pair_fwd_select(void)
+{
+#if defined(CTK_SEARCH_AVX512)
+    if(ctk_cpu_probe().avx512bw) {
+        return ctk_search_pair_fwd_avx512;
+    }
+#endif
+#if defined(CTK_SEARCH_AVX2)
+    if(ctk_cpu_probe().avx2) {
+        return ctk_search_pair_fwd_avx2;
+    }
+#endif
+    return ctk_search_pair_fwd_baseline;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev_select()
+------------------------------------------------------------------------------*/
+// Selects the best kernel for the running CPU
+static ctk_search_pair_fn * ctk_search_pair_rev_select(void)
+{
+#if defined(CTK_SEARCH_AVX512)
+    if(ctk_cpu_probe().avx512bw) {
+        return ctk_search_pair_rev_avx512;
+    }
+#endif
+#if defined(CTK_SEARCH_AVX2)
+    if(ctk_cpu_probe().avx2) {
+        return ctk_search_pair_rev_avx2;
+    }
+#endif
+    return ctk_search_pair_rev_baseline;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd_dispatch()
+------------------------------------------------------------------------------*/
+CTK_DISPATCH(size_t, ctk_search_pair_fwd_dispatch,
+    (const struct ctk_search_pair * pair, const unsigned char * hay,
+        size_t windows, size_t * start),
+    (pair, hay, windows, start),
+    ctk_search_pair_fwd_select
+)
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev_dispatch()
+------------------------------------------------------------------------------*/
+CTK_DISPATCH(size_t, ctk_search_pair_rev_dispatch,
+    (const struct ctk_search_pair * pair, const unsigned char * hay,
+        size_t windows, size_t * end),
+    (pair, hay, windows, end),
+    ctk_search_pair_rev_select
+)
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_search_memrchr()
+------------------------------------------------------------------------------*/
+const unsigned char * ctk_search_memrchr(
+    const unsigned char * const mem, const unsigned char c, size_t len
+)
+{
+#if defined(__GLIBC__)
+    return memrchr(mem, c, len);
+#else
+    const uint64_t ones  = UINT64_C(0x0101010101010101);
+    const uint64_t highs = UINT64_C(0x8080808080808080);
+    const uint64_t pattern = ones * c;
+    while(len >= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, mem + len - sizeof(word), sizeof(word));
+        word ^= pattern;
+        // Non-zero if at least one byte of `word` is zero
+        if(((word - ones) & ~word & highs) != 0) {
+            break;
+        }
+        len -= sizeof(word);
+    }
+    while(len > 0) {
+        len--;
+        if(mem[len] == c) {
+            return mem + len;
+        }
+    }
+    return NULL;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_search_factorize()
+------------------------------------------------------------------------------*/
+size_t ctk_search_factorize(
+    const unsigned char * const needle, const size_t len,
+    const ptrdiff_t step, const bool fold, size_t * const period
+)
+{
+    if(len < 3) {
+        *period = 1;
+        return len - 1;
+    }
+    // Maximal suffix for `<`
+    size_t max_suffix = SIZE_MAX;
+    size_t j = 0;
+    size_t k = 1;
+    size_t p = 1;
+    while(j + k < len) {
+        const unsigned char a =
+            CTK_SEARCH_FOLD(CTK_SEARCH_AT(needle, j + k, step), fold);
+        const unsigned char b =
+            CTK_SEARCH_FOLD(CTK_SEARCH_AT(needle, max_suffix + k, step), fold);
+        if(a < b) {
+            j += k;
+            k = 1;
+            p = j - max_suffix;
+        } else if(a == b) {
+            if(k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            max_suffix = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+    // Maximal suffix for `>`
+    size_t max_suffix_rev = SIZE_MAX;
+    j = 0;
+    k = p = 1;
+    while(j + k < len) {
+        const unsigned char a =
+            CTK_SEARCH_FOLD(CTK_SEARCH_AT(needle, j + k, step), fold);
+        const unsigned char b = CTK_SEARCH_FOLD(
+            CTK_SEARCH_AT(needle, max_suffix_rev + k, step), fold
+        );
+        if(b < a) {
+            j += k;
+            k = 1;
+            p = j - max_suffix_rev;
+        } else if(a == b) {
+            if(k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            max_suffix_rev = j++;
+            k = p = 1;
+        }
+    }
+    // The longest of both maximal suffixes gives the critical factorization.
+    // `+ 1` makes SIZE_MAX wrap to 0.
+    if(max_suffix_rev + 1 < max_suffix + 1) {
+        return max_suffix + 1;
+    }
+    *period = p;
+    return max_suffix_rev + 1;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_prepare()
+------------------------------------------------------------------------------*/
+void ctk_search_prepare(
+    struct ctk_search_plan * const plan, const unsigned char * const needle,
+    const size_t needle_len, const ptrdiff_t step, const bool fold
+)
+{
+    plan->suffix = ctk_search_factorize(
+        needle, needle_len, step, fold, &plan->period
+    );
+    plan->fold = fold;
+    plan->use_table = needle_len >= CTK_SEARCH_LONG_NEEDLE;
+    if(plan->use_table) {
+        for(size_t i = 0; i <= UCHAR_MAX; i++) {
+            plan->shift_table[i] = needle_len;
+        }
+        for(size_t i = 0; i < needle_len; i++) {
+            const unsigned char c = CTK_SEARCH_AT(needle, i, step);
+            plan->shift_table[c] = needle_len - i - 1;
+            // Both cases of a letter get its shift: the lookups don't fold
+            if(fold && CTK_ASCII_IS(c, CTK_ASCII_ALPHA)) {
+                plan->shift_table[c ^ CTK_ASCII_UPPER] = needle_len - i - 1;
+            }
+        }
+    }
+    // Is the left part a suffix of the right one repeated?
+    plan->periodic = true;
+    for(size_t i = 0; i < plan->suffix; i++) {
+        const unsigned char a = CTK_SEARCH_AT(needle, i, step);
+        const unsigned char b = CTK_SEARCH_AT(needle, i + plan->period, step);
+        if(!CTK_SEARCH_EQ(a, b, fold)) {
+            plan->periodic = false;
+            break;
+        }
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_search_two_way()
+------------------------------------------------------------------------------*/
+size_t ctk_search_two_way(
+    const unsigned char * const hay, const size_t hay_len,
+    const unsigned char * const needle, const size_t needle_len,
+    const ptrdiff_t step, const bool fold
+)
+{
+    struct ctk_search_plan plan;
+    ctk_search_prepare(&plan, needle, needle_len, step, fold);
+    return ctk_search_two_way_prepared(
+        hay, hay_len, needle, needle_len, step, &plan
+    );
+}
+/*------------------------------------------------------------------------------
+    ctk_search_two_way_prepared()
+------------------------------------------------------------------------------*/
+size_t ctk_search_two_way_prepared(
+    const unsigned char * const hay, const size_t hay_len,
+    const unsigned char * const needle, const size_t needle_len,
+    const ptrdiff_t step, const struct ctk_search_plan * const plan
+)
+{
+    const size_t suffix = plan->suffix;
+    size_t period = plan->period;
+    // Shift to apply when the last element of a window isn't in the needle
+    const size_t * const shift_table = plan->shift_table;
+    const bool use_table = plan->use_table;
+    // With a shift table, the last element is already known to match.
+    const size_t right_end = use_table ? needle_len - 1 : needle_len;
+    const bool periodic = plan->periodic;
+    const bool fold = plan->fold;
+    const size_t last = hay_len - needle_len;
+    if(periodic) {
+        // Number of elements of the left part already known to match
+        size_t memory = 0;
+        size_t j = 0;
+        while(j <= last) {
+            if(use_table) {
+                size_t shift = shift_table[CTK_SEARCH_AT(hay, j + needle_len - 1, step)];
+                if(shift > 0) {
+                    if(memory != 0 && shift < period) {
+                        shift = needle_len - period;
+                    }
+                    memory = 0;
+                    j += shift;
+                    continue;
+                }
+            }
+            // Scan the right part
+            size_t i = suffix > memory ? suffix : memory;
+            while(i < right_end
+            && CTK_SEARCH_EQ(
+                CTK_SEARCH_AT(needle, i, step), CTK_SEARCH_AT(hay, i + j, step),
+                fold
+            )) {
+                i++;
+            }
+            if(i >= right_end) {
+                // Scan the left part
+                i = suffix - 1;
+                while(memory < i + 1
+                && CTK_SEARCH_EQ(
+                CTK_SEARCH_AT(needle, i, step), CTK_SEARCH_AT(hay, i + j, step),
+                fold
+            )) {
+                    i--;
+                }
+                if(i + 1 < memory + 1) {
+                    return j;
+                }
+                j += period;
+                memory = needle_len - period;
+            } else {
+                j += i - suffix + 1;
+                memory = 0;
+            }
+        }
+    } else {
+        period = (suffix > needle_len - suffix ? suffix : needle_len - suffix) + 1;
+        size_t j = 0;
+        while(j <= last) {
+            if(use_table) {
+                const size_t shift = shift_table[CTK_SEARCH_AT(hay, j + needle_len - 1, step)];
+                if(shift > 0) {
+                    j += shift;
+                    continue;
+                }
+            }
+            // Scan the right part
+            size_t i = suffix;
+            while(i < right_end
+            && CTK_SEARCH_EQ(
+                CTK_SEARCH_AT(needle, i, step), CTK_SEARCH_AT(hay, i + j, step),
+                fold
+            )) {
+                i++;
+            }
+            if(i >= right_end) {
+                // Scan the left part
+                i = suffix - 1;
+                while(i != SIZE_MAX
+                && CTK_SEARCH_EQ(
+                CTK_SEARCH_AT(needle, i, step), CTK_SEARCH_AT(hay, i + j, step),
+                fold
+            )) {
+                    i--;
+                }
+                if(i == SIZE_MAX) {
+                    return j;
+                }
+                j += period;
+            } else {
+                j += i - suffix + 1;
+            }
+        }
+    }
+    return SIZE_MAX;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd()
+------------------------------------------------------------------------------*/
+size_t ctk_search_pair_fwd(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const start
+)
+{
+    return ctk_search_pair_fwd_dispatch(pair, hay, windows, start);
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev()
+------------------------------------------------------------------------------*/
+size_t ctk_search_pair_rev(
+    const struct ctk_search_pair * const pair, const unsigned char * const hay,
+    const size_t windows, size_t * const end
+)
+{
+    return ctk_search_pair_rev_dispatch(pair, hay, windows, end);
+}
+/*------------------------------------------------------------------------------
+    ctk_search_pair_kernels()
+------------------------------------------------------------------------------*/
+void ctk_search_pair_kernels(
+    ctk_search_pair_fn ** const fwd, ctk_search_pair_fn ** const rev
+)
+{
+    *fwd = ctk_search_pair_fwd_select();
+    *rev = ctk_search_pair_rev_select();
+}
+/*------------------------------------------------------------------------------
+    ctk_search_fwd()
+------------------------------------------------------------------------------*/
+const char * ctk_search_fwd(
+    const char * const hay, const size_t hay_len,
+    const char * const needle, const size_t needle_len
+)
+{
+    if(needle_len == 0) {
+        return hay;
+    }
+    if(needle_len > hay_len) {
+        return NULL;
+    }
+    const unsigned char * const h = (const unsigned char *)hay;
+    const unsigned char * const n = (const unsigned char *)needle;
+    if(needle_len == 1) {
+        return (const char *)memchr(h, n[0], hay_len);
+    }
+    // Only the windows whose first and last bytes match are compared with the
+    // whole needle
+    const struct ctk_search_pair pair = {n, needle_len, {0, needle_len - 1}};
+    const size_t windows = hay_len - needle_len + 1;
+    size_t start = 0;
+    const size_t found = ctk_search_pair_fwd(&pair, h, windows, &start);
+    if(found != SIZE_MAX) {
+        return (const char *)h + found;
+    }
+    if(start == windows) {
+        return NULL;
+    }
+    // Too many windows match both bytes but not the needle: Two-Way finishes
+    // the search in linear time
+    const size_t pos = ctk_search_two_way(
+        h + start, hay_len - start, n, needle_len, 1, false
+    );
+    if(pos == SIZE_MAX) {
+        return NULL;
+    }
+    return (const char *)h + start + pos;
+}
+/*------------------------------------------------------------------------------
+    ctk_search_rev()
+------------------------------------------------------------------------------*/
+const char * ctk_search_rev(
+    const char * const hay, const size_t hay_len,
+    const char * const needle, const size_t needle_len
+)
+{
+    if(needle_len == 0) {
+        return hay;
+    }
+    if(needle_len > hay_len) {
+        return NULL;
+    }
+    const unsigned char * const h = (const unsigned char *)hay;
+    const unsigned char * const n = (const unsigned char *)needle;
+    if(needle_len == 1) {
+        return (const char *)ctk_search_memrchr(h, n[0], hay_len);
+    }
+    // Only the windows whose last and first bytes match are compared with the
+    // whole needle
+    const struct ctk_search_pair pair = {n, needle_len, {needle_len - 1, 0}};
+    size_t end = hay_len - needle_len + 1;
+    const size_t found = ctk_search_pair_rev(&pair, h, end, &end);
+    if(found != SIZE_MAX) {
+        return (const char *)h + found;
+    }
+    if(end == 0) {
+        return NULL;
+    }
+    // Too many windows match both bytes but not the needle: Two-Way finishes
+    // the search in linear time
+    const size_t len = end + needle_len - 1;
+    const size_t pos = ctk_search_two_way(
+        h + len - 1, len, n + needle_len - 1, needle_len, -1, false
+    );
+    if(pos == SIZE_MAX) {
+        return NULL;
+    }
+    return (const char *)h + len - pos - needle_len;
+}
@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ *
+ * @brief
+ * Private substring search engine shared by the string functions.
+ *
+ * @details
+ * - Implements the Two-Way algorithm of Crochemore and Perrin which runs in
+ *   `O(n + m)` time and `O(1)` space, whatever the content of the haystack and
+ *   the needle.
+ * - Needles of at least #CTK_SEARCH_LONG_NEEDLE bytes additionally use a
+ *   Boyer-Moore-Horspool shift table to skip windows which can't match.
+ * - The engine can scan in both directions: a reverse search is a forward
+ *   search of the reversed needle in the reversed haystack, which is achieved by
+ *   walking both arrays with a step of `-1` from their last byte.
+ * - It can also ignore the case of the ASCII letters: the algorithm only needs
+ *   an ordering and an equality, both are computed on lowercase bytes.
+ * - Before Two-Way, a filter compares two bytes of the needle with 32 or 64
+ *   windows of the haystack at once(SSE2, AVX2 selected at runtime) and only
+ *   compares the windows where both match with the whole needle. It gives up
+ *   to Two-Way when these comparisons cost more than a linear scan.
+ *
+ * @see
+ * - Crochemore M., Perrin D., "Two-way string-matching", Journal of the ACM
+ *   38(3):651-675, 1991.
+ * - Muła W., "SIMD-friendly algorithms for substring searching",
+ *   http://0x80.pl/articles/simd-strfind.html
+ */
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#ifndef CTK_STRING_SEARCH_H_20261018101204
+#define CTK_STRING_SEARCH_H_20261018101204
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// C Standard Library
+#include <limits.h> // UCHAR_MAX
+#include <stdbool.h>
+#include <stddef.h> // ptrdiff_t, size_t
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+/**
+ * Minimum needle length for which a shift table is built.
+ *
+ * - Filling the table costs `UCHAR_MAX + 1` writes, which isn't worth it for
+ *   short needles.
+ */
+#define CTK_SEARCH_LONG_NEEDLE 32
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+/**
+ * Preprocessing of a needle for a scan direction, computed by
+ * ctk_search_prepare().
+ */
+struct ctk_search_plan {
+    size_t suffix;  //!< First element of the right part of the factorization.
+    size_t period;  //!< Period of the right part.
+    bool periodic;  //!< Whether the left part repeats in the right one.
+    bool fold;      //!< Whether the case of ASCII letters is ignored.
+    bool use_table; //!< Whether \p{shift_table} is filled.
+    size_t shift_table[UCHAR_MAX + 1]; //!< Shift per last element of a window.
+};
+/**
+ * Two bytes of a needle compared with the windows of a haystack before the
+ * whole needle, see ctk_search_pair_fwd().
+ */
+struct ctk_search_pair {
+    const unsigned char * needle; //!< The needle.
+    size_t length;                //!< Length of the needle(must be > `0`).
+    size_t offset[2];             //!< Positions of both bytes in the needle.
+};
+/**
+ * Kernel of ctk_search_pair_fwd() or ctk_search_pair_rev(), see
+ * ctk_search_pair_kernels().
+ */
+typedef size_t ctk_search_pair_fn(
+    const struct ctk_search_pair * pair, const unsigned char * hay,
+    size_t windows, size_t * pos
+);
+/*==============================================================================
+    FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_search_memrchr()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last occurrence of byte \p{c} in the first \p{len} bytes of
+ * \p{mem}.
+ *
+ * - Portable equivalent of GNU `memrchr()` reading 8 bytes per iteration.
+ *
+ * @return
+ * - @success: A pointer to the last occurrence of \p{c}.
+ * - @failure: `NULL`.
+ */
+const unsigned char * ctk_search_memrchr(
+    const unsigned char * mem, unsigned char c, size_t len
+);
+/*------------------------------------------------------------------------------
+    ctk_search_factorize()
+------------------------------------------------------------------------------*/
+/**
+ * Computes the critical factorization of a needle.
+ *
+ * - The needle is split into a left part `[0, suffix)` and a right part
+ *   `[suffix, len)` such that the local period at the split point is equal to
+ *   the global period of the needle.
+ *
+ * @param[in]  needle : First element of the needle in scan order.
+ * @param[in]  len    : Length of the needle(must be > `0`).
+ * @param[in]  step   : `1` to walk forward, `-1` to walk backward.
+ * @param[in]  fold   : `true` to ignore the case of ASCII letters.
+ * @param[out] period : Period of the right part.
+ *
+ * @return Index of the first element of the right part.
+ */
+size_t ctk_search_factorize(
+    const unsigned char * needle, size_t len,
+    ptrdiff_t step, bool fold, size_t * period
+);
+/*------------------------------------------------------------------------------
+    ctk_search_prepare()
+------------------------------------------------------------------------------*/
+/**
+ * Computes once what ctk_search_two_way_prepared() needs to know about a
+ * needle.
+ *
+ * @param[out] plan       : The preprocessing of the needle.
+ * @param[in]  needle     : First element of the needle in scan order.
+ * @param[in]  needle_len : Length of the needle(must be > `0`).
+ * @param[in]  step       : `1` to walk forward, `-1` to walk backward.
+ * @param[in]  fold       : `true` to ignore the case of ASCII letters.
+ *
+ * @return Nothing.
+ */
+void ctk_search_prepare(
+    struct ctk_search_plan * plan, const unsigned char * needle,
+    size_t needle_len, ptrdiff_t step, bool fold
+);
+/*------------------------------------------------------------------------------
+    ctk_search_two_way()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first occurrence, in scan order, of a needle in a haystack.
+ *
+ * @param[in] hay        : First element of the haystack in scan order.
+ * @param[in] hay_len    : Length of the haystack.
+ * @param[in] needle     : First element of the needle in scan order.
+ * @param[in] needle_len : Length of the needle(must be > `0` and <=
+ *                         \p{hay_len}).
+ * @param[in] step       : `1` to walk forward, `-1` to walk backward.
+ * @param[in] fold       : `true` to ignore the case of ASCII letters.
+ *
+ * @return
+ * - @success: The index, in scan order, of the first element of the haystack
+ *   window matching the needle.
+ * - @failure: `SIZE_MAX`.
+ */
+size_t ctk_search_two_way(
+    const unsigned char * hay, size_t hay_len,
+    const unsigned char * needle, size_t needle_len,
+    ptrdiff_t step, bool fold
+);
+/*------------------------------------------------------------------------------
+    ctk_search_two_way_prepared()
+------------------------------------------------------------------------------*/
+/**
+ * Same as ctk_search_two_way() with the needle already preprocessed.
+ *
+ * @param[in] hay        : First element of the haystack in scan order.
+ * @param[in] hay_len    : Length of the haystack.
+ * @param[in] needle     : First element of the needle in scan order.
+ * @param[in] needle_len : Length of the needle(must be > `0` and <=
+ *                         \p{hay_len}).
+ * @param[in] step       : `1` to walk forward, `-1` to walk backward.
+ * @param[in] plan       : The preprocessing of the needle for \p{step}.
+ *
+ * @return
+ * - @success: The index, in scan order, of the first element of the haystack
+ *   window matching the needle.
+ * - @failure: `SIZE_MAX`.
+ */
+size_t ctk_search_two_way_prepared(
+    const unsigned char * hay, size_t hay_len,
+    const unsigned char * needle, size_t needle_len,
+    ptrdiff_t step, const struct ctk_search_plan * plan
+);
+/*------------------------------------------------------------------------------
+    ctk_search_pair_fwd()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first window of a haystack matching a needle, comparing the bytes
+ * of \p{pair} first.
+ *
+ * - Gives up when too many windows match both bytes but not the needle, so
+ *   that the search stays linear: the caller finishes it with Two-Way.
+ *
+ * @param[in]     pair    : The needle and its two bytes.
+ * @param[in]     hay     : The haystack.
+ * @param[in]     windows : Number of windows, i.e. length of \p{hay} minus the
+ *                          length of the needle plus one(must be > `0`).
+ * @param[in,out] start   : First window to search. Set to the first window
+ *                          left if the search gives up, to \p{windows} if no
+ *                          window matches.
+ *
+ * @return
+ * - @success: The position of the window.
+ * - @failure: `SIZE_MAX`.
+ */
+#if defined(__GNUC__)
+__attribute__((visibility("hidden")))
+#endif
+size_t ctk_search_pair_fwd(
+    const struct ctk_search_pair * pair, const unsigned char * hay,
+    size_t windows, size_t * start
+);
+/*------------------------------------------------------------------------------
+    ctk_search_pair_rev()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last window of a haystack matching a needle, comparing the bytes
+ * of \p{pair} first.
+ *
+ * - Gives up when too many windows match both bytes but not the needle, so
+ *   that the search stays linear: the caller finishes it with Two-Way.
+ *
+ * @param[in]     pair    : The needle and its two bytes.
+ * @param[in]     hay     : The haystack.
+ * @param[in]     windows : Number of windows, i.e. length of \p{hay} minus the
+ *                          length of the needle plus one(must be > `0`).
+ * @param[in,out] end     : End of the windows to search. Set to the end of
+ *                          the windows left if the search gives up, to `0` if
+ *                          no window matches.
+ *
+ * @return
+ * - @success: The position of the window.
+ * - @failure: `SIZE_MAX`.
+ */
+#if defined(__GNUC__)
+__attribute__((visibility("hidden")))
+#endif
+size_t ctk_search_pair_rev(
+    const struct ctk_search_pair * pair, const unsigned char * hay,
+    size_t windows, size_t * end
+);
+/*------------------------------------------------------------------------------
+    ctk_search_pair_kernels()
+------------------------------------------------------------------------------*/
+/**
+ * Kernels of ctk_search_pair_fwd() and ctk_search_pair_rev() for the running
+ * CPU.
+ *
+ * - A caller searching many haystacks for the same needle selects them once
+ *   and calls them directly: on short haystacks, the dispatch of every search
+ *   costs as much as the filter.
+ *
+ * @param[out] fwd : Set to the kernel of ctk_search_pair_fwd().
+ * @param[out] rev : Set to the kernel of ctk_search_pair_rev().
+ */
+#if defined(__GNUC__)
+__attribute__((visibility("hidden")))
+#endif
+void ctk_search_pair_kernels(
+    ctk_search_pair_fn ** fwd, ctk_search_pair_fn ** rev
+);
+/*------------------------------------------------------------------------------
+    ctk_search_fwd()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the first occurrence of a needle in a haystack.
+ *
+ * - Neither array needs to be null-terminated.
+ *
+ * @param[in] hay        : The array to search in.
+ * @param[in] hay_len    : Length of \p{hay}.
+ * @param[in] needle     : The array to search for.
+ * @param[in] needle_len : Length of \p{needle}.
+ *
+ * @return
+ * - @success:
+ *   - A pointer to the first byte of the first occurrence of \p{needle}.
+ *   - \p{hay} if \p{needle_len} is `0`.
+ * - @failure: `NULL`.
+ */
+const char * ctk_search_fwd(
+    const char * hay, size_t hay_len,
+    const char * needle, size_t needle_len
+);
+/*------------------------------------------------------------------------------
+    ctk_search_rev()
+------------------------------------------------------------------------------*/
+/**
+ * Finds the last occurrence of a needle in a haystack.
+ *
+ * - Neither array needs to be null-terminated.
+ *
+ * @param[in] hay        : The array to search in.
+ * @param[in] hay_len    : Length of \p{hay}.
+ * @param[in] needle     : The array to search for.
+ * @param[in] needle_len : Length of \p{needle}.
+ *
+ * @return
+ * - @success:
+ *   - A pointer to the first byte of the last occurrence of \p{needle}.
+ *   - \p{hay} if \p{needle_len} is `0`.
+ * - @failure: `NULL`.
+ */
+const char * ctk_search_rev(
+    const char * hay, size_t hay_len,
+    const char * needle, size_t needle_len
+);
+/*==============================================================================
+    GUARD
+==============================================================================*/
+#endif // CTK_STRING_SEARCH_H_20261018101204
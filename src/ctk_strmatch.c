@@ -0,0 +1,364 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_strmatch.h"
+// C Standard Library
+#include <limits.h> // UCHAR_MAX
+#include <stdbool.h>
+#include <stddef.h> // NULL, size_t
+#include <stdint.h> // UINT32_MAX, uint32_t
+#include <string.h> // strlen()
+// Internal
+#include "ctk_alloc.h"
+#include "ctk_error.h"
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct ctk_strmatch_pattern {
+    size_t length;
+    uint32_t next; // Next output of the same state + 1, 0 ends the chain
+};
+// The automaton is a table of rows of `stride` entries, one row per state:
+// - Entry 0 is the first pattern matched when entering the state + 1, 0 if
+//   none, the others are chained through `patterns[].next`.
+// - Entry `columns[c]` is the offset of the row of the next state on byte
+//   `c`, so a step is `state = table[state + columns[c]]`.
+// The root is the row at offset 0.
+struct ctk_strmatch {
+    uint32_t * table;
+    struct ctk_strmatch_pattern * patterns;
+    size_t count;
+    uint32_t columns[UCHAR_MAX + 1];
+};
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strmatch_insert()
+------------------------------------------------------------------------------*/
+// Adds `pattern` to the trie, `*rows` being the number of rows in use, and
+// returns the offset of the row where it ends
+static uint32_t ctk_strmatch_insert(
+    struct ctk_strmatch * const matcher, const uint32_t stride,
+    uint32_t * const rows, const char * const pattern, const size_t length
+)
+{
+    uint32_t state = 0;
+    for(size_t i = 0; i < length; i++) {
+        const unsigned char c = (unsigned char)pattern[i];
+        uint32_t * const next = &matcher->table[state + matcher->columns[c]];
+        if(*next == 0) {
+            *next = *rows * stride;
+            ++*rows;
+        }
+        state = *next;
+    }
+    return state;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_link()
+------------------------------------------------------------------------------*/
+// Turns the trie into a DFA: visits the states by increasing depth, so the
+// failure state of a state, i.e. its longest proper suffix in the trie, is
+// complete when the state is visited. Its outputs are appended to those of
+// the state and its transitions replace the missing ones.
+static bool ctk_strmatch_link(
+    struct ctk_strmatch * const matcher, const uint32_t stride,
+    const uint32_t rows
+)
+{
+    uint32_t * queue = ctk_malloc(sizeof(uint32_t) * rows * 2);
+    if(queue == NULL) {
+        return false;
+    }
+    uint32_t * const fail = queue + rows; // Indexed by row
+    uint32_t * const table = matcher->table;
+    size_t head = 0;
+    size_t tail = 0;
+    for(uint32_t c = 1; c < stride; c++) {
+        if(table[c] != 0) {
+            fail[table[c] / stride] = 0;
+            queue[tail++] = table[c];
+        }
+    }
+    while(head < tail) {
+        const uint32_t state = queue[head++];
+        const uint32_t failure = fail[state / stride];
+        if(table[failure] != 0) {
+            uint32_t * output = &table[state];
+            while(*output != 0) {
+                output = &matcher->patterns[*output - 1].next;
+            }
+            *output = table[failure];
+        }
+        for(uint32_t c = 1; c < stride; c++) {
+            const uint32_t next = table[state + c];
+            if(next != 0) {
+                fail[next / stride] = table[failure + c];
+                queue[tail++] = next;
+                continue;
+            }
+            table[state + c] = table[failure + c];
+        }
+    }
+    ctk_free(&queue);
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_report()
+------------------------------------------------------------------------------*/
+// Reports the chain of patterns starting at `output` which end at `end`,
+// returns false if `fn` asked to stop
+static bool ctk_strmatch_report(
+    const struct ctk_strmatch * const matcher, uint32_t output,
+    const size_t end, ctk_strmatch_fn * const fn, void * const ctx,
+    size_t * const found
+)
+{
+    for(; output != 0; output = matcher->patterns[output - 1].next) {
+        ++*found;
+        if(fn == NULL) {
+            continue;
+        }
+        const size_t length = matcher->patterns[output - 1].length;
+        const struct ctk_strmatch_match match = {
+            .pattern = output - 1,
+            .start = end - length,
+            .length = length
+        };
+        if(!fn(&match, ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_found()
+------------------------------------------------------------------------------*/
+// Fills `match`, if not NULL, with the first pattern of `output`
+static bool ctk_strmatch_found(
+    const struct ctk_strmatch * const matcher, const uint32_t output,
+    const size_t end, struct ctk_strmatch_match * const match
+)
+{
+    if(match != NULL) {
+        const size_t length = matcher->patterns[output - 1].length;
+        *match = (struct ctk_strmatch_match){
+            .pattern = output - 1,
+            .start = end - length,
+            .length = length
+        };
+    }
+    return true;
+}
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strmatch_create()
+------------------------------------------------------------------------------*/
+struct ctk_strmatch * ctk_strmatch_create(
+    const char * const * const patterns, const size_t * const lengths,
+    const size_t count
+)
+{
+    CTK_ERROR_RET_NULL_IF(patterns == NULL && count != 0);
+    CTK_ERROR_RET_NULL_IF(count >= UINT32_MAX);
+    bool used[UCHAR_MAX + 1] = {false};
+    size_t states = 1;
+    for(size_t i = 0; i < count; i++) {
+        CTK_ERROR_RET_NULL_IF(patterns[i] == NULL);
+        const size_t length =
+            lengths != NULL ? lengths[i] : strlen(patterns[i]);
+        CTK_ERROR_RET_NULL_IF(length == 0);
+        if(length > UINT32_MAX - states) {
+            return NULL;
+        }
+        states += length;
+        for(size_t j = 0; j < length; j++) {
+            used[(unsigned char)patterns[i][j]] = true;
+        }
+    }
+    struct ctk_strmatch * matcher = ctk_malloc(sizeof(*matcher));
+    if(matcher == NULL) {
+        return NULL;
+    }
+    // Column 0 holds the outputs, bytes absent from the patterns share column
+    // 1 since they all lead to the same states
+    uint32_t stride = 2;
+    for(size_t c = 0; c <= UCHAR_MAX; c++) {
+        matcher->columns[c] = used[c] ? stride++ : 1;
+    }
+    matcher->count = count;
+    matcher->patterns = count != 0
+        ? ctk_malloc(sizeof(struct ctk_strmatch_pattern) * count) : NULL;
+    matcher->table = states <= UINT32_MAX / stride
+        ? ctk_calloc(states * stride, sizeof(uint32_t)) : NULL;
+    if(matcher->table == NULL || (matcher->patterns == NULL && count != 0)) {
+        ctk_strmatch_destroy(&matcher);
+        return NULL;
+    }
+    uint32_t rows = 1;
+    for(size_t i = 0; i < count; i++) {
+        const size_t length =
+            lengths != NULL ? lengths[i] : strlen(patterns[i]);
+        const uint32_t state =
+            ctk_strmatch_insert(matcher, stride, &rows, patterns[i], length);
+        // Duplicates are chained, the output of the state is filled by
+        // ctk_strmatch_link() only once all the patterns are inserted
+        matcher->patterns[i] = (struct ctk_strmatch_pattern){
+            .length = length,
+            .next = matcher->table[state]
+        };
+        matcher->table[state] = (uint32_t)i + 1;
+    }
+    if(!ctk_strmatch_link(matcher, stride, rows)) {
+        ctk_strmatch_destroy(&matcher);
+        return NULL;
+    }
+    // Patterns sharing prefixes leave rows unused at the end of the table,
+    // keep the larger table if it can't shrink
+    if(rows < states) {
+        uint32_t * const table =
+            ctk_realloc(&matcher->table, sizeof(uint32_t) * rows * stride);
+        if(table != NULL) {
+            matcher->table = table;
+        }
+    }
+    return matcher;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_destroy()
+------------------------------------------------------------------------------*/
+void ctk_strmatch_destroy(struct ctk_strmatch ** const matcher)
+{
+    CTK_ERROR_RET_IF(matcher == NULL);
+    if(*matcher == NULL) {
+        return;
+    }
+    ctk_free(&(*matcher)->table);
+    ctk_free(&(*matcher)->patterns);
+    ctk_free(matcher);
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_all()
+------------------------------------------------------------------------------*/
+size_t ctk_strmatch_all(
+    const struct ctk_strmatch * const matcher, const char * const text,
+    ctk_strmatch_fn * const fn, void * const ctx
+)
+{
+    CTK_ERROR_RET_0_IF(matcher == NULL);
+    CTK_ERROR_RET_0_IF(text == NULL);
+    const uint32_t * const table = matcher->table;
+    const uint32_t * const columns = matcher->columns;
+    const unsigned char * const bytes = (const unsigned char *)text;
+    size_t found = 0;
+    uint32_t state = 0;
+    for(size_t i = 0; bytes[i] != '\0'; i++) {
+        state = table[state + columns[bytes[i]]];
+        if(
+            table[state] != 0
+            && !ctk_strmatch_report(matcher, table[state], i + 1, fn, ctx,
+                &found)
+        ) {
+            break;
+        }
+    }
+    return found;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_all_n()
+------------------------------------------------------------------------------*/
+size_t ctk_strmatch_all_n(
+    const struct ctk_strmatch * const matcher, const char * const text,
+    const size_t length, ctk_strmatch_fn * const fn, void * const ctx
+)
+{
+    CTK_ERROR_RET_0_IF(matcher == NULL);
+    CTK_ERROR_RET_0_IF(text == NULL && length != 0);
+    const uint32_t * const table = matcher->table;
+    const uint32_t * const columns = matcher->columns;
+    const unsigned char * const bytes = (const unsigned char *)text;
+    size_t found = 0;
+    uint32_t state = 0;
+    for(size_t i = 0; i < length; i++) {
+        state = table[state + columns[bytes[i]]];
+        if(
+            table[state] != 0
+            && !ctk_strmatch_report(matcher, table[state], i + 1, fn, ctx,
+                &found)
+        ) {
+            break;
+        }
+    }
+    return found;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_first()
+------------------------------------------------------------------------------*/
+bool ctk_strmatch_first(
+    const struct ctk_strmatch * const matcher, const char * const text,
+    struct ctk_strmatch_match * const match
+)
+{
+    CTK_ERROR_RET_FALSE_IF(matcher == NULL);
+    CTK_ERROR_RET_FALSE_IF(text == NULL);
+    const uint32_t * const table = matcher->table;
+    const uint32_t * const columns = matcher->columns;
+    const unsigned char * const bytes = (const unsigned char *)text;
+    uint32_t state = 0;
+    for(size_t i = 0; bytes[i] != '\0'; i++) {
+        state = table[state + columns[bytes[i]]];
+        if(table[state] != 0) {
+            return ctk_strmatch_found(matcher, table[state], i + 1, match);
+        }
+    }
+    return false;
+}
+/*------------------------------------------------------------------------------
+    ctk_strmatch_first_n()
+------------------------------------------------------------------------------*/
+bool ctk_strmatch_first_n(
+    const struct ctk_strmatch * const matcher, const char * const text,
+    const size_t length, struct ctk_strmatch_match * const match
+)
+{
+    CTK_ERROR_RET_FALSE_IF(matcher == NULL);
+    CTK_ERROR_RET_FALSE_IF(text == NULL && length != 0);
+    const uint32_t * const table = matcher->table;
+    const uint32_t * const columns = matcher->columns;
+    const unsigned char * const bytes = (const unsigned char *)text;
+    uint32_t state = 0;
+    for(size_t i = 0; i < length; i++) {
+        state = table[state + columns[bytes[i]]];
+        if(table[state] != 0) {
+            return ctk_strmatch_found(matcher, table[state], i + 1, match);
+        }
+    }
+    return false;
+}
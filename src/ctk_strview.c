@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "ctk_strview.h"
+// C Standard Library
+#include <stdbool.h>
+#include <stddef.h> // NULL, ptrdiff_t, size_t
+#include <string.h> // memcmp(), strlen()
+// Internal
+#include "ctk_ascii.h"
+#include "ctk_error.h"
+#include "ctk_string_case.h"
+#include "ctk_string_search.h"
+/*==============================================================================
+    PRIVATE DEFINE
+==============================================================================*/
+// A view can only have a NULL pointer when it is empty
+#define CTK_STRVIEW_IS_INVALID(view) \
+    ((view).data == NULL && (view).length > 0)
+/*==============================================================================
+    PUBLIC FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_strview_from_str()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_from_str(const char * const str)
+{
+    CTK_ERROR_RET_VAL_IF(str == NULL, CTK_STRVIEW_EMPTY);
+    return CTK_STRVIEW(str, strlen(str));
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_sub()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_sub(
+    const struct ctk_strview view, const size_t pos, size_t length
+)
+{
+    CTK_ERROR_RET_VAL_IF(CTK_STRVIEW_IS_INVALID(view), CTK_STRVIEW_EMPTY);
+    CTK_ERROR_RET_VAL_IF(pos > view.length, CTK_STRVIEW_EMPTY);
+    if(length > view.length - pos) {
+        length = view.length - pos;
+    }
+    if(view.data == NULL) {
+        return CTK_STRVIEW_EMPTY;
+    }
+    return CTK_STRVIEW(view.data + pos, length);
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_cmp()
+------------------------------------------------------------------------------*/
+int ctk_strview_cmp(const struct ctk_strview lhs, const struct ctk_strview rhs)
+{
+    CTK_ERROR_RET_0_IF(CTK_STRVIEW_IS_INVALID(lhs));
+    CTK_ERROR_RET_0_IF(CTK_STRVIEW_IS_INVALID(rhs));
+    const size_t length = lhs.length < rhs.length ? lhs.length : rhs.length;
+    if(length > 0) {
+        const int cmp = memcmp(lhs.data, rhs.data, length);
+        if(cmp != 0) {
+            return cmp;
+        }
+    }
+    return (lhs.length > rhs.length) - (lhs.length < rhs.length);
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_eq()
+------------------------------------------------------------------------------*/
+bool ctk_strview_eq(const struct ctk_strview lhs, const struct ctk_strview rhs)
+{
+    CTK_ERROR_RET_FALSE_IF(CTK_STRVIEW_IS_INVALID(lhs));
+    CTK_ERROR_RET_FALSE_IF(CTK_STRVIEW_IS_INVALID(rhs));
+    if(lhs.length != rhs.length) {
+        return false;
+    }
+    return lhs.length == 0 || memcmp(lhs.data, rhs.data, lhs.length) == 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_starts_with()
+------------------------------------------------------------------------------*/
+bool ctk_strview_starts_with(
+    const struct ctk_strview view, const struct ctk_strview prefix
+)
+{
+    CTK_ERROR_RET_FALSE_IF(CTK_STRVIEW_IS_INVALID(view));
+    CTK_ERROR_RET_FALSE_IF(CTK_STRVIEW_IS_INVALID(prefix));
+    if(prefix.length > view.length) {
+        return false;
+    }
+    return prefix.length == 0
+        || memcmp(view.data, prefix.data, prefix.length) == 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_ends_with()
+------------------------------------------------------------------------------*/
+bool ctk_strview_ends_with(
+    const struct ctk_strview view, const struct ctk_strview suffix
+)
+{
+    CTK_ERROR_RET_FALSE_IF(CTK_STRVIEW_IS_INVALID(view));
+    CTK_ERROR_RET_FALSE_IF(CTK_STRVIEW_IS_INVALID(suffix));
+    if(suffix.length > view.length) {
+        return false;
+    }
+    return suffix.length == 0
+        || memcmp(view.data + view.length - suffix.length, suffix.data,
+                  suffix.length) == 0;
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_pos()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strview_pos(
+    const struct ctk_strview view, const struct ctk_strview substr
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(CTK_STRVIEW_IS_INVALID(view));
+    CTK_ERROR_RET_NEG_1_IF(CTK_STRVIEW_IS_INVALID(substr));
+    if(substr.length == 0) {
+        return 0;
+    }
+    const char * const pos = ctk_search_fwd(
+        view.data, view.length, substr.data, substr.length
+    );
+    if(pos == NULL) {
+        return -1;
+    }
+    return pos - view.data;
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_rpos()
+------------------------------------------------------------------------------*/
+ptrdiff_t ctk_strview_rpos(
+    const struct ctk_strview view, const struct ctk_strview substr
+)
+{
+    CTK_ERROR_RET_NEG_1_IF(CTK_STRVIEW_IS_INVALID(view));
+    CTK_ERROR_RET_NEG_1_IF(CTK_STRVIEW_IS_INVALID(substr));
+    if(substr.length == 0) {
+        return 0;
+    }
+    const char * const pos = ctk_search_rev(
+        view.data, view.length, substr.data, substr.length
+    );
+    if(pos == NULL) {
+        return -1;
+    }
+    return pos - view.data;
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_tolower()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_tolower(
+    char * const dest, const struct ctk_strview view
+)
+{
+    CTK_ERROR_RET_VAL_IF(dest == NULL, CTK_STRVIEW_EMPTY);
+    CTK_ERROR_RET_VAL_IF(CTK_STRVIEW_IS_INVALID(view), CTK_STRVIEW_EMPTY);
+    ctk_case_ascii(dest, view.data, view.length, 'A');
+    return CTK_STRVIEW(dest, view.length);
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_toupper()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_toupper(
+    char * const dest, const struct ctk_strview view
+)
+{
+    CTK_ERROR_RET_VAL_IF(dest == NULL, CTK_STRVIEW_EMPTY);
+    CTK_ERROR_RET_VAL_IF(CTK_STRVIEW_IS_INVALID(view), CTK_STRVIEW_EMPTY);
+    ctk_case_ascii(dest, view.data, view.length, 'a');
+    return CTK_STRVIEW(dest, view.length);
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_trim()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_trim(const struct ctk_strview view)
+{
+    return ctk_strview_trimr(ctk_strview_triml(view));
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_triml()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_triml(const struct ctk_strview view)
+{
+    CTK_ERROR_RET_VAL_IF(CTK_STRVIEW_IS_INVALID(view), CTK_STRVIEW_EMPTY);
+    const size_t start = ctk_ascii_triml(view.data, view.length);
+    if(view.data == NULL) {
+        return view;
+    }
+    return CTK_STRVIEW(view.data + start, view.length - start);
+}
+/*------------------------------------------------------------------------------
+    ctk_strview_trimr()
+------------------------------------------------------------------------------*/
+struct ctk_strview ctk_strview_trimr(const struct ctk_strview view)
+{
+    CTK_ERROR_RET_VAL_IF(CTK_STRVIEW_IS_INVALID(view), CTK_STRVIEW_EMPTY);
+    return CTK_STRVIEW(view.data, ctk_ascii_trimr(view.data, view.length));
+}
@@ -27,13 +27,158 @@
 // Own header
 #include "ctk_time.h"
 // C Standard Library
+#include <stdbool.h>
+#include <stdint.h> // int64_t
+#include <string.h> // memcpy()
 #include <time.h> // struct tm, time_t, strftime(), POSIX localtime_r(), size_t
+                  // POSIX clock_gettime(), clockid_t, gmtime_r()
+                  // timespec_get()
 // Internal
 #include "ctk_error.h"
 /*==============================================================================
     DEFINE
 ==============================================================================*/
 #define CTK_TIME_ISO8601_STR_FMT "%FT%T%z"
+// Offset of the seconds in an ISO 8601 string
+#define CTK_TIME_ISO8601_SEC_OFFSET (sizeof("YYYY-MM-DDThh:mm:") - 1)
+// Offset of the UTC offset in an ISO 8601 string, where fractions are inserted
+#define CTK_TIME_ISO8601_FRAC_OFFSET (sizeof("YYYY-MM-DDThh:mm:ss") - 1)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+// Last minute rendered by ctk_iso8601_time_cached() in the calling thread
+struct ctk_time_cache {
+    bool valid;
+    time_t minute; // First second of the minute
+    char str[CTK_TIME_ISO8601_STR_LENGTH];
+};
+/*==============================================================================
+    PRIVATE VARIABLE
+==============================================================================*/
+static _Thread_local struct ctk_time_cache ctk_time_cache;
+/*==============================================================================
+    PRIVATE FUNCTION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    ctk_time_digits()
+------------------------------------------------------------------------------*/
+// Writes the `count` last decimal digits of `value`, zero-padded
+static void ctk_time_digits(
+    char * const dest, unsigned long value, size_t count
+)
+{
+    while(count-- > 0) {
+        dest[count] = (char)('0' + value % 10);
+        value /= 10;
+    }
+}
+/*------------------------------------------------------------------------------
+    ctk_time_days_from_civil()
+------------------------------------------------------------------------------*/
+// Days since 1970-01-01 of a date of the proleptic Gregorian calendar, see
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+static long long ctk_time_days_from_civil(
+    long long year, const long long month, const long long day
+)
+{
+    year -= month <= 2;
+    const long long era = (year >= 0 ? year : year - 399) / 400;
+    const long long yoe = year - era * 400;
+    const long long doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5
+        + day - 1;
+    const long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+/*------------------------------------------------------------------------------
+    ctk_time_civil_seconds()
+------------------------------------------------------------------------------*/
+// Seconds since 1970-01-01T00:00:00 of a broken-down time read as UTC. The
+// difference between a local time and the same time in UTC is the UTC offset,
+// which doesn't need the non-standard `tm_gmtoff`.
+static long long ctk_time_civil_seconds(const struct tm * const tm)
+{
+    return ctk_time_days_from_civil(tm->tm_year + 1900LL, tm->tm_mon + 1LL,
+        tm->tm_mday) * 86400 + tm->tm_hour * 3600LL + tm->tm_min * 60LL
+        + tm->tm_sec;
+}
+/*------------------------------------------------------------------------------
+    ctk_time_render()
+------------------------------------------------------------------------------*/
+// Renders `lt` as `"YYYY-MM-DDThh:mm:ss+hhmm"`, `utc` being the same time in
+// UTC. Only 4 digits years are supported: strftime("%Y") doesn't zero-pad
+// the others.
+static bool ctk_time_render(
+    const struct tm * const lt, const struct tm * const utc, char * const dest
+)
+{
+    if(lt->tm_year < 1000 - 1900 || lt->tm_year > 9999 - 1900) {
+        return false;
+    }
+    const unsigned long year = (unsigned long)lt->tm_year + 1900;
+    const long long offset = ctk_time_civil_seconds(lt)
+        - ctk_time_civil_seconds(utc);
+    // Same truncation as strftime("%z")
+    const unsigned long offset_min = (unsigned long)(
+        (offset < 0 ? -offset : offset) / 60
+    );
+    ctk_time_digits(dest, year, 4);
+    dest[4] = '-';
+    ctk_time_digits(dest + 5, (unsigned long)lt->tm_mon + 1, 2);
+    dest[7] = '-';
+    ctk_time_digits(dest + 8, (unsigned long)lt->tm_mday, 2);
+    dest[10] = 'T';
+    ctk_time_digits(dest + 11, (unsigned long)lt->tm_hour, 2);
+    dest[13] = ':';
+    ctk_time_digits(dest + 14, (unsigned long)lt->tm_min, 2);
+    dest[16] = ':';
+    ctk_time_digits(dest + 17, (unsigned long)lt->tm_sec, 2);
+    dest[19] = offset < 0 ? '-' : '+';
+    ctk_time_digits(dest + 20, offset_min / 60, 2);
+    ctk_time_digits(dest + 22, offset_min % 60, 2);
+    dest[24] = '\0';
+    return true;
+}
+/*------------------------------------------------------------------------------
+    ctk_time_clock_ns()
+------------------------------------------------------------------------------*/
+#if defined(CTK_POSIX)
+static int64_t ctk_time_clock_ns(const clockid_t clock)
+{
+    struct timespec ts;
+    if(clock_gettime(clock, &ts) != 0) {
+        return -1;
+    }
+    return ctk_time_from_timespec(ts);
+}
+#endif
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_frac()
+------------------------------------------------------------------------------*/
+// Inserts the first `digits` digits of the fraction of a second of `ns` in the
+// string of ctk_iso8601_time_cached()
+static char * ctk_iso8601_time_frac(
+    const int64_t ns, const size_t digits, char * const result
+)
+{
+    const struct timespec ts = ctk_time_to_timespec(ns);
+    char str[CTK_TIME_ISO8601_STR_LENGTH];
+    if(ctk_iso8601_time_cached(ts.tv_sec, str, sizeof(str)) == NULL) {
+        return NULL;
+    }
+    unsigned long frac = (unsigned long)ts.tv_nsec;
+    for(size_t i = digits; i < 9; i++) {
+        frac /= 10;
+    }
+    memcpy(result, str, CTK_TIME_ISO8601_FRAC_OFFSET);
+    result[CTK_TIME_ISO8601_FRAC_OFFSET] = '.';
+    ctk_time_digits(result + CTK_TIME_ISO8601_FRAC_OFFSET + 1, frac, digits);
+    // UTC offset and null character
+    memcpy(result + CTK_TIME_ISO8601_FRAC_OFFSET + 1 + digits,
+        str + CTK_TIME_ISO8601_FRAC_OFFSET,
+        sizeof(str) - CTK_TIME_ISO8601_FRAC_OFFSET
+    );
+    return result;
+}
 /*==============================================================================
     PUBLIC FUNCTION
 ==============================================================================*/
@@ -75,3 +220,150 @@ char * ctk_iso8601_time(
     }
     return result;
 }
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_cached()
+------------------------------------------------------------------------------*/
+char * ctk_iso8601_time_cached(
+    const time_t timer, char * const result, const size_t length
+)
+{
+    CTK_ERROR_RET_NULL_IF(result == NULL);
+    CTK_ERROR_RET_NULL_IF(length < CTK_TIME_ISO8601_STR_LENGTH);
+
+    struct ctk_time_cache * const cache = &ctk_time_cache;
+    if(cache->valid && timer >= cache->minute && timer - cache->minute < 60) {
+        // Only the seconds differ within a minute
+        memcpy(result, cache->str, CTK_TIME_ISO8601_STR_LENGTH);
+        const unsigned long sec = (unsigned long)(timer - cache->minute);
+        ctk_time_digits(result + CTK_TIME_ISO8601_SEC_OFFSET, sec, 2);
+        return result;
+    }
+    struct tm lt;
+    if(ctk_localtime_r(&timer, &lt) == NULL) {
+        return NULL;
+    }
+    struct tm utc;
+#if defined(CTK_POSIX)
+    if(gmtime_r(&timer, &utc) == NULL) {
+        return NULL;
+    }
+//! @todo Support non-POSIX platforms
+#else
+    return NULL;
+#endif
+    if(!ctk_time_render(&lt, &utc, result)) {
+        // Years which don't have 4 digits are left to strftime()
+        return ctk_iso8601_time(timer, result, length);
+    }
+    // A leap second(tm_sec == 60) isn't part of a regular minute
+    cache->valid = lt.tm_sec < 60;
+    cache->minute = timer - lt.tm_sec;
+    memcpy(cache->str, result, CTK_TIME_ISO8601_STR_LENGTH);
+    return result;
+}
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_ms()
+------------------------------------------------------------------------------*/
+char * ctk_iso8601_time_ms(
+    const int64_t ns, char * const result, const size_t length
+)
+{
+    CTK_ERROR_RET_NULL_IF(result == NULL);
+    CTK_ERROR_RET_NULL_IF(length < CTK_TIME_ISO8601_MS_STR_LENGTH);
+    return ctk_iso8601_time_frac(ns, 3, result);
+}
+/*------------------------------------------------------------------------------
+    ctk_iso8601_time_us()
+------------------------------------------------------------------------------*/
+char * ctk_iso8601_time_us(
+    const int64_t ns, char * const result, const size_t length
+)
+{
+    CTK_ERROR_RET_NULL_IF(result == NULL);
+    CTK_ERROR_RET_NULL_IF(length < CTK_TIME_ISO8601_US_STR_LENGTH);
+    return ctk_iso8601_time_frac(ns, 6, result);
+}
+/*------------------------------------------------------------------------------
+    ctk_time_monotonic_ns()
+------------------------------------------------------------------------------*/
+int64_t ctk_time_monotonic_ns(void)
+{
+#if defined(CTK_POSIX)
+    return ctk_time_clock_ns(CLOCK_MONOTONIC);
+//! @todo Support non-POSIX platforms
+#else
+    return -1;
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_time_monotonic_coarse_ns()
+------------------------------------------------------------------------------*/
+int64_t ctk_time_monotonic_coarse_ns(void)
+{
+#if defined(CLOCK_MONOTONIC_COARSE)
+    return ctk_time_clock_ns(CLOCK_MONOTONIC_COARSE);
+#else
+    return ctk_time_monotonic_ns();
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_time_realtime_ns()
+------------------------------------------------------------------------------*/
+int64_t ctk_time_realtime_ns(void)
+{
+#if defined(CTK_POSIX)
+    return ctk_time_clock_ns(CLOCK_REALTIME);
+#else
+    struct timespec ts;
+    if(timespec_get(&ts, TIME_UTC) != TIME_UTC) {
+        return -1;
+    }
+    return ctk_time_from_timespec(ts);
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_time_realtime_coarse_ns()
+------------------------------------------------------------------------------*/
+int64_t ctk_time_realtime_coarse_ns(void)
+{
+#if defined(CLOCK_REALTIME_COARSE)
+    return ctk_time_clock_ns(CLOCK_REALTIME_COARSE);
+#else
+    return ctk_time_realtime_ns();
+#endif
+}
+/*------------------------------------------------------------------------------
+    ctk_time_elapsed_ns()
+------------------------------------------------------------------------------*/
+int64_t ctk_time_elapsed_ns(const int64_t start)
+{
+    const int64_t now = ctk_time_monotonic_ns();
+    if(now == -1) {
+        return -1;
+    }
+    return now - start;
+}
+/*------------------------------------------------------------------------------
+    ctk_time_from_timespec()
+------------------------------------------------------------------------------*/
+int64_t ctk_time_from_timespec(const struct timespec ts)
+{
+    return (int64_t)ts.tv_sec * CTK_TIME_NS_PER_SEC + ts.tv_nsec;
+}
+/*------------------------------------------------------------------------------
+    ctk_time_to_timespec()
+------------------------------------------------------------------------------*/
+struct timespec ctk_time_to_timespec(const int64_t ns)
+{
+    // Division truncates toward zero: borrow a second for negative fractions
+    int64_t sec = ns / CTK_TIME_NS_PER_SEC;
+    int64_t nsec = ns % CTK_TIME_NS_PER_SEC;
+    if(nsec < 0) {
+        sec--;
+        nsec += CTK_TIME_NS_PER_SEC;
+    }
+    struct timespec ts = {0};
+    ts.tv_sec = (time_t)sec;
+    ts.tv_nsec = (long)nsec;
+    return ts;
+}
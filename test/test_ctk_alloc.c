@@ -22,13 +22,17 @@
 /*==============================================================================
     INCLUDE
 ==============================================================================*/
+// Portability
+#include "ctk_platform.h"
 // Own header
 #include "test_ctk_alloc.h"
 // The API to test
 #include "ctk_alloc.h"
 // C Standard Library
 #include <assert.h>
-#include <stdio.h>  // printf()
+#include <stdint.h> // SIZE_MAX, uint64_t, uintptr_t
+#include <stdio.h>  // fclose(), ftell(), printf(), tmpfile()
+#include <string.h> // memset()
 #include <stdlib.h> // malloc(), free()
 /*==============================================================================
     MACRO
@@ -57,10 +61,16 @@
 ==============================================================================*/
 static void TEST_ctk_malloc(void);
 static void TEST_ctk_calloc(void);
+static void TEST_ctk_aligned_alloc(void);
 static void TEST_ctk_realloc(void);
 static void TEST_ctk_realloc_macro(void);
 static void TEST_ctk_free(void);
 static void TEST_ctk_free_macro(void);
+static void TEST_ctk_alloc_reuse(void);
+static void TEST_ctk_alloc_stats(void);
+static void TEST_ctk_mmap_alloc(void);
+static void TEST_ctk_mmap_realloc(void);
+static void TEST_ctk_mmap_free(void);
 /*==============================================================================
     FUNCTION DEFINITION
 ==============================================================================*/
@@ -72,10 +82,16 @@ void TEST_ctk_alloc(void)
     printf("%s:\n", __func__);
     TEST_ctk_malloc();
     TEST_ctk_calloc();
+    TEST_ctk_aligned_alloc();
     TEST_ctk_realloc();
     TEST_ctk_realloc_macro();
     TEST_ctk_free();
     TEST_ctk_free_macro();
+    TEST_ctk_alloc_reuse();
+    TEST_ctk_alloc_stats();
+    TEST_ctk_mmap_alloc();
+    TEST_ctk_mmap_realloc();
+    TEST_ctk_mmap_free();
 }
 /*------------------------------------------------------------------------------
     TEST_ctk_malloc()
@@ -117,6 +133,36 @@ static void TEST_ctk_calloc(void)
     assert(x == NULL);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_aligned_alloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_aligned_alloc(void)
+{
+    // size = 0
+    assert(ctk_aligned_alloc(64, 0) == NULL);
+    // alignment isn't a power of two
+    assert(ctk_aligned_alloc(0, 1) == NULL);
+    assert(ctk_aligned_alloc(48, 1) == NULL);
+    // size rounded up past SIZE_MAX
+    assert(ctk_aligned_alloc(64, SIZE_MAX) == NULL);
+    // size isn't a multiple of alignment
+    for(size_t alignment = 1; alignment <= 4096; alignment *= 2) {
+        char * mem = ctk_aligned_alloc(alignment, 3);
+        assert(mem != NULL);
+        assert((uintptr_t)mem % alignment == 0);
+        mem[0] = 1;
+        mem[2] = 3;
+        ctk_free(&mem);
+        assert(mem == NULL);
+    }
+    // Whole cache lines
+    char * line = ctk_aligned_alloc(CTK_CACHE_LINE_SIZE, CTK_CACHE_LINE_SIZE);
+    assert(line != NULL);
+    assert((uintptr_t)line % CTK_CACHE_LINE_SIZE == 0);
+    line[CTK_CACHE_LINE_SIZE - 1] = 1;
+    ctk_free(&line);
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_realloc()
 ------------------------------------------------------------------------------*/
@@ -242,3 +288,196 @@ static void TEST_ctk_free_macro(void)
     assert(ptr == NULL);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_alloc_reuse()
+------------------------------------------------------------------------------*/
+// Blocks are recycled when ctk_alloc is built with per-thread caches
+static void TEST_ctk_alloc_reuse(void)
+{
+    enum { COUNT = 300 };
+    unsigned char * blocks[COUNT] = {NULL};
+    for(int round = 0; round < 3; round++) {
+        // Sizes spanning all cached classes and beyond
+        for(size_t i = 0; i < COUNT; i++) {
+            const size_t size = 1 + i * 7;
+            blocks[i] = round == 1 ? ctk_calloc(size, 1) : ctk_malloc(size);
+            assert(blocks[i] != NULL);
+            for(size_t j = 0; j < size; j++) {
+                assert(round != 1 || blocks[i][j] == 0);
+                blocks[i][j] = (unsigned char)i;
+            }
+        }
+        for(size_t i = 0; i < COUNT; i++) {
+            for(size_t j = 0; j < 1 + i * 7; j++) {
+                assert(blocks[i][j] == (unsigned char)i);
+            }
+        }
+        // Mix blocks from malloc() in
+        for(size_t i = 0; i < COUNT; i += 2) {
+            ctk_free(&blocks[i]);
+            assert(blocks[i] == NULL);
+            blocks[i] = malloc(1 + i * 3);
+            assert(blocks[i] != NULL);
+        }
+        for(size_t i = 0; i < COUNT; i++) {
+            ctk_free(&blocks[i]);
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_alloc_stats()
+------------------------------------------------------------------------------*/
+// Counters are only available when ctk_alloc is built with statistics
+static void TEST_ctk_alloc_stats(void)
+{
+    // NULL
+    assert(ctk_alloc_stats_snapshot(NULL) == -1);
+    assert(ctk_alloc_stats_dump(NULL) == -1);
+    struct ctk_alloc_stats before;
+    const int ret = ctk_alloc_stats_snapshot(&before);
+    if(ret == -1) {
+        // Built without statistics
+        assert(before.malloc_calls == 0);
+        assert(before.histogram[0] == 0);
+        assert(ctk_alloc_stats_dump(stdout) == -1);
+        printf("\t%s: OK\n", __func__);
+        return;
+    }
+    assert(ret == 0);
+    char * a = ctk_malloc(1);
+    assert(a != NULL);
+    char * b = ctk_calloc(3, 100);
+    assert(b != NULL);
+    char * c = ctk_realloc(NULL, 5000);
+    assert(c != NULL);
+    char * d = ctk_realloc(&a, 1 << 20);
+    assert(d != NULL);
+    char * e = ctk_aligned_alloc(64, 16);
+    assert(e != NULL);
+    assert(ctk_malloc(0) == NULL);
+    struct ctk_alloc_stats after;
+    assert(ctk_alloc_stats_snapshot(&after) == 0);
+    assert(after.malloc_calls - before.malloc_calls == 1);
+    assert(after.calloc_calls - before.calloc_calls == 1);
+    assert(after.aligned_calls - before.aligned_calls == 1);
+    assert(after.realloc_calls - before.realloc_calls == 2);
+    assert(after.bytes - before.bytes == 1 + 300 + 5000 + (1 << 20) + 16);
+    // Only the block passed to realloc() can stay in place or move
+    assert(after.realloc_in_place - before.realloc_in_place
+        + after.realloc_moved - before.realloc_moved == 1);
+    // Buckets of 1, 16, 300, 5000 and 1 MiB
+    assert(after.histogram[0] - before.histogram[0] == 1);
+    assert(after.histogram[4] - before.histogram[4] == 1);
+    assert(after.histogram[9] - before.histogram[9] == 1);
+    assert(after.histogram[13] - before.histogram[13] == 1);
+    assert(after.histogram[20] - before.histogram[20] == 1);
+    assert(after.live_bytes - before.live_bytes
+        >= 300 + 5000 + (1 << 20) + 16);
+    assert(after.peak_bytes >= (uint64_t)after.live_bytes);
+    ctk_free(&b);
+    ctk_free(&c);
+    ctk_free(&d);
+    ctk_free(&e);
+    assert(ctk_alloc_stats_snapshot(&after) == 0);
+    assert(after.free_calls - before.free_calls == 4);
+    assert(after.live_bytes == before.live_bytes);
+    FILE * const stream = tmpfile();
+    assert(stream != NULL);
+    assert(ctk_alloc_stats_dump(stream) == 0);
+    assert(ftell(stream) > 0);
+    fclose(stream);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_mmap_alloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_mmap_alloc(void)
+{
+    // size = 0
+    assert(ctk_mmap_alloc(0, 0) == NULL);
+    // Unknown flags
+    assert(ctk_mmap_alloc(1, 1 << 2) == NULL);
+    // size too big
+    assert(ctk_mmap_alloc(SIZE_MAX, 0) == NULL);
+    // Zeroed blocks aligned on a cache line, with every combination of flags
+    const size_t sizes[] = {1, 4096, 3 << 20};
+    for(unsigned int flags = 0; flags < 4; flags++) {
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+            unsigned char * mem = ctk_mmap_alloc(sizes[i], flags);
+            assert(mem != NULL);
+            assert((uintptr_t)mem % CTK_CACHE_LINE_SIZE == 0);
+            assert(mem[0] == 0 && mem[sizes[i] - 1] == 0);
+            memset(mem, 0xAB, sizes[i]);
+            ctk_mmap_free(&mem);
+            assert(mem == NULL);
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_mmap_realloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_mmap_realloc(void)
+{
+    const size_t size = 5000;
+    // size = 0
+    unsigned char * mem = ctk_mmap_alloc(size, CTK_MMAP_HUGE);
+    assert(mem != NULL);
+    assert(ctk_mmap_realloc(&mem, 0) == NULL);
+    assert(mem != NULL);
+    memset(mem, 0x5A, size);
+    // Growth keeps the content, new bytes are zero
+    unsigned char * grown = ctk_mmap_realloc(&mem, 8 << 20);
+    assert(grown != NULL);
+    assert(mem == NULL);
+    assert(grown[0] == 0x5A && grown[size - 1] == 0x5A);
+    assert(grown[size + 4096] == 0 && grown[(8 << 20) - 1] == 0);
+    grown[(8 << 20) - 1] = 1;
+    // Shrinking keeps the beginning
+    unsigned char * shrunk = ctk_mmap_realloc(&grown, 100);
+    assert(shrunk != NULL);
+    assert(grown == NULL);
+    assert(shrunk[0] == 0x5A && shrunk[99] == 0x5A);
+    // Same size
+    mem = ctk_mmap_realloc(&shrunk, 100);
+    assert(mem != NULL);
+    assert(shrunk == NULL);
+    assert(mem[99] == 0x5A);
+    // Pre-faulted growth
+    ctk_mmap_free(&mem);
+    mem = ctk_mmap_alloc(1, CTK_MMAP_POPULATE);
+    assert(mem != NULL);
+    mem[0] = 1;
+    grown = ctk_mmap_realloc(&mem, 1 << 20);
+    assert(grown != NULL);
+    assert(grown[0] == 1 && grown[(1 << 20) - 1] == 0);
+    ctk_mmap_free(&grown);
+    // ptr == NULL
+    mem = ctk_mmap_realloc(NULL, size);
+    assert(mem != NULL);
+    assert(mem[size - 1] == 0);
+    ctk_mmap_free(&mem);
+    // *ptr == NULL
+    mem = ctk_mmap_realloc(&mem, size);
+    assert(mem != NULL);
+    ctk_mmap_free(&mem);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_mmap_free()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_mmap_free(void)
+{
+    (ctk_mmap_free)(NULL);
+    // *ptr = NULL
+    unsigned char * mem = NULL;
+    ctk_mmap_free(&mem);
+    assert(mem == NULL);
+    // *ptr != NULL
+    mem = ctk_mmap_alloc(1, 0);
+    assert(mem != NULL);
+    (ctk_mmap_free)((void*)&mem);
+    assert(mem == NULL);
+    printf("\t%s: OK\n", __func__);
+}
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_arena.h"
+// The API to test
+#include "ctk_arena.h"
+// C Standard Library
+#include <assert.h>
+#include <stdalign.h> // alignof
+#include <stddef.h>   // max_align_t, NULL, size_t
+#include <stdint.h>   // SIZE_MAX, uintptr_t
+#include <stdio.h>    // printf()
+#include <string.h>   // memset()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+#define IS_ALIGNED(ptr, alignment) \
+    ((uintptr_t)(ptr) % (alignment) == 0)
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_arena_create(void);
+static void TEST_ctk_arena_destroy(void);
+static void TEST_ctk_arena_alloc(void);
+static void TEST_ctk_arena_alloc_aligned(void);
+static void TEST_ctk_arena_calloc(void);
+static void TEST_ctk_arena_reset(void);
+static void TEST_ctk_arena_save_restore(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena()
+------------------------------------------------------------------------------*/
+void TEST_ctk_arena(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_arena_create();
+    TEST_ctk_arena_destroy();
+    TEST_ctk_arena_alloc();
+    TEST_ctk_arena_alloc_aligned();
+    TEST_ctk_arena_calloc();
+    TEST_ctk_arena_reset();
+    TEST_ctk_arena_save_restore();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_create(void)
+{
+    // chunk_size = 0
+    assert(ctk_arena_create(0) == NULL);
+    // chunk_size too big
+    assert(ctk_arena_create(SIZE_MAX) == NULL);
+    // chunk_size > 0
+    struct ctk_arena * arena = ctk_arena_create(CTK_ARENA_CHUNK_SIZE);
+    assert(arena != NULL);
+    ctk_arena_destroy(&arena);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_destroy()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_destroy(void)
+{
+    // NULL pointers
+    ctk_arena_destroy(NULL);
+    struct ctk_arena * arena = NULL;
+    ctk_arena_destroy(&arena);
+    assert(arena == NULL);
+    // Arena with several chunks
+    arena = ctk_arena_create(64);
+    assert(arena != NULL);
+    for(int i = 0; i < 100; i++) {
+        assert(ctk_arena_alloc(arena, 48) != NULL);
+    }
+    ctk_arena_destroy(&arena);
+    assert(arena == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_alloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_alloc(void)
+{
+    struct ctk_arena * arena = ctk_arena_create(256);
+    assert(arena != NULL);
+    // NULL arena
+    assert(ctk_arena_alloc(NULL, 1) == NULL);
+    // size = 0
+    assert(ctk_arena_alloc(arena, 0) == NULL);
+    // size too big
+    assert(ctk_arena_alloc(arena, SIZE_MAX) == NULL);
+    // Successive allocations are contiguous(modulo alignment) and don't overlap
+    char * const a = ctk_arena_alloc(arena, 1);
+    char * const b = ctk_arena_alloc(arena, 1);
+    assert(a != NULL && b != NULL);
+    assert(IS_ALIGNED(a, alignof(max_align_t)));
+    assert(IS_ALIGNED(b, alignof(max_align_t)));
+    assert(b == a + alignof(max_align_t));
+    // Allocation bigger than a chunk
+    char * const big = ctk_arena_alloc(arena, 1000);
+    assert(big != NULL);
+    memset(big, 0xFF, 1000);
+    // Allocations go on after a full chunk
+    for(int i = 0; i < 100; i++) {
+        char * const c = ctk_arena_alloc(arena, 100);
+        assert(c != NULL);
+        memset(c, i, 100);
+    }
+    assert(a[0] != (char)0xFF);
+    ctk_arena_destroy(&arena);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_alloc_aligned()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_alloc_aligned(void)
+{
+    struct ctk_arena * arena = ctk_arena_create(256);
+    assert(arena != NULL);
+    // alignment = 0
+    assert(ctk_arena_alloc_aligned(arena, 1, 0) == NULL);
+    // alignment isn't a power of two
+    assert(ctk_arena_alloc_aligned(arena, 1, 24) == NULL);
+    // alignment = 1: no padding
+    char * const a = ctk_arena_alloc_aligned(arena, 3, 1);
+    char * const b = ctk_arena_alloc_aligned(arena, 3, 1);
+    assert(b == a + 3);
+    // Alignments up to bigger than the chunk size
+    for(size_t alignment = 1; alignment <= 4096; alignment *= 2) {
+        ctk_arena_alloc_aligned(arena, 1, 1);
+        void * const ptr = ctk_arena_alloc_aligned(arena, 8, alignment);
+        assert(ptr != NULL);
+        assert(IS_ALIGNED(ptr, alignment));
+    }
+    ctk_arena_destroy(&arena);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_calloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_calloc(void)
+{
+    struct ctk_arena * arena = ctk_arena_create(256);
+    assert(arena != NULL);
+    // num = 0 || size = 0
+    assert(ctk_arena_calloc(arena, 0, 1) == NULL);
+    assert(ctk_arena_calloc(arena, 1, 0) == NULL);
+    // num * size overflows
+    assert(ctk_arena_calloc(arena, SIZE_MAX / 2, 4) == NULL);
+    // Memory reused after a reset is zeroed
+    unsigned char * x = ctk_arena_alloc(arena, 64);
+    assert(x != NULL);
+    memset(x, 0xFF, 64);
+    ctk_arena_reset(arena);
+    x = ctk_arena_calloc(arena, 16, 4);
+    assert(x != NULL);
+    for(size_t i = 0; i < 64; i++) {
+        assert(x[i] == 0);
+    }
+    ctk_arena_destroy(&arena);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_reset()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_reset(void)
+{
+    // NULL arena
+    ctk_arena_reset(NULL);
+    struct ctk_arena * arena = ctk_arena_create(128);
+    assert(arena != NULL);
+    // Memory is handed out again from the start of the first chunk
+    void * const first = ctk_arena_alloc(arena, 16);
+    void * chunks[8] = {NULL};
+    for(int i = 0; i < 8; i++) {
+        chunks[i] = ctk_arena_alloc(arena, 128);
+        assert(chunks[i] != NULL);
+    }
+    ctk_arena_reset(arena);
+    assert(ctk_arena_alloc(arena, 16) == first);
+    // Chunks are reused in the same order
+    for(int i = 0; i < 8; i++) {
+        assert(ctk_arena_alloc(arena, 128) == chunks[i]);
+    }
+    ctk_arena_destroy(&arena);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_arena_save_restore()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_arena_save_restore(void)
+{
+    // NULL arena
+    struct ctk_arena_marker marker = ctk_arena_save(NULL);
+    assert(marker.chunk == NULL);
+    ctk_arena_restore(NULL, marker);
+    struct ctk_arena * arena = ctk_arena_create(128);
+    assert(arena != NULL);
+    // Marker with a NULL chunk is ignored
+    void * const a = ctk_arena_alloc(arena, 16);
+    ctk_arena_restore(arena, marker);
+    assert(ctk_arena_alloc(arena, 16) != a);
+    // Nested scopes
+    const struct ctk_arena_marker outer = ctk_arena_save(arena);
+    void * const b = ctk_arena_alloc(arena, 16);
+    const struct ctk_arena_marker inner = ctk_arena_save(arena);
+    void * const c = ctk_arena_alloc(arena, 16);
+    // Fill several chunks in the inner scope
+    for(int i = 0; i < 10; i++) {
+        assert(ctk_arena_alloc(arena, 100) != NULL);
+    }
+    ctk_arena_restore(arena, inner);
+    assert(ctk_arena_alloc(arena, 16) == c);
+    ctk_arena_restore(arena, outer);
+    assert(ctk_arena_alloc(arena, 16) == b);
+    ctk_arena_destroy(&arena);
+    printf("\t%s: OK\n", __func__);
+}
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_ascii.h"
+// The API to test
+#include "ctk_ascii.h"
+// C Standard Library
+#include <assert.h>
+#include <ctype.h>  // is*(), tolower(), toupper()
+#include <limits.h> // UCHAR_MAX
+#include <stdbool.h>
+#include <stdio.h>  // EOF, printf()
+#include <string.h> // NULL
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Longest array of the whitespace scans tests, several vector blocks
+#define TEST_CTK_ASCII_TRIM_MAX 80
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_ascii_fill(char * str, size_t length, size_t pad, int c);
+static void TEST_ctk_ascii_is(void);
+static void TEST_ctk_ascii_table(void);
+static void TEST_ctk_ascii_tolower(void);
+static void TEST_ctk_ascii_toupper(void);
+static void TEST_ctk_ascii_triml(void);
+static void TEST_ctk_ascii_trimr(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii()
+------------------------------------------------------------------------------*/
+void TEST_ctk_ascii(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_ascii_is();
+    TEST_ctk_ascii_table();
+    TEST_ctk_ascii_tolower();
+    TEST_ctk_ascii_toupper();
+    TEST_ctk_ascii_triml();
+    TEST_ctk_ascii_trimr();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_fill()
+------------------------------------------------------------------------------*/
+// Fills \p{length} bytes of \p{str} with \p{c} between \p{pad} whitespaces at
+// both ends
+static void TEST_ctk_ascii_fill(
+    char * const str, const size_t length, const size_t pad, const int c
+)
+{
+    const char spaces[] = " \t\n\v\f\r";
+    for(size_t i = 0; i < length; i++) {
+        str[i] = (char)c;
+        if(i < pad || length - i <= pad) {
+            str[i] = spaces[i % (sizeof(spaces) - 1)];
+        }
+    }
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_is()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_ascii_is(void)
+{
+    // Invalid range: c < 0, c > UCHAR_MAX and EOF
+    assert(!ctk_ascii_is(-1, CTK_ASCII_SPACE | CTK_ASCII_PUNCT));
+    assert(!ctk_ascii_is(UCHAR_MAX + 1, CTK_ASCII_ALNUM));
+    assert(!ctk_ascii_is(EOF, CTK_ASCII_SPACE));
+    // Valid range
+    assert(ctk_ascii_is('\t', CTK_ASCII_SPACE));
+    assert(ctk_ascii_is('x', CTK_ASCII_ALNUM));
+    assert(ctk_ascii_is('7', CTK_ASCII_ALNUM));
+    assert(!ctk_ascii_is('-', CTK_ASCII_ALNUM));
+    assert(!ctk_ascii_is(0xA0, CTK_ASCII_SPACE));
+    for(int c = 0; c <= UCHAR_MAX; c++) {
+        const bool is = CTK_ASCII_IS(c, CTK_ASCII_DIGIT | CTK_ASCII_UPPER);
+        assert(ctk_ascii_is(c, CTK_ASCII_DIGIT | CTK_ASCII_UPPER) == is);
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_table()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_ascii_table(void)
+{
+    // Same classes as <ctype.h> in the "C" locale of the test program
+    for(int c = 0; c <= UCHAR_MAX; c++) {
+        assert(CTK_ASCII_IS(c, CTK_ASCII_SPACE) == (isspace(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_DIGIT) == (isdigit(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_ALPHA) == (isalpha(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_HEX) == (isxdigit(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_PUNCT) == (ispunct(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_UPPER) == (isupper(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_LOWER) == (islower(c) != 0));
+        assert(CTK_ASCII_IS(c, CTK_ASCII_ALNUM) == (isalnum(c) != 0));
+        assert(CTK_ASCII_TOLOWER(c) == tolower(c));
+        assert(CTK_ASCII_TOUPPER(c) == toupper(c));
+    }
+    // Negative char values are bytes > 0x7F
+    const char byte = (char)0xE9;
+    assert(!CTK_ASCII_IS(byte, CTK_ASCII_ALPHA | CTK_ASCII_PUNCT));
+    assert(CTK_ASCII_TOLOWER(byte) == 0xE9);
+    assert(CTK_ASCII_TOUPPER(byte) == 0xE9);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_tolower()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_ascii_tolower(void)
+{
+    // Invalid range: c < 0, c > UCHAR_MAX and EOF
+    assert(ctk_ascii_tolower(-2) == -2);
+    assert(ctk_ascii_tolower(UCHAR_MAX + 1) == UCHAR_MAX + 1);
+    assert(ctk_ascii_tolower(EOF) == EOF);
+    // Valid range
+    assert(ctk_ascii_tolower('A') == 'a');
+    assert(ctk_ascii_tolower('Z') == 'z');
+    assert(ctk_ascii_tolower('a') == 'a');
+    assert(ctk_ascii_tolower('@') == '@');
+    assert(ctk_ascii_tolower('[') == '[');
+    assert(ctk_ascii_tolower(0xC9) == 0xC9);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_toupper()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_ascii_toupper(void)
+{
+    // Invalid range: c < 0, c > UCHAR_MAX and EOF
+    assert(ctk_ascii_toupper(-2) == -2);
+    assert(ctk_ascii_toupper(UCHAR_MAX + 1) == UCHAR_MAX + 1);
+    assert(ctk_ascii_toupper(EOF) == EOF);
+    // Valid range
+    assert(ctk_ascii_toupper('a') == 'A');
+    assert(ctk_ascii_toupper('z') == 'Z');
+    assert(ctk_ascii_toupper('A') == 'A');
+    assert(ctk_ascii_toupper('`') == '`');
+    assert(ctk_ascii_toupper('{') == '{');
+    assert(ctk_ascii_toupper(0xE9) == 0xE9);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_triml()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_ascii_triml(void)
+{
+    // Str is NULL
+    assert(ctk_ascii_triml(NULL, 0) == 0);
+    assert(ctk_ascii_triml(NULL, 1) == 0);
+    // Empty, all whitespaces, none
+    assert(ctk_ascii_triml("", 0) == 0);
+    assert(ctk_ascii_triml(" \t\n\v\f\r", 6) == 6);
+    assert(ctk_ascii_triml("Lorem ", 6) == 0);
+    // Stops after length characters and at non-ASCII bytes
+    assert(ctk_ascii_triml("  \t x", 2) == 2);
+    assert(ctk_ascii_triml("  \xA0 ", 4) == 2);
+    // Null characters aren't whitespaces
+    assert(ctk_ascii_triml(" \0 ", 3) == 1);
+    // Whitespace runs ending anywhere in or after the vector blocks, next to
+    // bytes which are almost whitespaces
+    const int others[] = {'\b', '\x0E', '!', 0x89, 0xA0, 0xFF};
+    char str[TEST_CTK_ASCII_TRIM_MAX];
+    for(size_t length = 0; length <= TEST_CTK_ASCII_TRIM_MAX; length++) {
+        for(size_t pad = 0; pad <= length; pad++) {
+            for(size_t i = 0; i < sizeof(others) / sizeof(others[0]); i++) {
+                TEST_ctk_ascii_fill(str, length, pad, others[i]);
+                const size_t start = pad < length - pad ? pad : length;
+                assert(ctk_ascii_triml(str, length) == start);
+            }
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_ascii_trimr()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_ascii_trimr(void)
+{
+    // Str is NULL
+    assert(ctk_ascii_trimr(NULL, 0) == 0);
+    assert(ctk_ascii_trimr(NULL, 1) == 0);
+    // Empty, all whitespaces, none
+    assert(ctk_ascii_trimr("", 0) == 0);
+    assert(ctk_ascii_trimr(" \t\n\v\f\r", 6) == 0);
+    assert(ctk_ascii_trimr(" Lorem", 6) == 6);
+    // Only the first length characters are considered
+    assert(ctk_ascii_trimr("x  \t y", 4) == 1);
+    assert(ctk_ascii_trimr(" \xA0  ", 4) == 2);
+    // Null characters aren't whitespaces
+    assert(ctk_ascii_trimr(" \0 ", 3) == 2);
+    // Whitespace runs starting anywhere in or before the vector blocks, next
+    // to bytes which are almost whitespaces
+    const int others[] = {'\b', '\x0E', '!', 0x89, 0xA0, 0xFF};
+    char str[TEST_CTK_ASCII_TRIM_MAX];
+    for(size_t length = 0; length <= TEST_CTK_ASCII_TRIM_MAX; length++) {
+        for(size_t pad = 0; pad <= length; pad++) {
+            for(size_t i = 0; i < sizeof(others) / sizeof(others[0]); i++) {
+                TEST_ctk_ascii_fill(str, length, pad, others[i]);
+                const size_t end = pad < length - pad ? length - pad : 0;
+                assert(ctk_ascii_trimr(str, length) == end);
+            }
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
@@ -25,14 +25,24 @@
 /*==============================================================================
     INCLUDE
 ==============================================================================*/
+// Portability
+#include "ctk_platform.h"
 // Own header
 #include "test_ctk_error.h"
 // The API to test
 #include "ctk_error.h"
 // C Standard Library
 #include <assert.h>
+#include <errno.h>  // errno, EDOM
 #include <stdbool.h>
-#include <stdio.h> // EOF, NULL, printf()
+#include <stddef.h> // size_t
+#include <stdint.h> // int64_t, uint64_t
+#include <stdio.h>  // EOF, fclose(), fgets(), NULL, printf(), rewind(),
+                    // snprintf(), tmpfile(), POSIX fileno()
+#include <string.h> // strcmp(), strncmp(), strstr()
+// Internal
+#include "ctk_string.h"
+#include "ctk_time.h"
 /*==============================================================================
     FUNCTION DECLARATION
 ==============================================================================*/
@@ -44,6 +54,9 @@ static void TEST_CTK_ERROR_RET_0_IF(void);
 static void TEST_CTK_ERROR_RET_EOF_IF(void);
 static void TEST_CTK_ERROR_RET_FALSE_IF(void);
 static void TEST_CTK_ERROR_RET_NEG_1_IF(void);
+static void TEST_CTK_ERROR_UNLIKELY(void);
+static void TEST_ctk_error_sites(void);
+static void TEST_ctk_error_ring(void);
 /*==============================================================================
     FUNCTION DEFINITION
 ==============================================================================*/
@@ -61,6 +74,9 @@ void TEST_ctk_error(void)
     TEST_CTK_ERROR_RET_EOF_IF();
     TEST_CTK_ERROR_RET_FALSE_IF();
     TEST_CTK_ERROR_RET_NEG_1_IF();
+    TEST_CTK_ERROR_UNLIKELY();
+    TEST_ctk_error_sites();
+    TEST_ctk_error_ring();
 }
 /*------------------------------------------------------------------------------
     TEST_CTK_ERROR_RET_VAL_IF_MSG()
@@ -174,3 +190,160 @@ static void TEST_CTK_ERROR_RET_NEG_1_IF(void)
     assert(test_ctk_error_ret_neg_1_if(false) != -1);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_CTK_ERROR_UNLIKELY()
+------------------------------------------------------------------------------*/
+static void TEST_CTK_ERROR_UNLIKELY(void)
+{
+    int x = 42;
+    assert(CTK_ERROR_UNLIKELY(x) == 1);
+    assert(CTK_ERROR_UNLIKELY(x == 42) == 1);
+    assert(CTK_ERROR_UNLIKELY(x != 42) == 0);
+    assert(CTK_ERROR_UNLIKELY(NULL) == 0);
+    (void)x;
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_error_sites()
+------------------------------------------------------------------------------*/
+// Finds the site of a check of the library
+static struct ctk_error_site * test_ctk_error_site(
+    const char * const function, const char * const cond
+)
+{
+    size_t count = 0;
+    struct ctk_error_site * const * const sites = ctk_error_sites(&count);
+    for(size_t i = 0; i < count; i++) {
+        if(strcmp(sites[i]->function, function) == 0
+            && strcmp(sites[i]->cond, cond) == 0) {
+            return sites[i];
+        }
+    }
+    return NULL;
+}
+static void TEST_ctk_error_sites(void)
+{
+    assert(ctk_error_sites(NULL) == NULL);
+    assert(ctk_error_sites_dump(NULL) == -1);
+    size_t count = 42;
+    struct ctk_error_site * const * const sites = ctk_error_sites(&count);
+    assert((count == 0) == (sites == NULL));
+#if defined(CTK_ERROR_SITES)
+    assert(count > 0);
+    struct ctk_error_site * const site =
+        test_ctk_error_site("ctk_strpos", "str == NULL");
+    assert(site != NULL);
+    assert(strstr(site->file, "ctk_string.c") != NULL);
+    assert(site->line > 0);
+    // Only the failing check counts
+    const uint64_t hits = site->hits;
+    assert(ctk_strpos(NULL, "a") == -1);
+    assert(ctk_strpos(NULL, NULL) == -1);
+    assert(ctk_strpos("a", "a") == 0);
+    assert(site->hits == hits + 2);
+    FILE * const stream = tmpfile();
+    assert(stream != NULL);
+    assert(ctk_error_sites_dump(stream) >= 1);
+    rewind(stream);
+    char line[256];
+    bool found = false;
+    while(fgets(line, sizeof(line), stream) != NULL) {
+        found = found || strstr(line, "ctk_strpos(): str == NULL: ") != NULL;
+    }
+    assert(found);
+    fclose(stream);
+    ctk_error_sites_reset();
+    assert(site->hits == 0);
+    assert(ctk_error_sites_dump(stdout) == 0);
+    (void)found;
+#else
+    assert(count == 0);
+    assert(ctk_error_sites_dump(stdout) == 0);
+#endif
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_error_ring()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_error_ring(void)
+{
+    struct ctk_error_event events[CTK_ERROR_RING_CAPACITY + 1];
+    assert(ctk_error_ring_drain(NULL, 1) == 0);
+    assert(ctk_error_ring_drain(NULL, 0) == 0);
+    assert(ctk_error_ring_dump(-1) == -1);
+    // Start from an empty ring
+    while(ctk_error_ring_drain(events, CTK_ERROR_RING_CAPACITY) > 0) {
+        continue;
+    }
+    errno = EDOM;
+    const int64_t before = ctk_time_realtime_ns();
+    assert(ctk_strpos(NULL, "a") == -1);
+    const int64_t after = ctk_time_realtime_ns();
+    assert(errno == EDOM);
+    const size_t count = ctk_error_ring_drain(events, CTK_ERROR_RING_CAPACITY);
+    // The ring needs a library built with `ERROR_RING=true`
+    if(count == 0) {
+        assert(ctk_error_ring_dump(1) == -1);
+        printf("\t%s: OK\n", __func__);
+        return;
+    }
+    // A failure is recorded with its site, errno and time
+    assert(count == 1);
+    assert(strcmp(events[0].site->function, "ctk_strpos") == 0);
+    assert(strcmp(events[0].site->cond, "str == NULL") == 0);
+    assert(events[0].errnum == EDOM);
+    assert(events[0].time_ns >= before && events[0].time_ns <= after);
+    assert(ctk_error_ring_drain(events, CTK_ERROR_RING_CAPACITY) == 0);
+    // Only the last CTK_ERROR_RING_CAPACITY events are kept, oldest first
+    for(int i = 1; i <= CTK_ERROR_RING_CAPACITY + 3; i++) {
+        errno = i;
+        assert(ctk_strpos(NULL, "a") == -1);
+    }
+    assert(ctk_error_ring_drain(events, CTK_ERROR_RING_CAPACITY + 1)
+        == CTK_ERROR_RING_CAPACITY);
+    assert(events[0].errnum == 4);
+    assert(events[CTK_ERROR_RING_CAPACITY - 1].errnum
+        == CTK_ERROR_RING_CAPACITY + 3);
+    for(size_t i = 1; i < CTK_ERROR_RING_CAPACITY; i++) {
+        assert(events[i].time_ns >= events[i - 1].time_ns);
+    }
+    // Draining in several calls
+    errno = 1;
+    assert(ctk_strpos(NULL, "a") == -1);
+    errno = 2;
+    assert(ctk_strpos(NULL, "a") == -1);
+    assert(ctk_error_ring_drain(events, 1) == 1);
+    assert(events[0].errnum == 1);
+    assert(ctk_error_ring_drain(events, 1) == 1);
+    assert(events[0].errnum == 2);
+    assert(ctk_error_ring_drain(events, 1) == 0);
+#if defined(CTK_POSIX)
+    // Dumping doesn't drain
+    errno = EDOM;
+    assert(ctk_strpos(NULL, "a") == -1);
+    assert(ctk_strpos(NULL, "a") == -1);
+    FILE * const stream = tmpfile();
+    assert(stream != NULL);
+    assert(ctk_error_ring_dump(fileno(stream)) == 2);
+    rewind(stream);
+    char line[256];
+    assert(fgets(line, sizeof(line), stream) != NULL);
+    assert(strncmp(line, "ctk_error_ring: 2 events, ", 26) == 0);
+    char expected[64];
+    snprintf(expected, sizeof(expected),
+        "ctk_strpos(): str == NULL: errno %d\n", EDOM);
+    size_t lines = 0;
+    while(fgets(line, sizeof(line), stream) != NULL) {
+        assert(strstr(line, "ctk_string.c:") != NULL);
+        assert(strstr(line, expected) != NULL);
+        lines++;
+    }
+    assert(lines == 2);
+    fclose(stream);
+    assert(ctk_error_ring_drain(events, CTK_ERROR_RING_CAPACITY) == 2);
+    (void)lines;
+#endif
+    (void)before;
+    (void)after;
+    printf("\t%s: OK\n", __func__);
+}
@@ -0,0 +1,565 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_hashmap.h"
+// The API to test
+#include "ctk_hashmap.h"
+// C Standard Library
+#include <assert.h>
+#include <stdalign.h> // alignof
+#include <stdbool.h>
+#include <stddef.h>   // max_align_t, size_t
+#include <stdint.h>   // SIZE_MAX, uint64_t, uintptr_t
+#include <stdio.h>    // printf(), snprintf()
+#include <string.h>   // strcmp()
+// Internal
+#include "ctk_alloc.h"
+/*==============================================================================
+    MACRO
+==============================================================================*/
+#define IS_ALIGNED(ptr, alignment) \
+    ((uintptr_t)(ptr) % (alignment) == 0)
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct test_counting_alloc {
+    size_t allocs;
+    size_t frees;
+};
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_hashmap_create(void);
+static void TEST_ctk_hashmap_destroy(void);
+static void TEST_ctk_hashmap_insert(void);
+static void TEST_ctk_hashmap_get(void);
+static void TEST_ctk_hashmap_remove(void);
+static void TEST_ctk_hashmap_strings(void);
+static void TEST_ctk_hashmap_callbacks(void);
+static void TEST_ctk_hashmap_reserve(void);
+static void TEST_ctk_hashmap_rehash(void);
+static void TEST_ctk_hashmap_next(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap()
+------------------------------------------------------------------------------*/
+void TEST_ctk_hashmap(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_hashmap_create();
+    TEST_ctk_hashmap_destroy();
+    TEST_ctk_hashmap_insert();
+    TEST_ctk_hashmap_get();
+    TEST_ctk_hashmap_remove();
+    TEST_ctk_hashmap_strings();
+    TEST_ctk_hashmap_callbacks();
+    TEST_ctk_hashmap_reserve();
+    TEST_ctk_hashmap_rehash();
+    TEST_ctk_hashmap_next();
+}
+/*------------------------------------------------------------------------------
+    test_counting_malloc()
+------------------------------------------------------------------------------*/
+static void * test_counting_malloc(const size_t size, void * const ctx)
+{
+    struct test_counting_alloc * const counts = ctx;
+    counts->allocs++;
+    return ctk_malloc(size);
+}
+/*------------------------------------------------------------------------------
+    test_counting_free()
+------------------------------------------------------------------------------*/
+static void test_counting_free(void * ptr, void * const ctx)
+{
+    struct test_counting_alloc * const counts = ctx;
+    counts->frees++;
+    ctk_free(&ptr);
+}
+/*------------------------------------------------------------------------------
+    test_constant_hash()
+------------------------------------------------------------------------------*/
+// Sends every key to the same group with the same control byte
+static uint64_t test_constant_hash(const void * const key, void * const ctx)
+{
+    (void)key;
+    (void)ctx;
+    return 42;
+}
+/*------------------------------------------------------------------------------
+    test_int_eq()
+------------------------------------------------------------------------------*/
+static bool test_int_eq(
+    const void * const key, const void * const stored, void * const ctx
+)
+{
+    size_t * const calls = ctx;
+    (*calls)++;
+    return *(const int *)key == *(const int *)stored;
+}
+/*------------------------------------------------------------------------------
+    test_nocase_hash()
+------------------------------------------------------------------------------*/
+// FNV-1a of the lower case string
+static uint64_t test_nocase_hash(const void * const key, void * const ctx)
+{
+    (void)ctx;
+    uint64_t hash = 0xCBF29CE484222325u;
+    for(const char * c = key; *c != '\0'; c++) {
+        const char lower = (*c >= 'A' && *c <= 'Z') ? (char)(*c + 32) : *c;
+        hash = (hash ^ (unsigned char)lower) * 0x100000001B3u;
+    }
+    return hash;
+}
+/*------------------------------------------------------------------------------
+    test_nocase_eq()
+------------------------------------------------------------------------------*/
+static bool test_nocase_eq(
+    const void * const key, const void * const stored, void * const ctx
+)
+{
+    (void)ctx;
+    const char * a = key;
+    const char * b = stored;
+    for(; *a != '\0' && *b != '\0'; a++, b++) {
+        const char la = (*a >= 'A' && *a <= 'Z') ? (char)(*a + 32) : *a;
+        const char lb = (*b >= 'A' && *b <= 'Z') ? (char)(*b + 32) : *b;
+        if(la != lb) {
+            return false;
+        }
+    }
+    return *a == *b;
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_create(void)
+{
+    // NULL config
+    assert(ctk_hashmap_create(NULL) == NULL);
+    // Byte keys without a size
+    assert(ctk_hashmap_create(&(struct ctk_hashmap_config){0}) == NULL);
+    // Only one of hash and eq, only one of alloc and free
+    assert(ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = 1, .hash = test_constant_hash
+    }) == NULL);
+    assert(ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = 1, .eq = test_int_eq
+    }) == NULL);
+    assert(ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = 1, .alloc = test_counting_malloc
+    }) == NULL);
+    // Slot size overflows
+    assert(ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = SIZE_MAX
+    }) == NULL);
+    // Valid maps are empty and have no slot
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int), .value_size = sizeof(double)
+    });
+    assert(map != NULL);
+    assert(ctk_hashmap_size(map) == 0);
+    assert(ctk_hashmap_capacity(map) == 0);
+    ctk_hashmap_destroy(&map);
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .keys = CTK_HASHMAP_KEYS_STRING
+    });
+    assert(map != NULL);
+    ctk_hashmap_destroy(&map);
+    // NULL map
+    assert(ctk_hashmap_size(NULL) == 0);
+    assert(ctk_hashmap_capacity(NULL) == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_destroy()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_destroy(void)
+{
+    // NULL pointers
+    ctk_hashmap_destroy(NULL);
+    struct ctk_hashmap * map = NULL;
+    ctk_hashmap_destroy(&map);
+    // All the memory goes through the allocation functions
+    struct test_counting_alloc counts = {0};
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int),
+        .alloc = test_counting_malloc,
+        .free = test_counting_free,
+        .alloc_ctx = &counts,
+    });
+    assert(map != NULL);
+    for(int i = 0; i < 1000; i++) {
+        assert(ctk_hashmap_insert(map, &i, NULL) != NULL);
+    }
+    assert(counts.allocs > 2);
+    ctk_hashmap_destroy(&map);
+    assert(map == NULL);
+    assert(counts.frees == counts.allocs);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_insert()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_insert(void)
+{
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(uint64_t), .value_size = sizeof(uint64_t)
+    });
+    assert(map != NULL);
+    // NULL pointers
+    assert(ctk_hashmap_insert(NULL, &(uint64_t){1}, NULL) == NULL);
+    assert(ctk_hashmap_insert(map, NULL, NULL) == NULL);
+    // New keys get a zeroed value without a value, values are aligned
+    uint64_t * value = ctk_hashmap_insert(map, &(uint64_t){1}, NULL);
+    assert(value != NULL);
+    assert(IS_ALIGNED(value, alignof(uint64_t)));
+    assert(*value == 0);
+    assert(ctk_hashmap_size(map) == 1);
+    assert(ctk_hashmap_capacity(map) == 14);
+    // Existing keys keep their value without a value, and get the new one
+    *value = 15;
+    assert(ctk_hashmap_insert(map, &(uint64_t){1}, NULL) == value);
+    assert(*value == 15);
+    assert(ctk_hashmap_insert(map, &(uint64_t){1}, &(uint64_t){25}) == value);
+    assert(*value == 25);
+    assert(ctk_hashmap_size(map) == 1);
+    // The map grows at 7/8 and keeps all its keys
+    for(uint64_t i = 0; i < 100000; i++) {
+        value = ctk_hashmap_insert(map, &i, &i);
+        assert(value != NULL);
+        assert(ctk_hashmap_size(map) <= ctk_hashmap_capacity(map));
+    }
+    assert(ctk_hashmap_size(map) == 100000);
+    assert(ctk_hashmap_capacity(map) == 14 * 8192);
+    for(uint64_t i = 0; i < 100000; i++) {
+        value = ctk_hashmap_get(map, &i);
+        assert(value != NULL && *value == i);
+    }
+    ctk_hashmap_destroy(&map);
+    // Sets return the key in the map
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = 3
+    });
+    assert(map != NULL);
+    char * key = ctk_hashmap_insert(map, "abc", NULL);
+    assert(key != NULL && memcmp(key, "abc", 3) == 0);
+    assert(ctk_hashmap_insert(map, "abc", "ignored") == key);
+    assert(ctk_hashmap_get(map, "abc") == key);
+    ctk_hashmap_destroy(&map);
+    // Big values are aligned for any type
+    struct big { alignas(max_align_t) char bytes[48]; };
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = 1, .value_size = sizeof(struct big)
+    });
+    assert(map != NULL);
+    for(int i = 0; i < 200; i++) {
+        void * const big = ctk_hashmap_insert(map, &(char){(char)i}, NULL);
+        assert(IS_ALIGNED(big, alignof(max_align_t)));
+    }
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_get()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_get(void)
+{
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int), .value_size = sizeof(int)
+    });
+    assert(map != NULL);
+    // NULL pointers
+    assert(ctk_hashmap_get(NULL, &(int){0}) == NULL);
+    assert(ctk_hashmap_get(map, NULL) == NULL);
+    // Empty map
+    assert(ctk_hashmap_get(map, &(int){0}) == NULL);
+    // Present and missing keys
+    for(int i = 0; i < 1000; i += 2) {
+        assert(ctk_hashmap_insert(map, &i, &(int){-i}) != NULL);
+    }
+    for(int i = 0; i < 1000; i++) {
+        const int * const value = ctk_hashmap_get(map, &i);
+        assert((value != NULL) == (i % 2 == 0));
+        assert(value == NULL || *value == -i);
+    }
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_remove()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_remove(void)
+{
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int), .value_size = sizeof(int)
+    });
+    assert(map != NULL);
+    // NULL pointers and empty map
+    assert(!ctk_hashmap_remove(NULL, &(int){0}));
+    assert(!ctk_hashmap_remove(map, NULL));
+    assert(!ctk_hashmap_remove(map, &(int){0}));
+    // Removed keys are gone, the other keys don't move
+    for(int i = 0; i < 1000; i++) {
+        assert(ctk_hashmap_insert(map, &i, &i) != NULL);
+    }
+    const int * const kept = ctk_hashmap_get(map, &(int){1});
+    for(int i = 0; i < 1000; i += 2) {
+        assert(ctk_hashmap_remove(map, &i));
+        assert(!ctk_hashmap_remove(map, &i));
+    }
+    assert(ctk_hashmap_size(map) == 500);
+    assert(ctk_hashmap_get(map, &(int){1}) == kept);
+    for(int i = 0; i < 1000; i++) {
+        assert((ctk_hashmap_get(map, &i) != NULL) == (i % 2 == 1));
+    }
+    // Churn leaves no tombstone: the map never grows
+    const size_t capacity = ctk_hashmap_capacity(map);
+    for(int i = 1000; i < 200000; i++) {
+        assert(ctk_hashmap_insert(map, &i, &i) != NULL);
+        const int old = i - 500;
+        assert(ctk_hashmap_remove(map, &old) == (old >= 1000 || old % 2));
+    }
+    assert(ctk_hashmap_capacity(map) == capacity);
+    ctk_hashmap_clear(map);
+    ctk_hashmap_clear(NULL);
+    assert(ctk_hashmap_size(map) == 0);
+    assert(ctk_hashmap_capacity(map) == capacity);
+    assert(ctk_hashmap_get(map, &(int){199999}) == NULL);
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_strings()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_strings(void)
+{
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .keys = CTK_HASHMAP_KEYS_STRING, .value_size = sizeof(int)
+    });
+    assert(map != NULL);
+    // Keys are compared by content and stored by pointer
+    char names[500][16];
+    for(int i = 0; i < 500; i++) {
+        snprintf(names[i], sizeof(names[i]), "name%d", i);
+        assert(ctk_hashmap_insert(map, names[i], &i) != NULL);
+    }
+    assert(ctk_hashmap_size(map) == 500);
+    char copy[16];
+    for(int i = 0; i < 500; i++) {
+        snprintf(copy, sizeof(copy), "name%d", i);
+        const int * const value = ctk_hashmap_get(map, copy);
+        assert(value != NULL && *value == i);
+    }
+    assert(ctk_hashmap_get(map, "name500") == NULL);
+    assert(ctk_hashmap_get(map, "") == NULL);
+    assert(ctk_hashmap_remove(map, "name7"));
+    assert(ctk_hashmap_get(map, names[7]) == NULL);
+    ctk_hashmap_destroy(&map);
+    // String sets return the address of the stored pointer
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .keys = CTK_HASHMAP_KEYS_STRING
+    });
+    assert(map != NULL);
+    const char ** const stored = ctk_hashmap_insert(map, names[3], NULL);
+    assert(stored != NULL && *stored == names[3]);
+    assert(ctk_hashmap_insert(map, "", NULL) != NULL);
+    assert(ctk_hashmap_get(map, "") != NULL);
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_callbacks()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_callbacks(void)
+{
+    // Every key collides: groups overflow and their counters saturate
+    size_t calls = 0;
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int),
+        .value_size = sizeof(int),
+        .hash = test_constant_hash,
+        .eq = test_int_eq,
+        .ctx = &calls,
+    });
+    assert(map != NULL);
+    for(int i = 0; i < 600; i++) {
+        assert(ctk_hashmap_insert(map, &i, &i) != NULL);
+    }
+    assert(calls > 0);
+    for(int i = 0; i < 600; i++) {
+        const int * const value = ctk_hashmap_get(map, &i);
+        assert(value != NULL && *value == i);
+    }
+    assert(ctk_hashmap_get(map, &(int){600}) == NULL);
+    for(int i = 0; i < 600; i += 3) {
+        assert(ctk_hashmap_remove(map, &i));
+    }
+    for(int i = 0; i < 600; i++) {
+        assert((ctk_hashmap_get(map, &i) != NULL) == (i % 3 != 0));
+    }
+    ctk_hashmap_destroy(&map);
+    // Case insensitive string keys
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .keys = CTK_HASHMAP_KEYS_STRING,
+        .hash = test_nocase_hash,
+        .eq = test_nocase_eq,
+    });
+    assert(map != NULL);
+    const char ** const stored = ctk_hashmap_insert(map, "Content-Type", NULL);
+    assert(ctk_hashmap_insert(map, "content-type", NULL) == stored);
+    assert(strcmp(*stored, "Content-Type") == 0);
+    assert(ctk_hashmap_get(map, "CONTENT-TYPE") == stored);
+    assert(ctk_hashmap_get(map, "Content-Length") == NULL);
+    assert(ctk_hashmap_size(map) == 1);
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_reserve()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_reserve(void)
+{
+    struct test_counting_alloc counts = {0};
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int),
+        .alloc = test_counting_malloc,
+        .free = test_counting_free,
+        .alloc_ctx = &counts,
+    });
+    assert(map != NULL);
+    // NULL map, too many keys
+    assert(ctk_hashmap_reserve(NULL, 1) == -1);
+    assert(ctk_hashmap_reserve(map, SIZE_MAX) == -1);
+    // Reserved keys are inserted without allocating
+    assert(ctk_hashmap_reserve(map, 1000) == 0);
+    assert(ctk_hashmap_capacity(map) >= 1000);
+    const size_t allocs = counts.allocs;
+    for(int i = 0; i < 1000; i++) {
+        assert(ctk_hashmap_insert(map, &i, NULL) != NULL);
+    }
+    assert(counts.allocs == allocs);
+    // Never shrinks
+    const size_t capacity = ctk_hashmap_capacity(map);
+    assert(ctk_hashmap_reserve(map, 10) == 0);
+    assert(ctk_hashmap_capacity(map) == capacity);
+    assert(counts.allocs == allocs);
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_rehash()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_rehash(void)
+{
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int), .value_size = sizeof(int)
+    });
+    assert(map != NULL);
+    // NULL map, empty map
+    assert(ctk_hashmap_rehash(NULL, 0) == -1);
+    assert(ctk_hashmap_rehash(map, 0) == 0);
+    assert(ctk_hashmap_capacity(map) == 0);
+    // Shrinks to fit the keys, which are kept
+    for(int i = 0; i < 10000; i++) {
+        assert(ctk_hashmap_insert(map, &i, &i) != NULL);
+    }
+    for(int i = 100; i < 10000; i++) {
+        assert(ctk_hashmap_remove(map, &i));
+    }
+    assert(ctk_hashmap_rehash(map, 0) == 0);
+    assert(ctk_hashmap_capacity(map) == 14 * 8);
+    assert(ctk_hashmap_rehash(map, 1000) == 0);
+    assert(ctk_hashmap_capacity(map) == 14 * 128);
+    for(int i = 0; i < 100; i++) {
+        const int * const value = ctk_hashmap_get(map, &i);
+        assert(value != NULL && *value == i);
+    }
+    // Frees the slots of an empty map
+    ctk_hashmap_clear(map);
+    assert(ctk_hashmap_rehash(map, 0) == 0);
+    assert(ctk_hashmap_capacity(map) == 0);
+    assert(ctk_hashmap_get(map, &(int){0}) == NULL);
+    assert(ctk_hashmap_insert(map, &(int){0}, NULL) != NULL);
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hashmap_next()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hashmap_next(void)
+{
+    struct ctk_hashmap * map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .key_size = sizeof(int), .value_size = sizeof(int)
+    });
+    assert(map != NULL);
+    size_t iter = 0;
+    const void * key = NULL;
+    void * value = NULL;
+    // NULL pointers, empty map
+    assert(!ctk_hashmap_next(NULL, &iter, &key, &value));
+    assert(!ctk_hashmap_next(map, NULL, &key, &value));
+    assert(!ctk_hashmap_next(map, &iter, &key, &value));
+    // Every key is seen once, removing the current key is allowed
+    bool seen[300] = {false};
+    for(int i = 0; i < 300; i++) {
+        assert(ctk_hashmap_insert(map, &i, &(int){i * 2}) != NULL);
+    }
+    iter = 0;
+    while(ctk_hashmap_next(map, &iter, &key, &value)) {
+        const int k = *(const int *)key;
+        assert(*(int *)value == k * 2);
+        assert(!seen[k]);
+        seen[k] = true;
+        if(k % 2 == 0) {
+            assert(ctk_hashmap_remove(map, &k));
+        }
+    }
+    for(int i = 0; i < 300; i++) {
+        assert(seen[i]);
+    }
+    assert(ctk_hashmap_size(map) == 150);
+    size_t count = 0;
+    iter = 0;
+    while(ctk_hashmap_next(map, &iter, NULL, NULL)) {
+        count++;
+    }
+    assert(count == 150);
+    ctk_hashmap_destroy(&map);
+    // String keys are the strings
+    map = ctk_hashmap_create(&(struct ctk_hashmap_config){
+        .keys = CTK_HASHMAP_KEYS_STRING
+    });
+    assert(map != NULL);
+    const char * const name = "name";
+    assert(ctk_hashmap_insert(map, name, NULL) != NULL);
+    iter = 0;
+    assert(ctk_hashmap_next(map, &iter, &key, &value));
+    assert(key == name);
+    assert(!ctk_hashmap_next(map, &iter, &key, &value));
+    ctk_hashmap_destroy(&map);
+    printf("\t%s: OK\n", __func__);
+}
@@ -0,0 +1,379 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "test_ctk_log.h"
+// The API to test
+#include "ctk_log.h"
+// C Standard Library
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h> // NULL, size_t
+#include <stdint.h> // uint64_t
+#include <stdio.h>  // fclose(), fgets(), printf(), rewind(), snprintf(),
+                    // sscanf(), tmpfile(), POSIX fileno()
+#include <string.h> // memset(), strcmp(), strlen(), strstr()
+#if defined(CTK_POSIX)
+    #include <pthread.h>
+    #include <time.h>   // POSIX nanosleep()
+    #include <unistd.h> // close(), pipe(), read(), ssize_t
+#endif
+// Internal
+#include "ctk_time.h"
+/*==============================================================================
+    DEFINE
+==============================================================================*/
+#define TEST_LOG_THREADS 4
+#define TEST_LOG_RECORDS 1000
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_log_create(void);
+static void TEST_ctk_log_destroy(void);
+static void TEST_ctk_log_write(void);
+static void TEST_ctk_log_write_threads(void);
+static void TEST_ctk_log_write_sparse(void);
+static void TEST_ctk_log_overflow(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_log()
+------------------------------------------------------------------------------*/
+void TEST_ctk_log(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_log_create();
+    TEST_ctk_log_destroy();
+#if defined(CTK_POSIX)
+    TEST_ctk_log_write();
+    TEST_ctk_log_write_threads();
+    TEST_ctk_log_write_sparse();
+    TEST_ctk_log_overflow();
+#endif
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_log_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_log_create(void)
+{
+    assert(ctk_log_create(NULL) == NULL);
+    struct ctk_log_config config = {
+        .fd = 1,
+        .queue_capacity = 8,
+        .overflow = CTK_LOG_OVERFLOW_DROP,
+        .level = CTK_LOG_INFO
+    };
+    // Invalid descriptor, capacity, policy or level
+    config.fd = -1;
+    assert(ctk_log_create(&config) == NULL);
+    config.fd = 1;
+    config.queue_capacity = 0;
+    assert(ctk_log_create(&config) == NULL);
+    config.queue_capacity = 12;
+    assert(ctk_log_create(&config) == NULL);
+    config.queue_capacity = 8;
+    config.overflow = (enum ctk_log_overflow)2;
+    assert(ctk_log_create(&config) == NULL);
+    config.overflow = CTK_LOG_OVERFLOW_BLOCK;
+    config.level = (enum ctk_log_level)4;
+    assert(ctk_log_create(&config) == NULL);
+    config.level = CTK_LOG_ERROR;
+#if defined(CTK_POSIX)
+    // Valid logger, nothing is written
+    struct ctk_log * log = ctk_log_create(&config);
+    assert(log != NULL);
+    struct ctk_log_stats stats;
+    memset(&stats, 0xFF, sizeof(stats));
+    assert(ctk_log_stats_snapshot(log, &stats) == 0);
+    assert(stats.records == 0 && stats.dropped == 0 && stats.bytes == 0);
+    assert(stats.writes == 0 && stats.errors == 0);
+    assert(ctk_log_stats_snapshot(NULL, &stats) == -1);
+    assert(ctk_log_stats_snapshot(log, NULL) == -1);
+    ctk_log_destroy(&log);
+    assert(log == NULL);
+#else
+    assert(ctk_log_create(&config) == NULL);
+#endif
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_log_destroy()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_log_destroy(void)
+{
+    struct ctk_log * log = NULL;
+    ctk_log_destroy(NULL);
+    ctk_log_destroy(&log);
+    assert(log == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+#if defined(CTK_POSIX)
+/*------------------------------------------------------------------------------
+    TEST_ctk_log_write()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_log_write(void)
+{
+    FILE * const stream = tmpfile();
+    assert(stream != NULL);
+    struct ctk_log * log = ctk_log_create(&(struct ctk_log_config){
+        .fd = fileno(stream),
+        .queue_capacity = 4,
+        .overflow = CTK_LOG_OVERFLOW_BLOCK,
+        .level = CTK_LOG_INFO
+    });
+    assert(log != NULL);
+    assert(ctk_log_write(NULL, CTK_LOG_INFO, "a") == -1);
+    assert(ctk_log_write(log, (enum ctk_log_level)4, "a") == -1);
+    assert(ctk_log_write(log, CTK_LOG_INFO, NULL) == -1);
+    assert(ctk_log_flush(NULL) == -1);
+    // Below the level of the logger: discarded without error
+    assert(ctk_log_write(log, CTK_LOG_DEBUG, "debug") == 0);
+    assert(ctk_log_write(log, CTK_LOG_INFO, "port %d", 8080) == 0);
+    assert(ctk_log_write(log, CTK_LOG_ERROR, "%s", "") == 0);
+    // Truncated to a record, the newline is kept
+    char message[2 * CTK_LOG_RECORD_SIZE];
+    memset(message, 'x', sizeof(message) - 1);
+    message[sizeof(message) - 1] = '\0';
+    assert(ctk_log_write(log, CTK_LOG_WARNING, "%s", message) == 0);
+    // More records than a queue holds
+    for(int i = 0; i < 10; i++) {
+        assert(ctk_log_write(log, CTK_LOG_INFO, "%d", i) == 0);
+    }
+    assert(ctk_log_flush(log) == 0);
+    struct ctk_log_stats stats;
+    assert(ctk_log_stats_snapshot(log, &stats) == 0);
+    assert(stats.records == 13 && stats.dropped == 0 && stats.errors == 0);
+    assert(stats.writes >= 1 && stats.writes <= stats.records);
+    rewind(stream);
+    char line[2 * CTK_LOG_RECORD_SIZE];
+    const size_t prefix = CTK_TIME_ISO8601_US_STR_LENGTH - 1;
+    // "YYYY-MM-DDThh:mm:ss.ssssss+hhmm LEVEL message\n"
+    assert(fgets(line, sizeof(line), stream) != NULL);
+    assert(strlen(line) > prefix && line[prefix] == ' ');
+    assert(line[4] == '-' && line[7] == '-' && line[10] == 'T');
+    assert(line[13] == ':' && line[16] == ':' && line[19] == '.');
+    assert(strcmp(line + prefix, " INFO port 8080\n") == 0);
+    assert(fgets(line, sizeof(line), stream) != NULL);
+    assert(strcmp(line + prefix, " ERROR \n") == 0);
+    assert(fgets(line, sizeof(line), stream) != NULL);
+    assert(strlen(line) == CTK_LOG_RECORD_SIZE - sizeof(size_t));
+    assert(strstr(line, " WARNING xxx") == line + prefix);
+    assert(line[strlen(line) - 1] == '\n');
+    for(int i = 0; i < 10; i++) {
+        char expected[16];
+        snprintf(expected, sizeof(expected), " INFO %d\n", i);
+        assert(fgets(line, sizeof(line), stream) != NULL);
+        assert(strcmp(line + prefix, expected) == 0);
+    }
+    assert(fgets(line, sizeof(line), stream) == NULL);
+    // Pending records are written by ctk_log_destroy()
+    assert(ctk_log_write(log, CTK_LOG_INFO, "last") == 0);
+    ctk_log_destroy(&log);
+    assert(log == NULL);
+    // The writer moved the offset shared with `stream`, read from the start
+    rewind(stream);
+    size_t lines = 0;
+    while(fgets(line, sizeof(line), stream) != NULL) {
+        lines++;
+    }
+    assert(lines == 14);
+    assert(strcmp(line + prefix, " INFO last\n") == 0);
+    (void)lines;
+    fclose(stream);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_log_write_threads()
+------------------------------------------------------------------------------*/
+struct test_log_producer {
+    struct ctk_log * log;
+    int id;
+};
+static void * test_log_producer(void * const arg)
+{
+    const struct test_log_producer * const producer = arg;
+    for(int i = 0; i < TEST_LOG_RECORDS; i++) {
+        const int ret =
+            ctk_log_write(producer->log, CTK_LOG_INFO, "%d %d", producer->id, i);
+        assert(ret == 0);
+        (void)ret;
+    }
+    return NULL;
+}
+static void TEST_ctk_log_write_threads(void)
+{
+    FILE * const stream = tmpfile();
+    assert(stream != NULL);
+    struct ctk_log * log = ctk_log_create(&(struct ctk_log_config){
+        .fd = fileno(stream),
+        .queue_capacity = 16,
+        .overflow = CTK_LOG_OVERFLOW_BLOCK,
+        .level = CTK_LOG_DEBUG
+    });
+    assert(log != NULL);
+    // Twice as many threads as queues: finished threads give their queue back
+    for(int round = 0; round < 2; round++) {
+        pthread_t threads[TEST_LOG_THREADS];
+        struct test_log_producer producers[TEST_LOG_THREADS];
+        for(int i = 0; i < TEST_LOG_THREADS; i++) {
+            producers[i].log = log;
+            producers[i].id = round * TEST_LOG_THREADS + i;
+            const int ret = pthread_create(
+                &threads[i], NULL, test_log_producer, &producers[i]
+            );
+            assert(ret == 0);
+            (void)ret;
+        }
+        for(int i = 0; i < TEST_LOG_THREADS; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+    assert(ctk_log_flush(log) == 0);
+    struct ctk_log_stats stats;
+    assert(ctk_log_stats_snapshot(log, &stats) == 0);
+    assert(stats.records == 2 * TEST_LOG_THREADS * TEST_LOG_RECORDS);
+    assert(stats.dropped == 0 && stats.errors == 0);
+    ctk_log_destroy(&log);
+    // Records of a thread are written in order
+    int next[2 * TEST_LOG_THREADS] = {0};
+    rewind(stream);
+    char line[CTK_LOG_RECORD_SIZE];
+    size_t lines = 0;
+    while(fgets(line, sizeof(line), stream) != NULL) {
+        int id = -1;
+        int i = -1;
+        const char * const message = strstr(line, " INFO ");
+        assert(message != NULL);
+        assert(sscanf(message, " INFO %d %d", &id, &i) == 2);
+        assert(id >= 0 && id < 2 * TEST_LOG_THREADS);
+        assert(i == next[id]);
+        next[id]++;
+        lines++;
+        (void)message;
+        (void)i;
+    }
+    assert(lines == 2 * TEST_LOG_THREADS * TEST_LOG_RECORDS);
+    fclose(stream);
+    (void)next;
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_log_write_sparse()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_log_write_sparse(void)
+{
+    FILE * const stream = tmpfile();
+    assert(stream != NULL);
+    struct ctk_log * log = ctk_log_create(&(struct ctk_log_config){
+        .fd = fileno(stream),
+        .queue_capacity = 1024,
+        .overflow = CTK_LOG_OVERFLOW_BLOCK,
+        .level = CTK_LOG_INFO
+    });
+    assert(log != NULL);
+    // A record every 50 us, well past the first batch: the writer must be
+    // left to gather them instead of being woken for each one
+    const struct timespec pause = ctk_time_to_timespec(50 * CTK_TIME_NS_PER_US);
+    for(int i = 0; i < TEST_LOG_RECORDS; i++) {
+        assert(ctk_log_write(log, CTK_LOG_INFO, "%d", i) == 0);
+        nanosleep(&pause, NULL);
+    }
+    assert(ctk_log_flush(log) == 0);
+    struct ctk_log_stats stats;
+    assert(ctk_log_stats_snapshot(log, &stats) == 0);
+    assert(stats.records == TEST_LOG_RECORDS);
+    assert(stats.writes * 4 < stats.records);
+    ctk_log_destroy(&log);
+    fclose(stream);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_log_overflow()
+------------------------------------------------------------------------------*/
+// Reads a pipe until end-of-file, returning the number of bytes read
+static void * test_log_reader(void * const arg)
+{
+    const int fd = *(const int *)arg;
+    static uint64_t total;
+    total = 0;
+    char buf[4096];
+    ssize_t n = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0) {
+        total += (uint64_t)n;
+    }
+    return &total;
+}
+static void TEST_ctk_log_overflow(void)
+{
+    const enum ctk_log_overflow policies[] = {
+        CTK_LOG_OVERFLOW_DROP, CTK_LOG_OVERFLOW_BLOCK
+    };
+    for(size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        int fds[2] = {-1, -1};
+        const int piped = pipe(fds);
+        assert(piped == 0);
+        struct ctk_log * log = ctk_log_create(&(struct ctk_log_config){
+            .fd = fds[1],
+            .queue_capacity = 4,
+            .overflow = policies[p],
+            .level = CTK_LOG_INFO
+        });
+        assert(log != NULL);
+        pthread_t reader;
+        // Without a reader the writer blocks once the pipe is full, so the
+        // queue fills up and records are dropped
+        const bool drop = policies[p] == CTK_LOG_OVERFLOW_DROP;
+        int created = drop ? 0
+            : pthread_create(&reader, NULL, test_log_reader, &fds[0]);
+        uint64_t failed = 0;
+        for(int i = 0; i < 4096; i++) {
+            failed += ctk_log_write(log, CTK_LOG_INFO, "%0200d", i) != 0;
+        }
+        if(drop) {
+            assert(failed > 0);
+            created = pthread_create(&reader, NULL, test_log_reader, &fds[0]);
+        }
+        assert(created == 0);
+        assert(drop || failed == 0);
+        assert(ctk_log_flush(log) == 0);
+        struct ctk_log_stats stats;
+        assert(ctk_log_stats_snapshot(log, &stats) == 0);
+        assert(stats.dropped == failed);
+        assert(stats.records + stats.dropped == 4096);
+        assert(stats.errors == 0);
+        ctk_log_destroy(&log);
+        close(fds[1]);
+        void * total = NULL;
+        pthread_join(reader, &total);
+        assert(*(uint64_t *)total == stats.bytes);
+        close(fds[0]);
+        (void)piped;
+        (void)total;
+    }
+    printf("\t%s: OK\n", __func__);
+}
+#endif
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2022 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Portability
+#include "ctk_platform.h"
+// Own header
+#include "test_ctk_platform.h"
+// C Standard Library
+#include <assert.h>
+#include <stdalign.h> // alignof()
+#include <stdatomic.h> // CTK_DISPATCH() without CTK_IFUNC
+#include <stddef.h>    // offsetof(), size_t
+#include <stdint.h>    // uint64_t, uintptr_t
+#include <stdio.h>     // printf()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_cpu_detect(void);
+static void TEST_ctk_dispatch(void);
+static void TEST_ctk_memory_sizes(void);
+static void TEST_ctk_cache_padded(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_platform()
+------------------------------------------------------------------------------*/
+void TEST_ctk_platform(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_cpu_detect();
+    TEST_ctk_dispatch();
+    TEST_ctk_memory_sizes();
+    TEST_ctk_cache_padded();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_cpu_detect()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_cpu_detect(void)
+{
+    const struct ctk_cpu_features cpu = ctk_cpu_detect();
+    // Cached result
+    const struct ctk_cpu_features again = ctk_cpu_detect();
+    assert(cpu.sse2 == again.sse2 && cpu.avx2 == again.avx2);
+    assert(cpu.neon == again.neon && cpu.sve == again.sve);
+    // Extensions implied by others
+    assert(!cpu.sse3 || cpu.sse2);
+    assert(!cpu.sse42 || cpu.sse41);
+    assert(!cpu.avx2 || cpu.avx);
+    assert(!cpu.avx512bw || cpu.avx512f);
+#if defined(__x86_64__)
+    // SSE2 is part of the x86-64 baseline
+    assert(cpu.sse2);
+#endif
+#if defined(CTK_X86) && defined(__GNUC__)
+    // Same answer as the compiler runtime, which also checks the OS support
+    assert(cpu.sse42 == (__builtin_cpu_supports("sse4.2") != 0));
+    assert(cpu.popcnt == (__builtin_cpu_supports("popcnt") != 0));
+    assert(cpu.avx == (__builtin_cpu_supports("avx") != 0));
+    assert(cpu.avx2 == (__builtin_cpu_supports("avx2") != 0));
+    assert(cpu.bmi2 == (__builtin_cpu_supports("bmi2") != 0));
+    assert(cpu.avx512f == (__builtin_cpu_supports("avx512f") != 0));
+#endif
+#if !defined(CTK_X86)
+    assert(!cpu.sse2 && !cpu.avx2);
+#endif
+#if !defined(CTK_ARM64)
+    assert(!cpu.neon && !cpu.sve);
+#endif
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_dispatch()
+------------------------------------------------------------------------------*/
+static int TEST_ctk_dispatch_add(int a, int b)
+{
+    return a + b;
+}
+static int TEST_ctk_dispatch_sub(int a, int b)
+{
+    return a - b;
+}
+static int (* TEST_ctk_dispatch_resolve(void))(int, int)
+{
+    if(ctk_cpu_detect().sse2) {
+        return TEST_ctk_dispatch_sub;
+    }
+    return TEST_ctk_dispatch_add;
+}
+CTK_DISPATCH(int, TEST_ctk_dispatch_op, (int a, int b), (a, b),
+    TEST_ctk_dispatch_resolve
+)
+static void TEST_ctk_dispatch(void)
+{
+    // The kernel matches the features, on every call
+    const int expected = ctk_cpu_detect().sse2 ? 1 : 5;
+    for(int i = 0; i < 3; i++) {
+        assert(TEST_ctk_dispatch_op(3, 2) == expected);
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_memory_sizes()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_memory_sizes(void)
+{
+    // Powers of two, same result on every call
+    const size_t line = ctk_cache_line_size();
+    assert(line >= 16 && (line & (line - 1)) == 0);
+    assert(ctk_cache_line_size() == line);
+    const size_t page = ctk_page_size();
+    assert(page >= 4096 && (page & (page - 1)) == 0);
+    assert(ctk_page_size() == page);
+    assert(page > line);
+    const size_t huge = ctk_huge_page_size();
+    assert(huge == 0 || (huge > page && (huge & (huge - 1)) == 0));
+    assert(ctk_huge_page_size() == huge);
+#if defined(CTK_X86)
+    assert(line == CTK_CACHE_LINE_SIZE);
+    assert(page == CTK_PAGE_SIZE);
+#endif
+    // Integer constant expressions
+    _Static_assert(CTK_ALIGN_UP(0, 64) == 0, "");
+    _Static_assert(CTK_ALIGN_UP(1, 64) == 64, "");
+    _Static_assert(CTK_ALIGN_UP(64, 64) == 64, "");
+    _Static_assert(CTK_ALIGN_UP(65, 64) == 128, "");
+    _Static_assert(CTK_ALIGN_UP(7, 3) == 9, "");
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_cache_padded()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_cache_padded(void)
+{
+    struct queue {
+        CTK_CACHE_ALIGNED size_t head;
+        size_t head_cache;
+        CTK_CACHE_ALIGNED size_t tail;
+    };
+    _Static_assert(alignof(struct queue) == CTK_CACHE_LINE_SIZE, "");
+    _Static_assert(sizeof(struct queue) == 2 * CTK_CACHE_LINE_SIZE, "");
+    _Static_assert(offsetof(struct queue, tail) == CTK_CACHE_LINE_SIZE, "");
+    // Consecutive elements are in different cache lines
+    CTK_CACHE_PADDED(uint64_t) counters[4];
+    _Static_assert(sizeof(counters[0]) == CTK_CACHE_LINE_SIZE, "");
+    for(size_t i = 0; i < 4; i++) {
+        assert((uintptr_t)&counters[i] % CTK_CACHE_LINE_SIZE == 0);
+        counters[i].value = i;
+    }
+    assert(counters[3].value == 3);
+    // Types bigger than a cache line are padded to the next one
+    CTK_CACHE_PADDED(struct { char bytes[CTK_CACHE_LINE_SIZE + 1]; }) big;
+    _Static_assert(sizeof(big) == 2 * CTK_CACHE_LINE_SIZE, "");
+    big.value.bytes[CTK_CACHE_LINE_SIZE] = 1;
+    assert(big.value.bytes[CTK_CACHE_LINE_SIZE] == 1);
+    printf("\t%s: OK\n", __func__);
+}
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_pool.h"
+// The API to test
+#include "ctk_pool.h"
+// C Standard Library
+#include <assert.h>
+#include <stdint.h> // SIZE_MAX, uintptr_t
+#include <stdio.h>  // printf()
+#include <string.h> // memset()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+#define IS_ALIGNED(ptr, alignment) \
+    ((uintptr_t)(ptr) % (alignment) == 0)
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_pool_create(void);
+static void TEST_ctk_pool_destroy(void);
+static void TEST_ctk_pool_alloc(void);
+static void TEST_ctk_pool_calloc(void);
+static void TEST_ctk_pool_free(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_pool()
+------------------------------------------------------------------------------*/
+void TEST_ctk_pool(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_pool_create();
+    TEST_ctk_pool_destroy();
+    TEST_ctk_pool_alloc();
+    TEST_ctk_pool_calloc();
+    TEST_ctk_pool_free();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_pool_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_pool_create(void)
+{
+    // object_size = 0 || slab_capacity = 0
+    assert(ctk_pool_create(0, 1) == NULL);
+    assert(ctk_pool_create(1, 0) == NULL);
+    // Slab size overflows
+    assert(ctk_pool_create(SIZE_MAX, 1) == NULL);
+    assert(ctk_pool_create(16, SIZE_MAX / 8) == NULL);
+    // Valid pool
+    struct ctk_pool * pool = ctk_pool_create(1, 1);
+    assert(pool != NULL);
+    ctk_pool_destroy(&pool);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_pool_destroy()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_pool_destroy(void)
+{
+    // NULL pointers
+    ctk_pool_destroy(NULL);
+    struct ctk_pool * pool = NULL;
+    ctk_pool_destroy(&pool);
+    // Objects still allocated in several slabs
+    pool = ctk_pool_create(32, 4);
+    assert(pool != NULL);
+    for(int i = 0; i < 20; i++) {
+        assert(ctk_pool_alloc(pool) != NULL);
+    }
+    ctk_pool_destroy(&pool);
+    assert(pool == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_pool_alloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_pool_alloc(void)
+{
+    // NULL pool
+    assert(ctk_pool_alloc(NULL) == NULL);
+    // Objects smaller than a pointer
+    struct ctk_pool * pool = ctk_pool_create(1, 8);
+    assert(pool != NULL);
+    char * small[16] = {NULL};
+    for(int i = 0; i < 16; i++) {
+        small[i] = ctk_pool_alloc(pool);
+        assert(small[i] != NULL);
+        *small[i] = (char)i;
+    }
+    for(int i = 0; i < 16; i++) {
+        assert(*small[i] == (char)i);
+    }
+    ctk_pool_destroy(&pool);
+    // Objects are distinct, aligned and contiguous within a slab
+    pool = ctk_pool_create(24, 4);
+    assert(pool != NULL);
+    unsigned char * objs[8] = {NULL};
+    for(int i = 0; i < 8; i++) {
+        objs[i] = ctk_pool_alloc(pool);
+        assert(objs[i] != NULL);
+        assert(IS_ALIGNED(objs[i], 8));
+        memset(objs[i], i, 24);
+    }
+    assert(objs[1] == objs[0] + 24);
+    assert(objs[3] == objs[0] + 72);
+    for(int i = 0; i < 8; i++) {
+        for(int j = 0; j < 24; j++) {
+            assert(objs[i][j] == i);
+        }
+    }
+    ctk_pool_destroy(&pool);
+    // Objects with a big alignment
+    pool = ctk_pool_create(48, 3);
+    assert(pool != NULL);
+    for(int i = 0; i < 10; i++) {
+        const void * const obj = ctk_pool_alloc(pool);
+        assert(obj != NULL && IS_ALIGNED(obj, 16));
+    }
+    ctk_pool_destroy(&pool);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_pool_calloc()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_pool_calloc(void)
+{
+    // NULL pool
+    assert(ctk_pool_calloc(NULL) == NULL);
+    // A recycled object is zeroed
+    struct ctk_pool * pool = ctk_pool_create(40, 2);
+    assert(pool != NULL);
+    unsigned char * obj = ctk_pool_alloc(pool);
+    assert(obj != NULL);
+    memset(obj, 0xFF, 40);
+    unsigned char * const addr = obj;
+    ctk_pool_free(pool, &obj);
+    obj = ctk_pool_calloc(pool);
+    assert(obj == addr);
+    for(int i = 0; i < 40; i++) {
+        assert(obj[i] == 0);
+    }
+    ctk_pool_destroy(&pool);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_pool_free()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_pool_free(void)
+{
+    struct ctk_pool * pool = ctk_pool_create(16, 4);
+    assert(pool != NULL);
+    // NULL pointers
+    (ctk_pool_free)(NULL, NULL);
+    (ctk_pool_free)(pool, NULL);
+    void * obj = NULL;
+    ctk_pool_free(pool, &obj);
+    assert(obj == NULL);
+    // Freed objects are reused in LIFO order
+    void * a = ctk_pool_alloc(pool);
+    void * b = ctk_pool_alloc(pool);
+    void * const a_addr = a;
+    void * const b_addr = b;
+    ctk_pool_free(pool, &a);
+    assert(a == NULL);
+    ctk_pool_free(pool, &b);
+    assert(b == NULL);
+    assert(ctk_pool_alloc(pool) == b_addr);
+    assert(ctk_pool_alloc(pool) == a_addr);
+    // Recycled objects are used before never used ones
+    void * c = ctk_pool_alloc(pool);
+    void * const c_addr = c;
+    ctk_pool_free(pool, &c);
+    assert(ctk_pool_alloc(pool) == c_addr);
+    ctk_pool_destroy(&pool);
+    printf("\t%s: OK\n", __func__);
+}
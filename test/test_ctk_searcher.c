@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_searcher.h"
+// The API to test
+#include "ctk_searcher.h"
+// C Standard Library
+#include <assert.h>
+#include <stddef.h> // NULL, ptrdiff_t, size_t
+#include <stdio.h>  // printf()
+#include <string.h> // memcpy()
+// Internal
+#include "ctk_string.h"
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Longest haystack of the comparisons with ctk_strpos_n(), several blocks of
+// 32 windows
+#define TEST_CTK_SEARCHER_HAY 100
+// Longest needle of the comparisons, past the Two-Way threshold
+#define TEST_CTK_SEARCHER_NEEDLE 40
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_searcher_fill(char * str, size_t length, unsigned * seed);
+static void TEST_ctk_searcher_count(void);
+static void TEST_ctk_searcher_count_n(void);
+static void TEST_ctk_searcher_create(void);
+static void TEST_ctk_searcher_create_n(void);
+static void TEST_ctk_searcher_destroy(void);
+static void TEST_ctk_searcher_pos(void);
+static void TEST_ctk_searcher_pos_n(void);
+static void TEST_ctk_searcher_rpos(void);
+static void TEST_ctk_searcher_rpos_n(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher()
+------------------------------------------------------------------------------*/
+void TEST_ctk_searcher(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_searcher_count();
+    TEST_ctk_searcher_count_n();
+    TEST_ctk_searcher_create();
+    TEST_ctk_searcher_create_n();
+    TEST_ctk_searcher_destroy();
+    TEST_ctk_searcher_pos();
+    TEST_ctk_searcher_pos_n();
+    TEST_ctk_searcher_rpos();
+    TEST_ctk_searcher_rpos_n();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_fill()
+------------------------------------------------------------------------------*/
+// Fills \p{str} with 'a' and 'b' from a linear congruential generator: two
+// letters make partial matches frequent
+static void TEST_ctk_searcher_fill(
+    char * const str, const size_t length, unsigned * const seed
+)
+{
+    for(size_t i = 0; i < length; i++) {
+        *seed = *seed * 1103515245u + 12345u;
+        str[i] = (char)('a' + ((*seed >> 16) & 1));
+    }
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_count()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_count(void)
+{
+    struct ctk_searcher * searcher = ctk_searcher_create("aa");
+    assert(searcher != NULL);
+    // Occurrences don't overlap
+    assert(ctk_searcher_count(searcher, "aaaaa") == 2);
+    assert(ctk_searcher_count(searcher, "aabaa") == 2);
+    assert(ctk_searcher_count(searcher, "a") == 0);
+    assert(ctk_searcher_count(searcher, "") == 0);
+    assert(ctk_searcher_count(NULL, "aa") == 0);
+    assert(ctk_searcher_count(searcher, NULL) == 0);
+    ctk_searcher_destroy(&searcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_count_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_count_n(void)
+{
+    char hay[TEST_CTK_SEARCHER_HAY];
+    char needle[TEST_CTK_SEARCHER_NEEDLE];
+    unsigned seed = 1;
+    for(size_t len = 1; len <= TEST_CTK_SEARCHER_NEEDLE; len++) {
+        TEST_ctk_searcher_fill(needle, len, &seed);
+        struct ctk_searcher * searcher = ctk_searcher_create_n(needle, len);
+        assert(searcher != NULL);
+        TEST_ctk_searcher_fill(hay, TEST_CTK_SEARCHER_HAY, &seed);
+        // Plant a few occurrences
+        for(size_t at = 0; at + len <= TEST_CTK_SEARCHER_HAY; at += 3 * len) {
+            memcpy(hay + at, needle, len);
+        }
+        size_t expected = 0;
+        for(size_t start = 0; start <= TEST_CTK_SEARCHER_HAY;) {
+            const ptrdiff_t pos = ctk_strpos_n(hay + start,
+                TEST_CTK_SEARCHER_HAY - start, needle, len);
+            if(pos < 0) {
+                break;
+            }
+            expected++;
+            start += (size_t)pos + len;
+        }
+        assert(ctk_searcher_count_n(searcher, hay, TEST_CTK_SEARCHER_HAY)
+            == expected);
+        ctk_searcher_destroy(&searcher);
+    }
+    struct ctk_searcher * searcher = ctk_searcher_create_n("\0", 1);
+    assert(searcher != NULL);
+    assert(ctk_searcher_count_n(searcher, "a\0b\0", 4) == 2);
+    assert(ctk_searcher_count_n(searcher, NULL, 0) == 0);
+    assert(ctk_searcher_count_n(searcher, NULL, 1) == 0);
+    ctk_searcher_destroy(&searcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_create(void)
+{
+    char needle[] = "needle";
+    struct ctk_searcher * searcher = ctk_searcher_create(needle);
+    assert(searcher != NULL);
+    // The needle is copied
+    needle[0] = 'x';
+    assert(ctk_searcher_pos(searcher, "haystack with a needle") == 16);
+    ctk_searcher_destroy(&searcher);
+    assert(ctk_searcher_create("") == NULL);
+    assert(ctk_searcher_create(NULL) == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_create_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_create_n(void)
+{
+    // Only the given length is searched for
+    struct ctk_searcher * searcher = ctk_searcher_create_n("needle", 4);
+    assert(searcher != NULL);
+    assert(ctk_searcher_pos(searcher, "a needless haystack") == 2);
+    assert(ctk_searcher_pos(searcher, "a neee") == -1);
+    ctk_searcher_destroy(&searcher);
+    assert(ctk_searcher_create_n("needle", 0) == NULL);
+    assert(ctk_searcher_create_n(NULL, 1) == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_destroy()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_destroy(void)
+{
+    // Short and long needles
+    const char * const needles[] = {
+        "a", "an example of a needle searched with Two-Way"
+    };
+    for(size_t i = 0; i < 2; i++) {
+        struct ctk_searcher * searcher = ctk_searcher_create(needles[i]);
+        assert(searcher != NULL);
+        ctk_searcher_destroy(&searcher);
+        assert(searcher == NULL);
+        ctk_searcher_destroy(&searcher);
+    }
+    ctk_searcher_destroy(NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_pos()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_pos(void)
+{
+    struct ctk_searcher * searcher = ctk_searcher_create("lo");
+    assert(searcher != NULL);
+    assert(ctk_searcher_pos(searcher, "Hello World! Hello World!") == 3);
+    assert(ctk_searcher_pos(searcher, "lo") == 0);
+    assert(ctk_searcher_pos(searcher, "l") == -1);
+    assert(ctk_searcher_pos(searcher, "") == -1);
+    // The terminating null character ends the string
+    assert(ctk_searcher_pos(searcher, "l\0lo") == -1);
+    assert(ctk_searcher_pos(NULL, "lo") == -1);
+    assert(ctk_searcher_pos(searcher, NULL) == -1);
+    ctk_searcher_destroy(&searcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_pos_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_pos_n(void)
+{
+    // Every needle length on both sides of the Two-Way threshold, every
+    // haystack length across several vector blocks
+    char hay[TEST_CTK_SEARCHER_HAY];
+    char needle[TEST_CTK_SEARCHER_NEEDLE];
+    unsigned seed = 2;
+    for(size_t len = 1; len <= TEST_CTK_SEARCHER_NEEDLE; len++) {
+        TEST_ctk_searcher_fill(needle, len, &seed);
+        struct ctk_searcher * searcher = ctk_searcher_create_n(needle, len);
+        assert(searcher != NULL);
+        for(size_t hay_len = 0; hay_len <= TEST_CTK_SEARCHER_HAY; hay_len++) {
+            TEST_ctk_searcher_fill(hay, hay_len, &seed);
+            // An occurrence near the end half of the time
+            if(hay_len >= len && hay_len % 2 == 0) {
+                const size_t room = hay_len - len;
+                memcpy(hay + room - room % 3, needle, len);
+            }
+            assert(ctk_searcher_pos_n(searcher, hay, hay_len)
+                == ctk_strpos_n(hay, hay_len, needle, len));
+        }
+        ctk_searcher_destroy(&searcher);
+    }
+    struct ctk_searcher * searcher = ctk_searcher_create_n("b\0", 2);
+    assert(searcher != NULL);
+    assert(ctk_searcher_pos_n(searcher, "a\0b\0", 4) == 2);
+    assert(ctk_searcher_pos_n(searcher, "a\0b\0", 3) == -1);
+    assert(ctk_searcher_pos_n(searcher, NULL, 0) == -1);
+    assert(ctk_searcher_pos_n(searcher, NULL, 1) == -1);
+    assert(ctk_searcher_pos_n(NULL, "b", 2) == -1);
+    ctk_searcher_destroy(&searcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_rpos()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_rpos(void)
+{
+    struct ctk_searcher * searcher = ctk_searcher_create("lo");
+    assert(searcher != NULL);
+    assert(ctk_searcher_rpos(searcher, "Hello World! Hello World!") == 16);
+    assert(ctk_searcher_rpos(searcher, "lo") == 0);
+    assert(ctk_searcher_rpos(searcher, "o") == -1);
+    assert(ctk_searcher_rpos(searcher, "") == -1);
+    assert(ctk_searcher_rpos(searcher, "lo\0lo") == 0);
+    assert(ctk_searcher_rpos(NULL, "lo") == -1);
+    assert(ctk_searcher_rpos(searcher, NULL) == -1);
+    ctk_searcher_destroy(&searcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_searcher_rpos_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_searcher_rpos_n(void)
+{
+    char hay[TEST_CTK_SEARCHER_HAY];
+    char needle[TEST_CTK_SEARCHER_NEEDLE];
+    unsigned seed = 3;
+    for(size_t len = 1; len <= TEST_CTK_SEARCHER_NEEDLE; len++) {
+        TEST_ctk_searcher_fill(needle, len, &seed);
+        struct ctk_searcher * searcher = ctk_searcher_create_n(needle, len);
+        assert(searcher != NULL);
+        for(size_t hay_len = 0; hay_len <= TEST_CTK_SEARCHER_HAY; hay_len++) {
+            TEST_ctk_searcher_fill(hay, hay_len, &seed);
+            // An occurrence near the start half of the time
+            if(hay_len >= len && hay_len % 2 == 0) {
+                memcpy(hay + (hay_len - len) % 3, needle, len);
+            }
+            assert(ctk_searcher_rpos_n(searcher, hay, hay_len)
+                == ctk_strrpos_n(hay, hay_len, needle, len));
+        }
+        ctk_searcher_destroy(&searcher);
+    }
+    struct ctk_searcher * searcher = ctk_searcher_create_n("\0b", 2);
+    assert(searcher != NULL);
+    assert(ctk_searcher_rpos_n(searcher, "\0b\0b", 4) == 2);
+    assert(ctk_searcher_rpos_n(searcher, "\0b\0b", 3) == 0);
+    assert(ctk_searcher_rpos_n(searcher, NULL, 0) == -1);
+    assert(ctk_searcher_rpos_n(searcher, NULL, 1) == -1);
+    assert(ctk_searcher_rpos_n(NULL, "\0b", 2) == -1);
+    ctk_searcher_destroy(&searcher);
+    printf("\t%s: OK\n", __func__);
+}
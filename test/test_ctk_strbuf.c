@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_strbuf.h"
+// The API to test
+#include "ctk_strbuf.h"
+// C Standard Library
+#include <assert.h>
+#include <stdint.h> // INTMAX_MAX, INTMAX_MIN, SIZE_MAX, UINTMAX_MAX
+#include <stdio.h>  // printf(), snprintf()
+#include <string.h> // memcmp(), strcat(), strcmp()
+// Internal
+#include "ctk_alloc.h"
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_strbuf_create(void);
+static void TEST_ctk_strbuf_reserve(void);
+static void TEST_ctk_strbuf_shrink(void);
+static void TEST_ctk_strbuf_append(void);
+static void TEST_ctk_strbuf_append_n(void);
+static void TEST_ctk_strbuf_append_char(void);
+static void TEST_ctk_strbuf_append_int(void);
+static void TEST_ctk_strbuf_steal(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf()
+------------------------------------------------------------------------------*/
+void TEST_ctk_strbuf(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_strbuf_create();
+    TEST_ctk_strbuf_reserve();
+    TEST_ctk_strbuf_shrink();
+    TEST_ctk_strbuf_append();
+    TEST_ctk_strbuf_append_n();
+    TEST_ctk_strbuf_append_char();
+    TEST_ctk_strbuf_append_int();
+    TEST_ctk_strbuf_steal();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_create(void)
+{
+    // Capacity overflows
+    assert(ctk_strbuf_create(SIZE_MAX) == NULL);
+    // No capacity
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    assert(strcmp(ctk_strbuf_data(buf), "") == 0);
+    assert(ctk_strbuf_length(buf) == 0);
+    assert(ctk_strbuf_capacity(buf) == 0);
+    ctk_strbuf_destroy(&buf);
+    assert(buf == NULL);
+    // Reserved capacity
+    buf = ctk_strbuf_create(100);
+    assert(buf != NULL);
+    assert(strcmp(ctk_strbuf_data(buf), "") == 0);
+    assert(ctk_strbuf_capacity(buf) == 100);
+    ctk_strbuf_destroy(&buf);
+    // NULL
+    ctk_strbuf_destroy(NULL);
+    ctk_strbuf_destroy(&buf);
+    assert(ctk_strbuf_data(NULL) == NULL);
+    assert(ctk_strbuf_length(NULL) == 0);
+    assert(ctk_strbuf_capacity(NULL) == 0);
+    ctk_strbuf_clear(NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_reserve()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_reserve(void)
+{
+    assert(ctk_strbuf_reserve(NULL, 1) == -1);
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    // Nothing to reserve
+    assert(ctk_strbuf_reserve(buf, 0) == 0);
+    assert(ctk_strbuf_capacity(buf) == 0);
+    // Exact request bigger than the doubled capacity
+    assert(ctk_strbuf_reserve(buf, 1000) == 0);
+    assert(ctk_strbuf_capacity(buf) == 1000);
+    // Already enough room
+    assert(ctk_strbuf_reserve(buf, 1000) == 0);
+    assert(ctk_strbuf_capacity(buf) == 1000);
+    // Geometric growth
+    assert(ctk_strbuf_append_char(buf, 'a') == 0);
+    assert(ctk_strbuf_reserve(buf, 1000) == 0);
+    assert(ctk_strbuf_capacity(buf) == 2000);
+    assert(strcmp(ctk_strbuf_data(buf), "a") == 0);
+    // Overflow
+    assert(ctk_strbuf_reserve(buf, SIZE_MAX) == -1);
+    assert(ctk_strbuf_reserve(buf, SIZE_MAX - 1) == -1);
+    assert(ctk_strbuf_capacity(buf) == 2000);
+    assert(strcmp(ctk_strbuf_data(buf), "a") == 0);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_shrink()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_shrink(void)
+{
+    assert(ctk_strbuf_shrink(NULL) == -1);
+    // Without content
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    assert(ctk_strbuf_shrink(buf) == 0);
+    assert(ctk_strbuf_capacity(buf) == 0);
+    // With content
+    assert(ctk_strbuf_reserve(buf, 64) == 0);
+    assert(ctk_strbuf_append(buf, "abc") == 0);
+    assert(ctk_strbuf_shrink(buf) == 0);
+    assert(ctk_strbuf_capacity(buf) == 3);
+    assert(strcmp(ctk_strbuf_data(buf), "abc") == 0);
+    // Cleared content
+    ctk_strbuf_clear(buf);
+    assert(ctk_strbuf_length(buf) == 0);
+    assert(ctk_strbuf_capacity(buf) == 3);
+    assert(ctk_strbuf_shrink(buf) == 0);
+    assert(ctk_strbuf_capacity(buf) == 0);
+    assert(strcmp(ctk_strbuf_data(buf), "") == 0);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_append()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_append(void)
+{
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    // NULL
+    assert(ctk_strbuf_append(NULL, "a") == -1);
+    assert(ctk_strbuf_append(buf, NULL) == -1);
+    // Empty string
+    assert(ctk_strbuf_append(buf, "") == 0);
+    assert(ctk_strbuf_length(buf) == 0);
+    // Many appends
+    char expected[1024] = "";
+    for(size_t i = 0; i < 100; i++) {
+        assert(ctk_strbuf_append(buf, "0123456789") == 0);
+        strcat(expected, "0123456789");
+        assert(strcmp(ctk_strbuf_data(buf), expected) == 0);
+        assert(ctk_strbuf_length(buf) == (i + 1) * 10);
+        assert(ctk_strbuf_capacity(buf) >= ctk_strbuf_length(buf));
+    }
+    // Growth is geometric: 16, 32, ..., 1024
+    assert(ctk_strbuf_capacity(buf) == 1024);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_append_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_append_n(void)
+{
+    struct ctk_strbuf * buf = ctk_strbuf_create(4);
+    assert(buf != NULL);
+    // NULL
+    assert(ctk_strbuf_append_n(NULL, "a", 1) == -1);
+    assert(ctk_strbuf_append_n(buf, NULL, 1) == -1);
+    assert(ctk_strbuf_append_n(buf, NULL, 0) == 0);
+    // Not null-terminated
+    const char bytes[] = {'a', 'b', 'c'};
+    assert(ctk_strbuf_append_n(buf, bytes, 2) == 0);
+    assert(strcmp(ctk_strbuf_data(buf), "ab") == 0);
+    // Null characters
+    assert(ctk_strbuf_append_n(buf, "\0x\0", 3) == 0);
+    assert(ctk_strbuf_length(buf) == 5);
+    assert(memcmp(ctk_strbuf_data(buf), "ab\0x\0", 6) == 0);
+    // Unchanged on failure
+    assert(ctk_strbuf_append_n(buf, bytes, SIZE_MAX) == -1);
+    assert(ctk_strbuf_length(buf) == 5);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_append_char()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_append_char(void)
+{
+    assert(ctk_strbuf_append_char(NULL, 'a') == -1);
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    for(int i = 0; i < 26; i++) {
+        assert(ctk_strbuf_append_char(buf, (char)('a' + i)) == 0);
+    }
+    assert(strcmp(ctk_strbuf_data(buf), "abcdefghijklmnopqrstuvwxyz") == 0);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_append_int()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_append_int(void)
+{
+    assert(ctk_strbuf_append_int(NULL, 1) == -1);
+    assert(ctk_strbuf_append_uint(NULL, 1) == -1);
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    const intmax_t ints[] = {
+        0, 1, -1, 9, 10, -10, 12345, -67890, INTMAX_MAX, INTMAX_MIN
+    };
+    char expected[64];
+    for(size_t i = 0; i < sizeof(ints) / sizeof(ints[0]); i++) {
+        ctk_strbuf_clear(buf);
+        assert(ctk_strbuf_append_int(buf, ints[i]) == 0);
+        snprintf(expected, sizeof(expected), "%jd", ints[i]);
+        assert(strcmp(ctk_strbuf_data(buf), expected) == 0);
+    }
+    const uintmax_t uints[] = {0, 7, 100, UINTMAX_MAX};
+    for(size_t i = 0; i < sizeof(uints) / sizeof(uints[0]); i++) {
+        ctk_strbuf_clear(buf);
+        assert(ctk_strbuf_append_uint(buf, uints[i]) == 0);
+        snprintf(expected, sizeof(expected), "%ju", uints[i]);
+        assert(strcmp(ctk_strbuf_data(buf), expected) == 0);
+    }
+    // Appended after existing content
+    ctk_strbuf_clear(buf);
+    assert(ctk_strbuf_append(buf, "x=") == 0);
+    assert(ctk_strbuf_append_int(buf, -42) == 0);
+    assert(strcmp(ctk_strbuf_data(buf), "x=-42") == 0);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strbuf_steal()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strbuf_steal(void)
+{
+    assert(ctk_strbuf_steal(NULL, NULL) == NULL);
+    struct ctk_strbuf * buf = ctk_strbuf_create(0);
+    assert(buf != NULL);
+    // Empty buffer without capacity
+    size_t length = 1;
+    char * str = ctk_strbuf_steal(buf, &length);
+    assert(str != NULL);
+    assert(strcmp(str, "") == 0);
+    assert(length == 0);
+    ctk_free(&str);
+    // Content is handed off without a copy
+    assert(ctk_strbuf_append(buf, "abc") == 0);
+    const char * const data = ctk_strbuf_data(buf);
+    str = ctk_strbuf_steal(buf, &length);
+    assert(str == data);
+    assert(strcmp(str, "abc") == 0);
+    assert(length == 3);
+    // The buffer is empty and can be reused
+    assert(ctk_strbuf_length(buf) == 0);
+    assert(ctk_strbuf_capacity(buf) == 0);
+    assert(strcmp(ctk_strbuf_data(buf), "") == 0);
+    assert(ctk_strbuf_append(buf, "de") == 0);
+    assert(strcmp(ctk_strbuf_data(buf), "de") == 0);
+    assert(strcmp(str, "abc") == 0);
+    ctk_free(&str);
+    // Without length
+    str = ctk_strbuf_steal(buf, NULL);
+    assert(strcmp(str, "de") == 0);
+    ctk_free(&str);
+    ctk_strbuf_destroy(&buf);
+    printf("\t%s: OK\n", __func__);
+}
@@ -28,28 +28,76 @@
 #include "ctk_string.h"
 // C Standard Library
 #include <assert.h>
-#include <ctype.h>  // tolower(), toupper()
+#include <ctype.h>  // isalpha(), tolower(), toupper()
 #include <errno.h>
 #include <limits.h> // INT_MAX, UCHAR_MAX
+#include <stdint.h> // UINT64_C, uint64_t
 #include <stdio.h>  // EOF, printf()
-#include <string.h> // NULL, strcmp(), strerror()
+#include <string.h> // NULL, memcmp(), memcpy(), memset(), strcmp(), strerror(),
+                    // strlen()
 /*==============================================================================
     MACRO
 ==============================================================================*/
+// Fills \p{buf} with \p{len} pseudo-random bytes
+#define TEST_CTK_HASH_FILL(buf, len) \
+    for(size_t fill_i = 0, fill_x = 1; fill_i < (len); fill_i++) { \
+        fill_x = fill_x * 1103515245 + 12345; \
+        (buf)[fill_i] = (unsigned char)(fill_x >> 16); \
+    }
+// Fills \p{buf} with \p{len} characters from "aAbB" picked by the state
+// \p{x}, many windows of a search then match on their first and last ones
+#define TEST_CTK_STRCASE_FILL(buf, len, x) \
+    for(size_t fill_i = 0; fill_i < (len); fill_i++) { \
+        (x) = (x) * 1103515245 + 12345; \
+        (buf)[fill_i] = "aAbB"[((x) >> 16) & 3]; \
+    }
 /*==============================================================================
     FUNCTION DECLARATION
 ==============================================================================*/
+static void TEST_ctk_hash(void);
+static void TEST_ctk_hash_final(void);
+static void TEST_ctk_hash_init(void);
+static void TEST_ctk_hash_n(void);
+static void TEST_ctk_hash_seeded(void);
+static void TEST_ctk_hash_seeded_n(void);
+static void TEST_ctk_hash_update(void);
 static void TEST_ctk_stpcpy(void);
 static void TEST_ctk_stpncpy(void);
+static void TEST_ctk_strcaseeq(void);
+static void TEST_ctk_strcaseeq_n(void);
+static void TEST_ctk_strcasepos(void);
+static void TEST_ctk_strcasepos_n(void);
+static void TEST_ctk_strcaseprefix(void);
+static void TEST_ctk_strcaseprefix_n(void);
+static void TEST_ctk_strcaserpos(void);
+static void TEST_ctk_strcaserpos_n(void);
 static void TEST_ctk_strerror_r(void);
 static void TEST_ctk_strpos(void);
+static void TEST_ctk_strpos_n(void);
+static ptrdiff_t TEST_ctk_strpos_naive(
+    const char * hay, size_t length, const char * needle, size_t needle_len
+);
 static void TEST_ctk_strrpos(void);
+static void TEST_ctk_strrpos_n(void);
+static ptrdiff_t TEST_ctk_strrpos_naive(
+    const char * hay, size_t length, const char * needle, size_t needle_len
+);
 static void TEST_ctk_strrstr(void);
+static void TEST_ctk_strrstr_n(void);
 static void TEST_ctk_strtolower(void);
+static void TEST_ctk_strtolower_locale(void);
+static void TEST_ctk_strtolower_locale_n(void);
+static void TEST_ctk_strtolower_n(void);
 static void TEST_ctk_strtoupper(void);
+static void TEST_ctk_strtoupper_locale(void);
+static void TEST_ctk_strtoupper_locale_n(void);
+static void TEST_ctk_strtoupper_n(void);
 static void TEST_ctk_strtrim(void);
+static void TEST_ctk_strtrim_n(void);
 static void TEST_ctk_strtriml(void);
+static void TEST_ctk_strtriml_n(void);
 static void TEST_ctk_strtrimr(void);
+static void TEST_ctk_strtrimr_n(void);
 static void TEST_ctk_tolower(void);
 static void TEST_ctk_toupper(void);
 /*==============================================================================
@@ -61,20 +109,226 @@ static void TEST_ctk_toupper(void);
 void TEST_ctk_string(void)
 {
     printf("%s:\n", __func__);
+    TEST_ctk_hash();
+    TEST_ctk_hash_final();
+    TEST_ctk_hash_init();
+    TEST_ctk_hash_n();
+    TEST_ctk_hash_seeded();
+    TEST_ctk_hash_seeded_n();
+    TEST_ctk_hash_update();
     TEST_ctk_stpcpy();
     TEST_ctk_stpncpy();
+    TEST_ctk_strcaseeq();
+    TEST_ctk_strcaseeq_n();
+    TEST_ctk_strcasepos();
+    TEST_ctk_strcasepos_n();
+    TEST_ctk_strcaseprefix();
+    TEST_ctk_strcaseprefix_n();
+    TEST_ctk_strcaserpos();
+    TEST_ctk_strcaserpos_n();
     TEST_ctk_strerror_r();
     TEST_ctk_strpos();
+    TEST_ctk_strpos_n();
     TEST_ctk_strrpos();
+    TEST_ctk_strrpos_n();
     TEST_ctk_strrstr();
+    TEST_ctk_strrstr_n();
     TEST_ctk_strtolower();
+    TEST_ctk_strtolower_locale();
+    TEST_ctk_strtolower_locale_n();
+    TEST_ctk_strtolower_n();
     TEST_ctk_strtoupper();
+    TEST_ctk_strtoupper_locale();
+    TEST_ctk_strtoupper_locale_n();
+    TEST_ctk_strtoupper_n();
     TEST_ctk_strtrim();
+    TEST_ctk_strtrim_n();
     TEST_ctk_strtriml();
+    TEST_ctk_strtriml_n();
     TEST_ctk_strtrimr();
+    TEST_ctk_strtrimr_n();
     TEST_ctk_tolower();
     TEST_ctk_toupper();
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash(void)
+{
+    // Str is NULL
+    assert(ctk_hash(NULL) == 0);
+    // Known values, which don't depend on the platform nor on the kernel
+    assert(ctk_hash("") == UINT64_C(0x498ae899c2548f82));
+    assert(ctk_hash("a") == UINT64_C(0x0c3738aa8cd28184));
+    assert(ctk_hash("abc") == UINT64_C(0xd54241b48cd6d458));
+    assert(ctk_hash("message digest") == UINT64_C(0x6272f08c972b5af2));
+    assert(
+        ctk_hash("abcdefghijklmnopqrstuvwxyz0123456789")
+        == UINT64_C(0x91d9834d55068bdd)
+    );
+    // Same as ctk_hash_n() on the length of the string
+    const char * const strs[] = {"", "a", "ab", "abcd", "0123456789abcdef"};
+    for(size_t i = 0; i < sizeof(strs) / sizeof(strs[0]); i++) {
+        assert(ctk_hash(strs[i]) == ctk_hash_n(strs[i], strlen(strs[i])));
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash_final()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash_final(void)
+{
+    // State is NULL
+    assert(ctk_hash_final(NULL) == 0);
+    // Chunks of any size give the one-shot value, around the buffer size and
+    // the 16-stripe blocks
+    static unsigned char bytes[1200];
+    TEST_CTK_HASH_FILL(bytes, sizeof(bytes));
+    const size_t chunks[] = {1, 7, 31, 32, 33, 255, 256, 257, 1200};
+    const uint64_t seed = UINT64_C(0x0123456789ABCDEF);
+    for(size_t length = 0; length <= sizeof(bytes); length++) {
+        const uint64_t expected = ctk_hash_seeded_n(bytes, length, seed);
+        for(size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+            struct ctk_hash_state state;
+            ctk_hash_init(&state, seed);
+            for(size_t done = 0; done < length; done += chunks[c]) {
+                const size_t left = length - done;
+                const size_t chunk = left < chunks[c] ? left : chunks[c];
+                assert(ctk_hash_update(&state, bytes + done, chunk) == 0);
+            }
+            assert(ctk_hash_final(&state) == expected);
+        }
+    }
+    // Doesn't modify the state
+    struct ctk_hash_state state;
+    ctk_hash_init(&state, 0);
+    assert(ctk_hash_update(&state, bytes, 300) == 0);
+    assert(ctk_hash_final(&state) == ctk_hash_n(bytes, 300));
+    assert(ctk_hash_final(&state) == ctk_hash_n(bytes, 300));
+    assert(ctk_hash_update(&state, bytes + 300, 500) == 0);
+    assert(ctk_hash_final(&state) == ctk_hash_n(bytes, 800));
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash_init()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash_init(void)
+{
+    // State is NULL
+    ctk_hash_init(NULL, 0);
+    // Nothing hashed yet
+    struct ctk_hash_state state;
+    ctk_hash_init(&state, 0);
+    assert(ctk_hash_final(&state) == ctk_hash(""));
+    ctk_hash_init(&state, 42);
+    assert(ctk_hash_final(&state) == ctk_hash_seeded("", 42));
+    // Reinitializing discards the previous bytes
+    assert(ctk_hash_update(&state, "abc", 3) == 0);
+    ctk_hash_init(&state, 0);
+    assert(ctk_hash_update(&state, "a", 1) == 0);
+    assert(ctk_hash_final(&state) == ctk_hash("a"));
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash_n(void)
+{
+    // Data is NULL
+    assert(ctk_hash_n(NULL, 0) == ctk_hash(""));
+    assert(ctk_hash_n(NULL, 1) == 0);
+    // Known value of the bulk loop
+    static unsigned char bytes[1000];
+    for(size_t i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = (unsigned char)('a' + i % 26);
+    }
+    assert(ctk_hash_n(bytes, sizeof(bytes)) == UINT64_C(0xdedab61de560db9e));
+    // Null characters are hashed
+    assert(ctk_hash_n("a\0b", 3) != ctk_hash_n("a\0c", 3));
+    assert(ctk_hash_n("\0", 1) != ctk_hash_n("\0\0", 2));
+    // Every prefix has a different hash, and flipping any bit of it changes
+    // the hash by about 32 bits
+    TEST_CTK_HASH_FILL(bytes, sizeof(bytes));
+    size_t flips = 0;
+    size_t changed = 0;
+    for(size_t length = 0; length <= 300; length++) {
+        const uint64_t hash = ctk_hash_n(bytes, length);
+        if(length > 0) {
+            assert(hash != ctk_hash_n(bytes, length - 1));
+        }
+        for(size_t bit = 0; bit < length * CHAR_BIT; bit++) {
+            bytes[bit / CHAR_BIT] ^= (unsigned char)(1U << bit % CHAR_BIT);
+            uint64_t diff = hash ^ ctk_hash_n(bytes, length);
+            bytes[bit / CHAR_BIT] ^= (unsigned char)(1U << bit % CHAR_BIT);
+            assert(diff != 0);
+            for(; diff != 0; diff &= diff - 1) {
+                changed++;
+            }
+            flips++;
+        }
+    }
+    assert(changed > flips * 31 && changed < flips * 33);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash_seeded()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash_seeded(void)
+{
+    // Str is NULL
+    assert(ctk_hash_seeded(NULL, 42) == 0);
+    // Known values
+    assert(ctk_hash_seeded("", 42) == UINT64_C(0x394a9d6e19149ffc));
+    assert(ctk_hash_seeded("abc", 42) == UINT64_C(0xe7d7704347adfad3));
+    // Seed 0 is the unseeded hash
+    assert(ctk_hash_seeded("abc", 0) == ctk_hash("abc"));
+    // Same as ctk_hash_seeded_n() on the length of the string
+    assert(ctk_hash_seeded("abc", 7) == ctk_hash_seeded_n("abc", 3, 7));
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash_seeded_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash_seeded_n(void)
+{
+    // Data is NULL
+    assert(ctk_hash_seeded_n(NULL, 0, 42) == ctk_hash_seeded("", 42));
+    assert(ctk_hash_seeded_n(NULL, 1, 42) == 0);
+    // Seed 0 is the unseeded hash, and every seed bit changes the hash of
+    // short, medium and long inputs
+    static unsigned char bytes[500];
+    TEST_CTK_HASH_FILL(bytes, sizeof(bytes));
+    const size_t lengths[] = {0, 3, 8, 16, 17, 64, 128, 129, 500};
+    for(size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        const uint64_t hash = ctk_hash_seeded_n(bytes, lengths[i], 0);
+        assert(hash == ctk_hash_n(bytes, lengths[i]));
+        for(unsigned bit = 0; bit < 64; bit++) {
+            const uint64_t seed = UINT64_C(1) << bit;
+            assert(ctk_hash_seeded_n(bytes, lengths[i], seed) != hash);
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_hash_update()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_hash_update(void)
+{
+    struct ctk_hash_state state;
+    ctk_hash_init(&state, 0);
+    // State is NULL
+    assert(ctk_hash_update(NULL, "a", 1) == -1);
+    // Data is NULL
+    assert(ctk_hash_update(&state, NULL, 1) == -1);
+    assert(ctk_hash_update(&state, NULL, 0) == 0);
+    assert(ctk_hash_final(&state) == ctk_hash(""));
+    // Empty chunks don't change the hash
+    assert(ctk_hash_update(&state, "ab", 2) == 0);
+    assert(ctk_hash_update(&state, "", 0) == 0);
+    assert(ctk_hash_update(&state, "c", 1) == 0);
+    assert(ctk_hash_final(&state) == ctk_hash("abc"));
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_stpcpy()
 ------------------------------------------------------------------------------*/
@@ -159,6 +413,284 @@ static void TEST_ctk_stpncpy(void)
     }
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcaseeq()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcaseeq(void)
+{
+    // Strings are NULL
+    assert(ctk_strcaseeq(NULL, "") == false);
+    assert(ctk_strcaseeq("", NULL) == false);
+    // Strings are empty
+    assert(ctk_strcaseeq("", "") == true);
+    // Strings differ only by their case
+    assert(ctk_strcaseeq("Content-Length", "content-LENGTH") == true);
+    // One string is a prefix of the other
+    assert(ctk_strcaseeq("Content", "content-length") == false);
+    assert(ctk_strcaseeq("Content-Length", "content") == false);
+    // Characters next to the letters aren't folded
+    assert(ctk_strcaseeq("@[`{", "`{@[") == false);
+    // Bytes >= 0x80 aren't folded
+    assert(ctk_strcaseeq("\xC9", "\xE9") == false);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcaseeq_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcaseeq_n(void)
+{
+    // Arrays are NULL
+    assert(ctk_strcaseeq_n(NULL, 0, "", 0) == false);
+    assert(ctk_strcaseeq_n("", 0, NULL, 0) == false);
+    // Arrays are empty
+    assert(ctk_strcaseeq_n("", 0, "", 0) == true);
+    // Arrays have different lengths
+    assert(ctk_strcaseeq_n("Host", 4, "host:", 5) == false);
+    // Arrays contain null characters
+    assert(ctk_strcaseeq_n("A\0b", 3, "a\0B", 3) == true);
+    assert(ctk_strcaseeq_n("A\0b", 3, "a\0C", 3) == false);
+    // Every byte value, at every position of the vector, SWAR and byte loops
+    char lhs[40];
+    char rhs[40];
+    for(size_t length = 1; length <= sizeof(lhs); length++) {
+        for(size_t i = 0; i < length; i++) {
+            memset(lhs, 'x', length);
+            memset(rhs, 'X', length);
+            for(int c = 0; c <= UCHAR_MAX; c++) {
+                lhs[i] = (char)c;
+                rhs[i] = (char)toupper(c);
+                assert(ctk_strcaseeq_n(lhs, length, rhs, length) == true);
+                rhs[i] = (char)(c ^ 0x20);
+                assert(ctk_strcaseeq_n(lhs, length, rhs, length)
+                    == (isalpha(c) != 0));
+            }
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcasepos()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcasepos(void)
+{
+    // Haystack and needle are NULL
+    assert(ctk_strcasepos(NULL, NULL) == -1);
+    assert(ctk_strcasepos(NULL, "") == -1);
+    assert(ctk_strcasepos("", NULL) == -1);
+    // Haystack and needle are empty
+    assert(ctk_strcasepos("", "") == 0);
+    // Needle is empty
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "") == 0);
+    // Haystack is empty
+    assert(ctk_strcasepos("", ">X,3?in.a{g>>qRc") == -1);
+    // Needle matches exactly
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "in.a{g>") == 5);
+    // Needle matches with a different case
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "IN.A{G>") == 5);
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "x,3") == 1);
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "QrC") == 13);
+    // First of several matches
+    assert(ctk_strcasepos("aBcAbCabc", "ABC") == 0);
+    // Punctuation next to the letters doesn't match them
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "[G>") == -1);
+    // Needle is at the end of haystack but has one char too many
+    assert(ctk_strcasepos(">X,3?in.a{g>>qRc", "{g>>qRcX") == -1);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcasepos_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcasepos_n(void)
+{
+    // Haystack is NULL
+    assert(ctk_strcasepos_n(NULL, 0, "", 0) == -1);
+    // Needle is NULL
+    assert(ctk_strcasepos_n("", 0, NULL, 0) == -1);
+    // Haystack and needle are empty
+    assert(ctk_strcasepos_n("", 0, "", 0) == 0);
+    // Needle is past the length of haystack
+    assert(ctk_strcasepos_n(">X,3?in.a{g>>qRc", 8, "A{G", 3) == -1);
+    // Needle ends exactly at the length of haystack
+    assert(ctk_strcasepos_n(">X,3?in.a{g>>qRc", 11, "A{G", 3) == 8);
+    // Haystack and needle contain null characters
+    assert(ctk_strcasepos_n("ab\0cd\0ef", 8, "\0EF", 3) == 5);
+    // Same result as an exact search of lowercase copies
+    char hay[100];
+    char needle[40];
+    char hay_lower[sizeof(hay)];
+    char needle_lower[sizeof(needle)];
+    size_t x = 1;
+    for(size_t needle_len = 1; needle_len <= sizeof(needle); needle_len++) {
+        for(size_t length = 0; length <= sizeof(hay); length++) {
+            TEST_CTK_STRCASE_FILL(hay, length, x);
+            TEST_CTK_STRCASE_FILL(needle, needle_len, x);
+            memcpy(hay_lower, hay, length);
+            memcpy(needle_lower, needle, needle_len);
+            ctk_strtolower_n(hay_lower, length);
+            ctk_strtolower_n(needle_lower, needle_len);
+            assert(ctk_strcasepos_n(hay, length, needle, needle_len)
+                == ctk_strpos_n(hay_lower, length, needle_lower, needle_len));
+        }
+    }
+    // Nearly every window matches on its first and last characters: the
+    // search switches to Two-Way
+    char many[4096];
+    char many_lower[sizeof(many)];
+    for(size_t needle_len = 3; needle_len <= sizeof(needle); needle_len++) {
+        TEST_CTK_STRCASE_FILL(many, sizeof(many), x);
+        // 'b' and 'B' become 'a' and 'A'
+        for(size_t i = 0; i < sizeof(many); i++) {
+            many[i] = (char)((many[i] & ~0x03) | 0x01);
+        }
+        memset(needle, 'A', needle_len);
+        needle[x % (needle_len - 2) + 1] = 'b';
+        // The only 'b' of the haystack, cut by the shortest lengths
+        memcpy(many + sizeof(many) - needle_len - 5, needle, needle_len);
+        memcpy(many_lower, many, sizeof(many));
+        memcpy(needle_lower, needle, needle_len);
+        ctk_strtolower_n(many_lower, sizeof(many));
+        ctk_strtolower_n(needle_lower, needle_len);
+        for(size_t length = sizeof(many) - 16; length <= sizeof(many);
+            length++) {
+            assert(ctk_strcasepos_n(many, length, needle, needle_len)
+                == ctk_strpos_n(many_lower, length, needle_lower, needle_len));
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcaseprefix()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcaseprefix(void)
+{
+    // Strings are NULL
+    assert(ctk_strcaseprefix(NULL, "") == false);
+    assert(ctk_strcaseprefix("", NULL) == false);
+    // Prefix is empty
+    assert(ctk_strcaseprefix("", "") == true);
+    assert(ctk_strcaseprefix("Host", "") == true);
+    // Prefix differs only by its case
+    assert(ctk_strcaseprefix("HOST: example.org", "host:") == true);
+    // Prefix is the whole string
+    assert(ctk_strcaseprefix("Host", "hOST") == true);
+    // Prefix is longer than the string
+    assert(ctk_strcaseprefix("Host", "host:") == false);
+    // Prefix differs
+    assert(ctk_strcaseprefix("Hist: example.org", "host:") == false);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcaseprefix_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcaseprefix_n(void)
+{
+    // Arrays are NULL
+    assert(ctk_strcaseprefix_n(NULL, 0, "", 0) == false);
+    assert(ctk_strcaseprefix_n("", 0, NULL, 0) == false);
+    // Prefix is empty
+    assert(ctk_strcaseprefix_n("Host", 4, "", 0) == true);
+    // Prefix differs only by its case
+    assert(ctk_strcaseprefix_n("HOST: example.org", 17, "host:", 5) == true);
+    // Prefix is longer than the given length
+    assert(ctk_strcaseprefix_n("HOST: example.org", 4, "host:", 5) == false);
+    // Arrays contain null characters
+    assert(ctk_strcaseprefix_n("A\0bc", 4, "a\0B", 3) == true);
+    // Prefix longer than a vector
+    const char * const line = "Content-Security-Policy-Report-Only: none";
+    assert(ctk_strcaseprefix_n(
+        line, strlen(line), "content-security-policy-report-only:", 36
+    ) == true);
+    assert(ctk_strcaseprefix_n(
+        line, strlen(line), "content-security-policy-report-only;", 36
+    ) == false);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcaserpos()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcaserpos(void)
+{
+    // Haystack and needle are NULL
+    assert(ctk_strcaserpos(NULL, NULL) == -1);
+    assert(ctk_strcaserpos(NULL, "") == -1);
+    assert(ctk_strcaserpos("", NULL) == -1);
+    // Haystack and needle are empty
+    assert(ctk_strcaserpos("", "") == 0);
+    // Needle is empty
+    assert(ctk_strcaserpos(">X,3?in.a{g>>qRc", "") == 0);
+    // Haystack is empty
+    assert(ctk_strcaserpos("", ">X,3?in.a{g>>qRc") == -1);
+    // Needle matches with a different case
+    assert(ctk_strcaserpos(">X,3?in.a{g>>qRc", "IN.A{G>") == 5);
+    // Last of several matches
+    assert(ctk_strcaserpos("aBcAbCabc", "ABC") == 6);
+    assert(ctk_strcaserpos("aBcAbCab", "ABC") == 3);
+    // Punctuation next to the letters doesn't match them
+    assert(ctk_strcaserpos(">X,3?in.a{g>>qRc", "[G>") == -1);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strcaserpos_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strcaserpos_n(void)
+{
+    // Haystack is NULL
+    assert(ctk_strcaserpos_n(NULL, 0, "", 0) == -1);
+    // Needle is NULL
+    assert(ctk_strcaserpos_n("", 0, NULL, 0) == -1);
+    // Haystack and needle are empty
+    assert(ctk_strcaserpos_n("", 0, "", 0) == 0);
+    // Last needle is past the length of haystack
+    assert(ctk_strcaserpos_n(">X,3?in.3?I>3?Ic", 14, "3?i", 3) == 8);
+    // Haystack and needle contain null characters
+    assert(ctk_strcaserpos_n("a\0ba\0bc", 7, "A\0B", 3) == 3);
+    // Same result as an exact search of lowercase copies
+    char hay[100];
+    char needle[40];
+    char hay_lower[sizeof(hay)];
+    char needle_lower[sizeof(needle)];
+    size_t x = 1;
+    for(size_t needle_len = 1; needle_len <= sizeof(needle); needle_len++) {
+        for(size_t length = 0; length <= sizeof(hay); length++) {
+            TEST_CTK_STRCASE_FILL(hay, length, x);
+            TEST_CTK_STRCASE_FILL(needle, needle_len, x);
+            memcpy(hay_lower, hay, length);
+            memcpy(needle_lower, needle, needle_len);
+            ctk_strtolower_n(hay_lower, length);
+            ctk_strtolower_n(needle_lower, needle_len);
+            assert(ctk_strcaserpos_n(hay, length, needle, needle_len)
+                == ctk_strrpos_n(hay_lower, length, needle_lower, needle_len));
+        }
+    }
+    // Nearly every window matches on its first and last characters: the
+    // search switches to Two-Way
+    char many[4096];
+    char many_lower[sizeof(many)];
+    for(size_t needle_len = 3; needle_len <= sizeof(needle); needle_len++) {
+        TEST_CTK_STRCASE_FILL(many, sizeof(many), x);
+        // 'b' and 'B' become 'a' and 'A'
+        for(size_t i = 0; i < sizeof(many); i++) {
+            many[i] = (char)((many[i] & ~0x03) | 0x01);
+        }
+        memset(needle, 'A', needle_len);
+        needle[x % (needle_len - 2) + 1] = 'b';
+        // The only 'b' of the haystack, cut by the largest offsets
+        memcpy(many + 5, needle, needle_len);
+        memcpy(many_lower, many, sizeof(many));
+        memcpy(needle_lower, needle, needle_len);
+        ctk_strtolower_n(many_lower, sizeof(many));
+        ctk_strtolower_n(needle_lower, needle_len);
+        for(size_t offset = 0; offset <= 16; offset++) {
+            assert(ctk_strcaserpos_n(
+                many + offset, sizeof(many) - offset, needle, needle_len
+            ) == ctk_strrpos_n(
+                many_lower + offset, sizeof(many) - offset,
+                needle_lower, needle_len
+            ));
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strerror_r()
 ------------------------------------------------------------------------------*/
@@ -236,6 +768,80 @@ static void TEST_ctk_strpos(void)
     assert(ctk_strpos(">X,3?in.a{g>>qRc", "{g>>qRd") == -1);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strpos_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strpos_n(void)
+{
+    // Haystack is NULL
+    assert(ctk_strpos_n(NULL, 0, "", 0) == -1);
+    // Needle is NULL
+    assert(ctk_strpos_n("", 0, NULL, 0) == -1);
+    // Haystack and needle are empty
+    assert(ctk_strpos_n("", 0, "", 0) == 0);
+    // Needle is past the length of haystack
+    assert(ctk_strpos_n(">X,3?in.a{g>>qRc", 8, "a{g", 3) == -1);
+    // Needle ends exactly at the length of haystack
+    assert(ctk_strpos_n(">X,3?in.a{g>>qRc", 11, "a{g", 3) == 8);
+    // Only the first characters of needle are used
+    assert(ctk_strpos_n(">X,3?in.a{g>>qRc", 16, "in.Z", 3) == 5);
+    // Haystack and needle contain null characters
+    assert(ctk_strpos_n("ab\0cd\0ef", 8, "\0ef", 3) == 5);
+    // Haystack isn't null-terminated
+    const char hay[4] = {'a', 'b', 'c', 'd'};
+    assert(ctk_strpos_n(hay, sizeof(hay), "cd", 2) == 2);
+    // Every needle length on both sides of the vector blocks, every haystack
+    // length across several of them, against a plain forward scan
+    char many[4096];
+    char needle[72];
+    size_t x = 1;
+    for(size_t needle_len = 1; needle_len <= sizeof(needle); needle_len++) {
+        TEST_CTK_STRCASE_FILL(needle, needle_len, x);
+        for(size_t length = 0; length <= 160; length++) {
+            TEST_CTK_STRCASE_FILL(many, length, x);
+            // An occurrence near the end half of the time
+            if(length >= needle_len && length % 2 == 0) {
+                const size_t room = length - needle_len;
+                memcpy(many + room - room % 3, needle, needle_len);
+            }
+            assert(ctk_strpos_n(many, length, needle, needle_len)
+                == TEST_ctk_strpos_naive(many, length, needle, needle_len));
+        }
+    }
+    // Every window matches on the first and last characters: the search
+    // switches to Two-Way
+    for(size_t needle_len = 3; needle_len <= sizeof(needle); needle_len++) {
+        memset(many, 'a', sizeof(many));
+        memset(needle, 'a', needle_len);
+        needle[x % (needle_len - 2) + 1] = 'b';
+        x = x * 1103515245 + 12345;
+        // The only 'b' of the haystack, cut by the shortest lengths
+        memcpy(many + sizeof(many) - needle_len - 5, needle, needle_len);
+        for(size_t length = sizeof(many) - 16; length <= sizeof(many);
+            length++) {
+            assert(ctk_strpos_n(many, length, needle, needle_len)
+                == TEST_ctk_strpos_naive(many, length, needle, needle_len));
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strpos_naive()
+------------------------------------------------------------------------------*/
+// Position of the first occurrence of \p{needle} in \p{hay}, one window at a
+// time
+static ptrdiff_t TEST_ctk_strpos_naive(
+    const char * const hay, const size_t length,
+    const char * const needle, const size_t needle_len
+)
+{
+    for(size_t pos = 0; pos + needle_len <= length; pos++) {
+        if(memcmp(hay + pos, needle, needle_len) == 0) {
+            return (ptrdiff_t)pos;
+        }
+    }
+    return -1;
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strrpos()
 ------------------------------------------------------------------------------*/
@@ -293,6 +899,80 @@ static void TEST_ctk_strrpos(void)
     assert(ctk_strrpos(">X,3?in.a{g>>qRc", "{g>>qRd") == -1);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strrpos_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strrpos_n(void)
+{
+    // Haystack is NULL
+    assert(ctk_strrpos_n(NULL, 0, "", 0) == -1);
+    // Needle is NULL
+    assert(ctk_strrpos_n("", 0, NULL, 0) == -1);
+    // Haystack and needle are empty
+    assert(ctk_strrpos_n("", 0, "", 0) == 0);
+    // Last needle is past the length of haystack
+    assert(ctk_strrpos_n(">X,3?in.3?i>3?ic", 15, "3?i", 3) == 12);
+    assert(ctk_strrpos_n(">X,3?in.3?i>3?ic", 14, "3?i", 3) == 8);
+    // Only the first characters of needle are used
+    assert(ctk_strrpos_n(">X,3?in.3?i>3?ic", 16, "3?Z", 2) == 12);
+    // Haystack and needle contain null characters
+    assert(ctk_strrpos_n("a\0ba\0bc", 7, "a\0b", 3) == 3);
+    // Haystack isn't null-terminated
+    const char hay[4] = {'c', 'd', 'c', 'd'};
+    assert(ctk_strrpos_n(hay, sizeof(hay), "cd", 2) == 2);
+    // Every needle length on both sides of the vector blocks, every haystack
+    // length across several of them, against a plain backward scan
+    char many[4096];
+    char needle[72];
+    size_t x = 1;
+    for(size_t needle_len = 1; needle_len <= sizeof(needle); needle_len++) {
+        TEST_CTK_STRCASE_FILL(needle, needle_len, x);
+        for(size_t length = 0; length <= 160; length++) {
+            TEST_CTK_STRCASE_FILL(many, length, x);
+            // An occurrence near the start half of the time
+            if(length >= needle_len && length % 2 == 0) {
+                memcpy(many + (length - needle_len) % 3, needle, needle_len);
+            }
+            assert(ctk_strrpos_n(many, length, needle, needle_len)
+                == TEST_ctk_strrpos_naive(many, length, needle, needle_len));
+        }
+    }
+    // Every window matches on the first and last characters: the search
+    // switches to Two-Way
+    for(size_t needle_len = 3; needle_len <= sizeof(needle); needle_len++) {
+        memset(many, 'a', sizeof(many));
+        memset(needle, 'a', needle_len);
+        needle[x % (needle_len - 2) + 1] = 'b';
+        x = x * 1103515245 + 12345;
+        // The only 'b' of the haystack, cut by the largest offsets
+        memcpy(many + 5, needle, needle_len);
+        for(size_t offset = 0; offset <= 16; offset++) {
+            assert(ctk_strrpos_n(
+                many + offset, sizeof(many) - offset, needle, needle_len
+            ) == TEST_ctk_strrpos_naive(
+                many + offset, sizeof(many) - offset, needle, needle_len
+            ));
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strrpos_naive()
+------------------------------------------------------------------------------*/
+// Position of the last occurrence of \p{needle} in \p{hay}, one window at a
+// time
+static ptrdiff_t TEST_ctk_strrpos_naive(
+    const char * const hay, const size_t length,
+    const char * const needle, const size_t needle_len
+)
+{
+    for(size_t pos = length; pos >= needle_len; pos--) {
+        if(memcmp(hay + pos - needle_len, needle, needle_len) == 0) {
+            return (ptrdiff_t)(pos - needle_len);
+        }
+    }
+    return -1;
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strrstr()
 ------------------------------------------------------------------------------*/
@@ -348,6 +1028,43 @@ static void TEST_ctk_strrstr(void)
     assert(ctk_strrstr(">X,3?in.a{g>>qRc", "{g><qRc") == NULL);
     // Needle is at the end but its last char is wrong
     assert(ctk_strrstr(">X,3?in.a{g>>qRc", "{g>>qRd") == NULL);
+    // Haystack and needle are periodic
+    const char * const str_periodic = "abaabaabaabaab";
+    assert(ctk_strrstr(str_periodic, "abaab") == str_periodic+9);
+    assert(ctk_strrstr(str_periodic, "baaba") == str_periodic+7);
+    assert(ctk_strrstr(str_periodic, "abab") == NULL);
+    // Haystack is a single repeated char
+    const char * const str_a = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+    assert(ctk_strrstr(str_a, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa") == str_a+8);
+    assert(ctk_strrstr(str_a, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab") == NULL);
+    assert(ctk_strrstr(str_a, "baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa") == NULL);
+    // Long needle in a longer haystack
+    const char * const str_long =
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+        "eiusmod tempor. Lorem ipsum dolor sit amet, consectetur adipiscing "
+        "elit, sed do eiusmod tempor.";
+    assert(ctk_strrstr(str_long, "Lorem ipsum dolor sit amet, consectetur") == str_long+80);
+    assert(ctk_strrstr(str_long, "Lorem ipsum dolor sit amet, consectetuR") == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strrstr_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strrstr_n(void)
+{
+    const char str[] = ">X,3?in.3?i>3?ic";
+    // Haystack is NULL
+    assert(ctk_strrstr_n(NULL, 0, "", 0) == NULL);
+    // Needle is NULL
+    assert(ctk_strrstr_n(str, 0, NULL, 0) == NULL);
+    // Needle is empty
+    assert(ctk_strrstr_n(str, 16, "", 0) == str);
+    // Needle is absent
+    assert(ctk_strrstr_n(str, 16, "3?j", 3) == NULL);
+    // Last needle is past the length of haystack
+    assert(ctk_strrstr_n(str, 13, "3?i", 3) == str + 8);
+    // Haystack contains null characters
+    assert(ctk_strrstr_n("a\0ba\0bc", 7, "a\0b", 3) != NULL);
     printf("\t%s: OK\n", __func__);
 }
 /*------------------------------------------------------------------------------
@@ -372,6 +1089,74 @@ static void TEST_ctk_strtolower(void)
     assert(strcmp(ctk_strtolower(str_full_actual), str_full_expected) == 0);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtolower_locale()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtolower_locale(void)
+{
+    // NULL pointer
+    assert(ctk_strtolower_locale(NULL) == NULL);
+    // Empty string
+    char str_empty[] = "";
+    assert(strcmp(ctk_strtolower_locale(str_empty), "") == 0);
+    // Full ASCII string
+    char str_full_actual[256] = {0};
+    char str_full_expected[256] = {0};
+    for(int i = 0; i < 255; i++) {
+        str_full_actual[i] = (char)(i+1);
+        str_full_expected[i] = (char)tolower(i+1);
+    }
+    str_full_actual[255] = '\0';
+    str_full_expected[255] = '\0';
+    assert(strcmp(ctk_strtolower_locale(str_full_actual), str_full_expected) == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtolower_locale_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtolower_locale_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtolower_locale_n(NULL, 0) == NULL);
+    // Only the first characters are converted
+    char str[] = "LOREM IPSUM";
+    assert(ctk_strtolower_locale_n(str, 5) == str);
+    assert(strcmp(str, "lorem IPSUM") == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtolower_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtolower_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtolower_n(NULL, 0) == NULL);
+    // Only the first characters are converted
+    char str[] = "LOREM IPSUM";
+    assert(ctk_strtolower_n(str, 5) == str);
+    assert(strcmp(str, "lorem IPSUM") == 0);
+    // Null characters are skipped over
+    char str_nul[] = "AB\0CD";
+    ctk_strtolower_n(str_nul, 5);
+    assert(memcmp(str_nul, "ab\0cd", 5) == 0);
+    // Every byte value at every alignment and for lengths covering the SIMD
+    // loops and their tails: only ASCII letters are converted
+    char buf[300];
+    for(size_t offset = 0; offset < 4; offset++) {
+        for(size_t length = 0; length < sizeof(buf) - offset; length++) {
+            for(size_t k = 0; k < length; k++) {
+                buf[offset + k] = (char)((k * 7 + offset + length) % 256);
+            }
+            assert(ctk_strtolower_n(buf + offset, length) == buf + offset);
+            for(size_t k = 0; k < length; k++) {
+                const int c = (int)((k * 7 + offset + length) % 256);
+                const int expected = (c >= 'A' && c <= 'Z') ? c ^ 0x20 : c;
+                assert((unsigned char)buf[offset + k] == expected);
+            }
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strtoupper()
 ------------------------------------------------------------------------------*/
@@ -394,6 +1179,74 @@ static void TEST_ctk_strtoupper(void)
     assert(strcmp(ctk_strtoupper(str_full_actual), str_full_expected) == 0);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtoupper_locale()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtoupper_locale(void)
+{
+    // NULL pointer
+    assert(ctk_strtoupper_locale(NULL) == NULL);
+    // Empty string
+    char str_empty[] = "";
+    assert(strcmp(ctk_strtoupper_locale(str_empty), "") == 0);
+    // Full ASCII string
+    char str_full_actual[256] = {0};
+    char str_full_expected[256] = {0};
+    for(int i = 0; i < 255; i++) {
+        str_full_actual[i] = (char)(i+1);
+        str_full_expected[i] = (char)toupper(i+1);
+    }
+    str_full_actual[255] = '\0';
+    str_full_expected[255] = '\0';
+    assert(strcmp(ctk_strtoupper_locale(str_full_actual), str_full_expected) == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtoupper_locale_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtoupper_locale_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtoupper_locale_n(NULL, 0) == NULL);
+    // Only the first characters are converted
+    char str[] = "lorem ipsum";
+    assert(ctk_strtoupper_locale_n(str, 5) == str);
+    assert(strcmp(str, "LOREM ipsum") == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtoupper_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtoupper_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtoupper_n(NULL, 0) == NULL);
+    // Only the first characters are converted
+    char str[] = "lorem ipsum";
+    assert(ctk_strtoupper_n(str, 5) == str);
+    assert(strcmp(str, "LOREM ipsum") == 0);
+    // Null characters are skipped over
+    char str_nul[] = "ab\0cd";
+    ctk_strtoupper_n(str_nul, 5);
+    assert(memcmp(str_nul, "AB\0CD", 5) == 0);
+    // Every byte value at every alignment and for lengths covering the SIMD
+    // loops and their tails: only ASCII letters are converted
+    char buf[300];
+    for(size_t offset = 0; offset < 4; offset++) {
+        for(size_t length = 0; length < sizeof(buf) - offset; length++) {
+            for(size_t k = 0; k < length; k++) {
+                buf[offset + k] = (char)((k * 7 + offset + length) % 256);
+            }
+            assert(ctk_strtoupper_n(buf + offset, length) == buf + offset);
+            for(size_t k = 0; k < length; k++) {
+                const int c = (int)((k * 7 + offset + length) % 256);
+                const int expected = (c >= 'a' && c <= 'z') ? c ^ 0x20 : c;
+                assert((unsigned char)buf[offset + k] == expected);
+            }
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strtrim()
 ------------------------------------------------------------------------------*/
@@ -457,6 +1310,24 @@ static void TEST_ctk_strtrim(void)
     assert(strcmp(ctk_strtrim(str_ws_bme5), "Lorem     ipsum     dolor     sit") == 0);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtrim_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtrim_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtrim_n(NULL, 0) == NULL);
+    // Empty string
+    char str_empty[] = "";
+    assert(strcmp(ctk_strtrim_n(str_empty, 0), "") == 0);
+    // Only the first characters are trimmed
+    char str[] = "  Lorem  ipsum  ";
+    assert(strcmp(ctk_strtrim_n(str, 9), "Lorem") == 0);
+    // Nothing is written when there is no trailing white space
+    char str_no_ws[] = " Lorem ipsum";
+    assert(strcmp(ctk_strtrim_n(str_no_ws, 6), "Lorem ipsum") == 0);
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strtriml()
 ------------------------------------------------------------------------------*/
@@ -520,6 +1391,21 @@ static void TEST_ctk_strtriml(void)
     assert(strcmp(ctk_strtriml(str_ws_bme5), "Lorem     ipsum     dolor     sit     ") == 0);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtriml_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtriml_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtriml_n(NULL, 0) == NULL);
+    // Trimming stops at the length
+    char str_only_ws[] = "     ";
+    assert(ctk_strtriml_n(str_only_ws, 3) == str_only_ws + 3);
+    // White spaces after a null character aren't skipped
+    char str_nul[] = " \0 Lorem";
+    assert(ctk_strtriml_n(str_nul, 8) == str_nul + 1);
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_strtrimr()
 ------------------------------------------------------------------------------*/
@@ -583,6 +1469,24 @@ static void TEST_ctk_strtrimr(void)
     assert(strcmp(ctk_strtrimr(str_ws_bme5), "     Lorem     ipsum     dolor     sit") == 0);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_strtrimr_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strtrimr_n(void)
+{
+    // NULL pointer
+    assert(ctk_strtrimr_n(NULL, 0) == NULL);
+    // Only the first characters are trimmed
+    char str[] = "Lorem  ipsum  ";
+    assert(strcmp(ctk_strtrimr_n(str, 7), "Lorem") == 0);
+    // Nothing is written when there is no trailing white space
+    char str_no_ws[] = "Lorem  ipsum";
+    assert(strcmp(ctk_strtrimr_n(str_no_ws, 5), "Lorem  ipsum") == 0);
+    // Only white spaces
+    char str_only_ws[] = "     ";
+    assert(strcmp(ctk_strtrimr_n(str_only_ws, 5), "") == 0);
+    printf("\t%s: OK\n", __func__);
+}
 /*------------------------------------------------------------------------------
     TEST_ctk_tolower()
 ------------------------------------------------------------------------------*/
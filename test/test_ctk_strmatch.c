@@ -0,0 +1,303 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_strmatch.h"
+// The API to test
+#include "ctk_strmatch.h"
+// C Standard Library
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>  // printf()
+#include <string.h> // memcmp(), NULL, size_t, strlen()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+// Capacity of the collected matches
+#define TEST_CTK_STRMATCH_MAX 64
+// Longest text of the exhaustive tests
+#define TEST_CTK_STRMATCH_TEXT 7
+/*==============================================================================
+    STRUCT
+==============================================================================*/
+struct test_ctk_strmatch_matches {
+    struct ctk_strmatch_match match[TEST_CTK_STRMATCH_MAX];
+    size_t count;
+    size_t stop; // Number of matches after which the scan stops, 0 for never
+};
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static bool TEST_ctk_strmatch_collect(
+    const struct ctk_strmatch_match * match, void * ctx
+);
+static size_t TEST_ctk_strmatch_naive(
+    const char * const * patterns, size_t count, const char * text,
+    size_t length, struct test_ctk_strmatch_matches * matches
+);
+static void TEST_ctk_strmatch_all(void);
+static void TEST_ctk_strmatch_all_n(void);
+static void TEST_ctk_strmatch_create(void);
+static void TEST_ctk_strmatch_destroy(void);
+static void TEST_ctk_strmatch_first(void);
+static void TEST_ctk_strmatch_first_n(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch()
+------------------------------------------------------------------------------*/
+void TEST_ctk_strmatch(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_strmatch_all();
+    TEST_ctk_strmatch_all_n();
+    TEST_ctk_strmatch_create();
+    TEST_ctk_strmatch_destroy();
+    TEST_ctk_strmatch_first();
+    TEST_ctk_strmatch_first_n();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_collect()
+------------------------------------------------------------------------------*/
+static bool TEST_ctk_strmatch_collect(
+    const struct ctk_strmatch_match * const match, void * const ctx
+)
+{
+    struct test_ctk_strmatch_matches * const matches = ctx;
+    assert(matches->count < TEST_CTK_STRMATCH_MAX);
+    matches->match[matches->count++] = *match;
+    return matches->count != matches->stop;
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_naive()
+------------------------------------------------------------------------------*/
+// Collects the occurrences of distinct patterns in the order of
+// ctk_strmatch_all_n(): by end, then the longest first
+static size_t TEST_ctk_strmatch_naive(
+    const char * const * const patterns, const size_t count,
+    const char * const text, const size_t length,
+    struct test_ctk_strmatch_matches * const matches
+)
+{
+    matches->count = 0;
+    for(size_t end = 1; end <= length; end++) {
+        for(size_t size = end; size > 0; size--) {
+            for(size_t i = 0; i < count; i++) {
+                if(
+                    strlen(patterns[i]) == size
+                    && memcmp(patterns[i], text + end - size, size) == 0
+                ) {
+                    assert(matches->count < TEST_CTK_STRMATCH_MAX);
+                    matches->match[matches->count++] =
+                        (struct ctk_strmatch_match){i, end - size, size};
+                }
+            }
+        }
+    }
+    return matches->count;
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_all()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strmatch_all(void)
+{
+    const char * const words[] = {"he", "she", "his", "hers"};
+    struct ctk_strmatch * matcher = ctk_strmatch_create(words, NULL, 4);
+    assert(matcher != NULL);
+    struct test_ctk_strmatch_matches matches = {0};
+    // Overlapping and nested occurrences, the longest first at the same end
+    assert(ctk_strmatch_all(matcher, "ushers", TEST_ctk_strmatch_collect,
+        &matches) == 3);
+    assert(matches.count == 3);
+    assert(matches.match[0].pattern == 1 && matches.match[0].start == 1);
+    assert(matches.match[0].length == 3);
+    assert(matches.match[1].pattern == 0 && matches.match[1].start == 2);
+    assert(matches.match[1].length == 2);
+    assert(matches.match[2].pattern == 3 && matches.match[2].start == 2);
+    assert(matches.match[2].length == 4);
+    // Counting only
+    assert(ctk_strmatch_all(matcher, "ushers his", NULL, NULL) == 4);
+    assert(ctk_strmatch_all(matcher, "", NULL, NULL) == 0);
+    assert(ctk_strmatch_all(matcher, "xyz", NULL, NULL) == 0);
+    // The scan stops at the request of the callback
+    matches = (struct test_ctk_strmatch_matches){.stop = 2};
+    assert(ctk_strmatch_all(matcher, "ushers", TEST_ctk_strmatch_collect,
+        &matches) == 2);
+    // The terminating null character ends the text
+    assert(ctk_strmatch_all(matcher, "he\0she", NULL, NULL) == 1);
+    assert(ctk_strmatch_all(NULL, "he", NULL, NULL) == 0);
+    assert(ctk_strmatch_all(matcher, NULL, NULL, NULL) == 0);
+    ctk_strmatch_destroy(&matcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_all_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strmatch_all_n(void)
+{
+    // Every pattern of 1 to 3 bytes over {a, b} against every text up to
+    // TEST_CTK_STRMATCH_TEXT bytes over {a, b, c}, c being in no pattern
+    const char * const patterns[] = {
+        "a", "b", "aa", "ab", "ba", "bb", "aaa", "aab", "aba", "abb", "baa",
+        "bab", "bba", "bbb"
+    };
+    const size_t count = sizeof(patterns) / sizeof(patterns[0]);
+    struct ctk_strmatch * matcher = ctk_strmatch_create(patterns, NULL, count);
+    assert(matcher != NULL);
+    struct test_ctk_strmatch_matches expected;
+    struct test_ctk_strmatch_matches matches;
+    char text[TEST_CTK_STRMATCH_TEXT];
+    for(size_t length = 0; length <= TEST_CTK_STRMATCH_TEXT; length++) {
+        size_t texts = 1;
+        for(size_t i = 0; i < length; i++) {
+            texts *= 3;
+        }
+        for(size_t n = 0; n < texts; n++) {
+            for(size_t i = 0, digits = n; i < length; i++, digits /= 3) {
+                text[i] = "abc"[digits % 3];
+            }
+            TEST_ctk_strmatch_naive(patterns, count, text, length, &expected);
+            matches = (struct test_ctk_strmatch_matches){0};
+            assert(ctk_strmatch_all_n(matcher, text, length,
+                TEST_ctk_strmatch_collect, &matches) == expected.count);
+            assert(matches.count == expected.count);
+            for(size_t i = 0; i < matches.count; i++) {
+                assert(matches.match[i].pattern == expected.match[i].pattern);
+                assert(matches.match[i].start == expected.match[i].start);
+                assert(matches.match[i].length == expected.match[i].length);
+            }
+        }
+    }
+    assert(ctk_strmatch_all_n(matcher, NULL, 0, NULL, NULL) == 0);
+    assert(ctk_strmatch_all_n(matcher, NULL, 1, NULL, NULL) == 0);
+    assert(ctk_strmatch_all_n(NULL, "a", 1, NULL, NULL) == 0);
+    ctk_strmatch_destroy(&matcher);
+    // Null characters are matched as any other byte
+    const char * const binary[] = {"\0\0", "a\0b"};
+    const size_t lengths[] = {2, 3};
+    matcher = ctk_strmatch_create(binary, lengths, 2);
+    assert(matcher != NULL);
+    assert(ctk_strmatch_all_n(matcher, "a\0b\0\0\0", 6, NULL, NULL) == 3);
+    ctk_strmatch_destroy(&matcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_create()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strmatch_create(void)
+{
+    const char * const words[] = {"abc", "abc", "bc"};
+    struct ctk_strmatch * matcher = ctk_strmatch_create(words, NULL, 3);
+    assert(matcher != NULL);
+    // Duplicates are all reported
+    assert(ctk_strmatch_all(matcher, "abc", NULL, NULL) == 3);
+    ctk_strmatch_destroy(&matcher);
+    // Lengths may cut the patterns
+    const size_t lengths[] = {1, 2, 1};
+    matcher = ctk_strmatch_create(words, lengths, 3);
+    assert(matcher != NULL);
+    assert(ctk_strmatch_all(matcher, "ab", NULL, NULL) == 3);
+    ctk_strmatch_destroy(&matcher);
+    // No pattern never matches
+    matcher = ctk_strmatch_create(NULL, NULL, 0);
+    assert(matcher != NULL);
+    assert(ctk_strmatch_all(matcher, "abc", NULL, NULL) == 0);
+    assert(!ctk_strmatch_first(matcher, "abc", NULL));
+    ctk_strmatch_destroy(&matcher);
+    // Failures
+    const char * const empty[] = {"a", ""};
+    const char * const null[] = {"a", NULL};
+    const size_t zero[] = {1, 0};
+    assert(ctk_strmatch_create(NULL, NULL, 1) == NULL);
+    assert(ctk_strmatch_create(empty, NULL, 2) == NULL);
+    assert(ctk_strmatch_create(null, NULL, 2) == NULL);
+    assert(ctk_strmatch_create(words, zero, 2) == NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_destroy()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strmatch_destroy(void)
+{
+    const char * const words[] = {"a"};
+    struct ctk_strmatch * matcher = ctk_strmatch_create(words, NULL, 1);
+    assert(matcher != NULL);
+    ctk_strmatch_destroy(&matcher);
+    assert(matcher == NULL);
+    ctk_strmatch_destroy(&matcher);
+    ctk_strmatch_destroy(NULL);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_first()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strmatch_first(void)
+{
+    const char * const words[] = {"bcd", "abcde", "c"};
+    struct ctk_strmatch * matcher = ctk_strmatch_create(words, NULL, 3);
+    assert(matcher != NULL);
+    struct ctk_strmatch_match match;
+    // The occurrence which ends first, even if another one starts before
+    assert(ctk_strmatch_first(matcher, "xabcde", &match));
+    assert(match.pattern == 2 && match.start == 3 && match.length == 1);
+    assert(ctk_strmatch_first(matcher, "xbcd", &match));
+    assert(match.pattern == 2 && match.start == 2);
+    assert(ctk_strmatch_first(matcher, "xc", NULL));
+    assert(!ctk_strmatch_first(matcher, "abd", &match));
+    assert(!ctk_strmatch_first(matcher, "", &match));
+    assert(!ctk_strmatch_first(matcher, "ab\0c", &match));
+    assert(!ctk_strmatch_first(NULL, "c", &match));
+    assert(!ctk_strmatch_first(matcher, NULL, &match));
+    ctk_strmatch_destroy(&matcher);
+    // The longest of the occurrences ending at the same position
+    const char * const nested[] = {"de", "bcde", "cde"};
+    matcher = ctk_strmatch_create(nested, NULL, 3);
+    assert(matcher != NULL);
+    assert(ctk_strmatch_first(matcher, "abcdef", &match));
+    assert(match.pattern == 1 && match.start == 1 && match.length == 4);
+    ctk_strmatch_destroy(&matcher);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strmatch_first_n()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strmatch_first_n(void)
+{
+    const char * const words[] = {"needle", "pin"};
+    struct ctk_strmatch * matcher = ctk_strmatch_create(words, NULL, 2);
+    assert(matcher != NULL);
+    struct ctk_strmatch_match match;
+    const char hay[] = "hay\0hay\0pin\0needle";
+    assert(ctk_strmatch_first_n(matcher, hay, sizeof(hay) - 1, &match));
+    assert(match.pattern == 1 && match.start == 8 && match.length == 3);
+    // The length bounds the scan
+    assert(!ctk_strmatch_first_n(matcher, hay, 10, &match));
+    assert(ctk_strmatch_first_n(matcher, hay, 11, NULL));
+    assert(!ctk_strmatch_first_n(matcher, NULL, 0, &match));
+    assert(!ctk_strmatch_first_n(matcher, NULL, 1, &match));
+    assert(!ctk_strmatch_first_n(NULL, hay, 11, &match));
+    ctk_strmatch_destroy(&matcher);
+    printf("\t%s: OK\n", __func__);
+}
@@ -0,0 +1,351 @@
+// SPDX-License-Identifier: 0BSD
+/*!
+ * @file
+ * @date 18.10.2026
+ * @license{
+ * BSD Zero Clause License
+ *
+ * Copyright (c) 2026 by the ctk authors
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ * }
+ */
+/*==============================================================================
+    INCLUDE
+==============================================================================*/
+// Own header
+#include "test_ctk_strview.h"
+// The API to test
+#include "ctk_strview.h"
+// C Standard Library
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>  // printf()
+#include <string.h> // NULL, memcmp()
+/*==============================================================================
+    MACRO
+==============================================================================*/
+#define SV CTK_STRVIEW_LITERAL
+/*==============================================================================
+    FUNCTION DECLARATION
+==============================================================================*/
+static void TEST_ctk_strview_cmp(void);
+static void TEST_ctk_strview_ends_with(void);
+static void TEST_ctk_strview_eq(void);
+static void TEST_ctk_strview_from_str(void);
+static void TEST_ctk_strview_pos(void);
+static void TEST_ctk_strview_rpos(void);
+static void TEST_ctk_strview_starts_with(void);
+static void TEST_ctk_strview_sub(void);
+static void TEST_ctk_strview_tolower(void);
+static void TEST_ctk_strview_toupper(void);
+static void TEST_ctk_strview_trim(void);
+static void TEST_ctk_strview_triml(void);
+static void TEST_ctk_strview_trimr(void);
+/*==============================================================================
+    FUNCTION DEFINITION
+==============================================================================*/
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview()
+------------------------------------------------------------------------------*/
+void TEST_ctk_strview(void)
+{
+    printf("%s:\n", __func__);
+    TEST_ctk_strview_cmp();
+    TEST_ctk_strview_ends_with();
+    TEST_ctk_strview_eq();
+    TEST_ctk_strview_from_str();
+    TEST_ctk_strview_pos();
+    TEST_ctk_strview_rpos();
+    TEST_ctk_strview_starts_with();
+    TEST_ctk_strview_sub();
+    TEST_ctk_strview_tolower();
+    TEST_ctk_strview_toupper();
+    TEST_ctk_strview_trim();
+    TEST_ctk_strview_triml();
+    TEST_ctk_strview_trimr();
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_cmp()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_cmp(void)
+{
+    // Invalid view
+    assert(ctk_strview_cmp(CTK_STRVIEW(NULL, 1), SV("")) == 0);
+    // Empty views
+    assert(ctk_strview_cmp(CTK_STRVIEW_EMPTY, SV("")) == 0);
+    // Equal views
+    assert(ctk_strview_cmp(SV("Lorem"), SV("Lorem")) == 0);
+    // First differing character decides
+    assert(ctk_strview_cmp(SV("Lorem"), SV("Lores")) < 0);
+    assert(ctk_strview_cmp(SV("Lores"), SV("Lorem")) > 0);
+    // Characters are compared as unsigned char
+    assert(ctk_strview_cmp(SV("\x80"), SV("\x7F")) > 0);
+    // A prefix is less than the full view
+    assert(ctk_strview_cmp(SV("Lor"), SV("Lorem")) < 0);
+    assert(ctk_strview_cmp(SV("Lorem"), SV("Lor")) > 0);
+    // Null characters are compared
+    assert(ctk_strview_cmp(SV("a\0b"), SV("a\0c")) < 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_ends_with()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_ends_with(void)
+{
+    // Invalid view
+    assert(ctk_strview_ends_with(CTK_STRVIEW(NULL, 1), SV("")) == false);
+    // Empty suffix
+    assert(ctk_strview_ends_with(CTK_STRVIEW_EMPTY, CTK_STRVIEW_EMPTY) == true);
+    assert(ctk_strview_ends_with(SV("Lorem"), SV("")) == true);
+    // Suffix longer than the view
+    assert(ctk_strview_ends_with(SV("rem"), SV("Lorem")) == false);
+    // Matching and non-matching suffixes
+    assert(ctk_strview_ends_with(SV("Lorem"), SV("rem")) == true);
+    assert(ctk_strview_ends_with(SV("Lorem"), SV("Lor")) == false);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_eq()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_eq(void)
+{
+    // Invalid view
+    assert(ctk_strview_eq(CTK_STRVIEW(NULL, 1), CTK_STRVIEW(NULL, 1)) == false);
+    // Empty views
+    assert(ctk_strview_eq(CTK_STRVIEW_EMPTY, SV("")) == true);
+    // Equal views
+    assert(ctk_strview_eq(SV("Lorem"), SV("Lorem")) == true);
+    // Different lengths
+    assert(ctk_strview_eq(SV("Lorem"), SV("Lore")) == false);
+    // Different characters
+    assert(ctk_strview_eq(SV("Lorem"), SV("Loram")) == false);
+    // Views over a part of a bigger buffer
+    const char buf[] = "Lorem Lorem";
+    assert(ctk_strview_eq(CTK_STRVIEW(buf, 5), CTK_STRVIEW(buf + 6, 5)));
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_from_str()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_from_str(void)
+{
+    // NULL pointer
+    struct ctk_strview sv = ctk_strview_from_str(NULL);
+    assert(sv.data == NULL && sv.length == 0);
+    // Empty string
+    const char * const str_empty = "";
+    sv = ctk_strview_from_str(str_empty);
+    assert(sv.data == str_empty && sv.length == 0);
+    // Random string
+    const char * const str = "Lorem ipsum";
+    sv = ctk_strview_from_str(str);
+    assert(sv.data == str && sv.length == 11);
+    // Literal
+    sv = SV("Lorem\0ipsum");
+    assert(sv.length == 11);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_pos()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_pos(void)
+{
+    // Invalid views
+    assert(ctk_strview_pos(CTK_STRVIEW(NULL, 1), SV("")) == -1);
+    assert(ctk_strview_pos(SV(""), CTK_STRVIEW(NULL, 1)) == -1);
+    // Empty views
+    assert(ctk_strview_pos(CTK_STRVIEW_EMPTY, CTK_STRVIEW_EMPTY) == 0);
+    assert(ctk_strview_pos(SV("Lorem"), SV("")) == 0);
+    assert(ctk_strview_pos(CTK_STRVIEW_EMPTY, SV("Lorem")) == -1);
+    // Needle is present multiple times
+    assert(ctk_strview_pos(SV(">X,3?in.3?i>3?ic"), SV("3?i")) == 3);
+    // Needle is absent
+    assert(ctk_strview_pos(SV(">X,3?in.3?i>3?ic"), SV("3?j")) == -1);
+    // Needle is only present after the end of the view
+    const char buf[] = "Lorem ipsum";
+    assert(ctk_strview_pos(CTK_STRVIEW(buf, 8), SV("sum")) == -1);
+    // View and needle contain null characters
+    assert(ctk_strview_pos(SV("a\0b\0c"), SV("\0c")) == 3);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_rpos()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_rpos(void)
+{
+    // Invalid views
+    assert(ctk_strview_rpos(CTK_STRVIEW(NULL, 1), SV("")) == -1);
+    assert(ctk_strview_rpos(SV(""), CTK_STRVIEW(NULL, 1)) == -1);
+    // Empty views
+    assert(ctk_strview_rpos(CTK_STRVIEW_EMPTY, CTK_STRVIEW_EMPTY) == 0);
+    assert(ctk_strview_rpos(SV("Lorem"), SV("")) == 0);
+    assert(ctk_strview_rpos(CTK_STRVIEW_EMPTY, SV("Lorem")) == -1);
+    // Needle is present multiple times
+    assert(ctk_strview_rpos(SV(">X,3?in.3?i>3?ic"), SV("3?i")) == 12);
+    // Needle is absent
+    assert(ctk_strview_rpos(SV(">X,3?in.3?i>3?ic"), SV("3?j")) == -1);
+    // Last needle is after the end of the view
+    const char buf[] = "ab ab ab";
+    assert(ctk_strview_rpos(CTK_STRVIEW(buf, 7), SV("ab")) == 3);
+    // View and needle contain null characters
+    assert(ctk_strview_rpos(SV("\0c\0c"), SV("\0c")) == 2);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_starts_with()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_starts_with(void)
+{
+    // Invalid view
+    assert(ctk_strview_starts_with(CTK_STRVIEW(NULL, 1), SV("")) == false);
+    // Empty prefix
+    assert(ctk_strview_starts_with(CTK_STRVIEW_EMPTY, CTK_STRVIEW_EMPTY));
+    assert(ctk_strview_starts_with(SV("Lorem"), SV("")) == true);
+    // Prefix longer than the view
+    assert(ctk_strview_starts_with(SV("Lor"), SV("Lorem")) == false);
+    // Matching and non-matching prefixes
+    assert(ctk_strview_starts_with(SV("Lorem"), SV("Lor")) == true);
+    assert(ctk_strview_starts_with(SV("Lorem"), SV("rem")) == false);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_sub()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_sub(void)
+{
+    const struct ctk_strview sv = SV("Lorem ipsum");
+    // Invalid view
+    struct ctk_strview sub = ctk_strview_sub(CTK_STRVIEW(NULL, 1), 0, 1);
+    assert(sub.data == NULL && sub.length == 0);
+    // Position past the end
+    sub = ctk_strview_sub(sv, 12, 0);
+    assert(sub.data == NULL && sub.length == 0);
+    // Position at the end
+    sub = ctk_strview_sub(sv, 11, 5);
+    assert(sub.data == sv.data + 11 && sub.length == 0);
+    // Part in the middle
+    sub = ctk_strview_sub(sv, 2, 3);
+    assert(ctk_strview_eq(sub, SV("rem")));
+    // Length is clamped
+    sub = ctk_strview_sub(sv, 6, (size_t)-1);
+    assert(ctk_strview_eq(sub, SV("ipsum")));
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_tolower()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_tolower(void)
+{
+    char buf[16] = "LOREM IPSUM";
+    // NULL pointer
+    struct ctk_strview sv = ctk_strview_tolower(NULL, SV("A"));
+    assert(sv.data == NULL && sv.length == 0);
+    // Invalid view
+    sv = ctk_strview_tolower(buf, CTK_STRVIEW(NULL, 1));
+    assert(sv.data == NULL && sv.length == 0);
+    // Copy
+    char dest[16] = {0};
+    sv = ctk_strview_tolower(dest, CTK_STRVIEW(buf, 5));
+    assert(sv.data == dest && ctk_strview_eq(sv, SV("lorem")));
+    assert(dest[5] == '\0');
+    // In-place
+    sv = ctk_strview_tolower(buf, CTK_STRVIEW(buf, 11));
+    assert(sv.data == buf && ctk_strview_eq(sv, SV("lorem ipsum")));
+    // Null characters
+    sv = ctk_strview_tolower(dest, SV("A\0B"));
+    assert(memcmp(dest, "a\0b", 3) == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_toupper()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_toupper(void)
+{
+    char buf[16] = "lorem ipsum";
+    // NULL pointer
+    struct ctk_strview sv = ctk_strview_toupper(NULL, SV("a"));
+    assert(sv.data == NULL && sv.length == 0);
+    // Invalid view
+    sv = ctk_strview_toupper(buf, CTK_STRVIEW(NULL, 1));
+    assert(sv.data == NULL && sv.length == 0);
+    // Copy
+    char dest[16] = {0};
+    sv = ctk_strview_toupper(dest, CTK_STRVIEW(buf, 5));
+    assert(sv.data == dest && ctk_strview_eq(sv, SV("LOREM")));
+    assert(dest[5] == '\0');
+    // In-place
+    sv = ctk_strview_toupper(buf, CTK_STRVIEW(buf, 11));
+    assert(sv.data == buf && ctk_strview_eq(sv, SV("LOREM IPSUM")));
+    // Null characters
+    sv = ctk_strview_toupper(dest, SV("a\0b"));
+    assert(memcmp(dest, "A\0B", 3) == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_trim()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_trim(void)
+{
+    // Invalid view
+    struct ctk_strview sv = ctk_strview_trim(CTK_STRVIEW(NULL, 1));
+    assert(sv.data == NULL && sv.length == 0);
+    // Empty view
+    sv = ctk_strview_trim(CTK_STRVIEW_EMPTY);
+    assert(sv.data == NULL && sv.length == 0);
+    // Only white spaces
+    assert(ctk_strview_trim(SV(" \t\n ")).length == 0);
+    // No white spaces
+    assert(ctk_strview_eq(ctk_strview_trim(SV("Lorem")), SV("Lorem")));
+    // White spaces: before - middle - end
+    const struct ctk_strview str = SV("  Lorem  ipsum \n");
+    sv = ctk_strview_trim(str);
+    assert(sv.data == str.data + 2);
+    assert(ctk_strview_eq(sv, SV("Lorem  ipsum")));
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_triml()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_triml(void)
+{
+    // Invalid view
+    struct ctk_strview sv = ctk_strview_triml(CTK_STRVIEW(NULL, 1));
+    assert(sv.data == NULL && sv.length == 0);
+    // Only white spaces
+    assert(ctk_strview_triml(SV("   ")).length == 0);
+    // White spaces: before - end
+    assert(ctk_strview_eq(ctk_strview_triml(SV("  Lorem  ")), SV("Lorem  ")));
+    // Trimming stops at the end of the view
+    const char buf[] = "   Lorem";
+    sv = ctk_strview_triml(CTK_STRVIEW(buf, 2));
+    assert(sv.data == buf + 2 && sv.length == 0);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_strview_trimr()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_strview_trimr(void)
+{
+    // Invalid view
+    struct ctk_strview sv = ctk_strview_trimr(CTK_STRVIEW(NULL, 1));
+    assert(sv.data == NULL && sv.length == 0);
+    // Only white spaces
+    assert(ctk_strview_trimr(SV("   ")).length == 0);
+    // White spaces: before - end
+    assert(ctk_strview_eq(ctk_strview_trimr(SV("  Lorem  ")), SV("  Lorem")));
+    // The viewed characters aren't modified
+    const char buf[] = "Lorem   ";
+    sv = ctk_strview_trimr(CTK_STRVIEW(buf, 7));
+    assert(sv.data == buf && sv.length == 5 && buf[5] == ' ');
+    printf("\t%s: OK\n", __func__);
+}
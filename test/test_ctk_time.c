@@ -28,9 +28,11 @@
 #include "ctk_time.h"
 // C Standard Library
 #include <assert.h>
-#include <stdio.h>  // printf()
-#include <string.h> // strcmp()
-#include <time.h>   // asctime(), ctime(), strftime(), struct tm, time_t
+#include <stdint.h> // INT64_C, int64_t
+#include <stdio.h>  // printf(), snprintf()
+#include <string.h> // memcpy(), strcmp()
+#include <time.h>   // asctime(), ctime(), strftime(), struct timespec, struct tm
+                    // time(), time_t
 /*==============================================================================
     MACRO
 ==============================================================================*/
@@ -39,6 +41,10 @@
 ==============================================================================*/
 static void TEST_ctk_localtime_r(void);
 static void TEST_ctk_iso8601_time(void);
+static void TEST_ctk_iso8601_time_cached(void);
+static void TEST_ctk_iso8601_time_ms(void);
+static void TEST_ctk_time_clock(void);
+static void TEST_ctk_time_timespec(void);
 /*==============================================================================
     FUNCTION DEFINITION
 ==============================================================================*/
@@ -50,6 +56,10 @@ void TEST_ctk_time(void)
     printf("%s:\n", __func__);
     TEST_ctk_localtime_r();
     TEST_ctk_iso8601_time();
+    TEST_ctk_iso8601_time_cached();
+    TEST_ctk_iso8601_time_ms();
+    TEST_ctk_time_clock();
+    TEST_ctk_time_timespec();
 }
 /*------------------------------------------------------------------------------
     TEST_ctk_localtime_r()
@@ -99,3 +109,136 @@ static void TEST_ctk_iso8601_time(void)
     assert(res == NULL);
     printf("\t%s: OK\n", __func__);
 }
+/*------------------------------------------------------------------------------
+    TEST_ctk_iso8601_time_cached()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_iso8601_time_cached(void)
+{
+    char buf[CTK_TIME_ISO8601_STR_LENGTH] = {0};
+    char expected[CTK_TIME_ISO8601_STR_LENGTH] = {0};
+    // result == NULL || length < CTK_TIME_ISO8601_STR_LENGTH
+    assert(ctk_iso8601_time_cached(0, NULL, sizeof(buf)) == NULL);
+    assert(ctk_iso8601_time_cached(0, buf, sizeof(buf) - 1) == NULL);
+    // Same result as ctk_iso8601_time(), within and across minutes, forward
+    // and backward, including dates before Epoch, before year 1000 and after
+    // year 9999
+    const time_t bases[] = {
+        0, -1, 59, 60, 951782400, 1615837079, 2147483647, 253402300000,
+        -62101036800, -30610224060
+    };
+    for(size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++) {
+        for(int delta = -200; delta < 200; delta += 7) {
+            const time_t t = bases[i] + delta;
+            const time_t times[] = {t, t + 1, t - 61, t + 3600, t};
+            for(size_t j = 0; j < sizeof(times) / sizeof(times[0]); j++) {
+                // Years of 5 digits don't fit in the buffer
+                const char * const res = ctk_iso8601_time(
+                    times[j], expected, sizeof(expected)
+                );
+                const char * const res_cached = ctk_iso8601_time_cached(
+                    times[j], buf, sizeof(buf)
+                );
+                assert(res_cached == (res != NULL ? buf : NULL));
+                assert(res == NULL || strcmp(buf, expected) == 0);
+            }
+        }
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_iso8601_time_ms()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_iso8601_time_ms(void)
+{
+    char ms[CTK_TIME_ISO8601_MS_STR_LENGTH] = {0};
+    char us[CTK_TIME_ISO8601_US_STR_LENGTH] = {0};
+    char sec[CTK_TIME_ISO8601_STR_LENGTH] = {0};
+    char expected[CTK_TIME_ISO8601_US_STR_LENGTH] = {0};
+    // result == NULL || length too small
+    assert(ctk_iso8601_time_ms(0, NULL, sizeof(ms)) == NULL);
+    assert(ctk_iso8601_time_ms(0, ms, sizeof(ms) - 1) == NULL);
+    assert(ctk_iso8601_time_us(0, NULL, sizeof(us)) == NULL);
+    assert(ctk_iso8601_time_us(0, us, sizeof(us) - 1) == NULL);
+    // Fraction inserted between the seconds and the UTC offset, truncated
+    const struct {
+        int64_t ns;
+        time_t sec;
+        const char * ms;
+        const char * us;
+    } cases[] = {
+        {INT64_C(1615837079123456789), 1615837079, ".123", ".123456"},
+        {INT64_C(1615837079999999999), 1615837079, ".999", ".999999"},
+        {INT64_C(1615837079000000999), 1615837079, ".000", ".000000"},
+        {0, 0, ".000", ".000000"},
+        // Before Epoch the fraction counts from the previous second
+        {-1, -1, ".999", ".999999"},
+        {-INT64_C(1500000000), -2, ".500", ".500000"},
+    };
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        assert(ctk_iso8601_time(cases[i].sec, sec, sizeof(sec)) == sec);
+        assert(ctk_iso8601_time_ms(cases[i].ns, ms, sizeof(ms)) == ms);
+        snprintf(expected, sizeof(expected), "%.19s%s%s",
+            sec, cases[i].ms, sec + 19);
+        assert(strcmp(ms, expected) == 0);
+        assert(ctk_iso8601_time_us(cases[i].ns, us, sizeof(us)) == us);
+        snprintf(expected, sizeof(expected), "%.19s%s%s",
+            sec, cases[i].us, sec + 19);
+        assert(strcmp(us, expected) == 0);
+    }
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_time_clock()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_time_clock(void)
+{
+    // Monotonic clocks never go backward
+    int64_t prev = ctk_time_monotonic_ns();
+    assert(prev >= 0);
+    for(int i = 0; i < 1000; i++) {
+        const int64_t now = ctk_time_monotonic_ns();
+        assert(now >= prev);
+        prev = now;
+    }
+    assert(ctk_time_elapsed_ns(prev) >= 0);
+    // Coarse clocks lag by at most a tick
+    const int64_t coarse = ctk_time_monotonic_coarse_ns();
+    assert(coarse >= 0);
+    assert(coarse <= ctk_time_monotonic_ns());
+    assert(ctk_time_monotonic_ns() - coarse < CTK_TIME_NS_PER_SEC);
+    // Realtime clocks agree with time(), which may itself be coarse
+    const time_t before = time(NULL);
+    const int64_t real = ctk_time_realtime_ns();
+    const int64_t real_coarse = ctk_time_realtime_coarse_ns();
+    const time_t after = time(NULL);
+    assert(real / CTK_TIME_NS_PER_SEC >= before - 1);
+    assert(real / CTK_TIME_NS_PER_SEC <= after + 1);
+    assert(real_coarse / CTK_TIME_NS_PER_SEC >= before - 1);
+    assert(real_coarse / CTK_TIME_NS_PER_SEC <= after + 1);
+    printf("\t%s: OK\n", __func__);
+}
+/*------------------------------------------------------------------------------
+    TEST_ctk_time_timespec()
+------------------------------------------------------------------------------*/
+static void TEST_ctk_time_timespec(void)
+{
+    const int64_t values[] = {
+        0, 1, -1, 999999999, 1000000000, -1000000000, -1000000001,
+        INT64_C(1615837079123456789), -INT64_C(1615837079123456789)
+    };
+    for(size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        const struct timespec ts = ctk_time_to_timespec(values[i]);
+        assert(ts.tv_nsec >= 0);
+        assert(ts.tv_nsec < 1000000000);
+        assert(ctk_time_from_timespec(ts) == values[i]);
+    }
+    const struct timespec ts = ctk_time_to_timespec(-1);
+    assert(ts.tv_sec == -1);
+    assert(ts.tv_nsec == 999999999);
+    // Duration arithmetic
+    const int64_t d = 2 * CTK_TIME_NS_PER_SEC + 3 * CTK_TIME_NS_PER_MS
+        + 4 * CTK_TIME_NS_PER_US + 5;
+    assert(d == INT64_C(2003004005));
+    assert(d / CTK_TIME_NS_PER_MS == 2003);
+    printf("\t%s: OK\n", __func__);
+}
@@ -24,8 +24,18 @@
 ==============================================================================*/
 // Test headers
 #include "test_ctk_alloc.h"
+#include "test_ctk_arena.h"
+#include "test_ctk_ascii.h"
 #include "test_ctk_error.h"
+#include "test_ctk_hashmap.h"
+#include "test_ctk_log.h"
+#include "test_ctk_platform.h"
+#include "test_ctk_pool.h"
+#include "test_ctk_searcher.h"
+#include "test_ctk_strbuf.h"
+#include "test_ctk_strmatch.h"
 #include "test_ctk_string.h"
+#include "test_ctk_strview.h"
 #include "test_ctk_time.h"
 // C Standard Library
 #include <stdio.h>  // printf()
@@ -37,8 +47,18 @@ int main(void)
 {
     printf("*** Testing: ctk ***\n");
     TEST_ctk_alloc();
+    TEST_ctk_arena();
+    TEST_ctk_ascii();
     TEST_ctk_error();
+    TEST_ctk_hashmap();
+    TEST_ctk_log();
+    TEST_ctk_platform();
+    TEST_ctk_pool();
+    TEST_ctk_searcher();
+    TEST_ctk_strbuf();
+    TEST_ctk_strmatch();
     TEST_ctk_string();
+    TEST_ctk_strview();
     TEST_ctk_time();
     return EXIT_SUCCESS;
 }